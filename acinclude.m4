@@ -6,6 +6,30 @@ dnl Function to detect if liblnk dependencies are available
 AC_DEFUN([AX_LIBLNK_CHECK_LOCAL],
   [dnl Check for internationalization functions in liblnk/liblnk_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for memory mapped file support in liblnk/liblnk_memory_map.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+  AC_CHECK_FUNCS([mmap munmap])
+
+  dnl Check for monotonic clock support in liblnk/liblnk_statistics.c
+  AC_CHECK_HEADERS([time.h])
+  AC_SEARCH_LIBS([clock_gettime], [rt])
+  AC_CHECK_FUNCS([clock_gettime])
+])
+
+dnl Function to detect if lnktools dependencies are available
+AC_DEFUN([AX_LIBLNK_CHECK_TOOLS_LOCAL],
+  [dnl Check for directory scanning support in lnktools/scan_handle.c
+  AC_CHECK_HEADERS([dirent.h errno.h sys/stat.h])
+  AC_CHECK_FUNCS([closedir lstat opendir readdir stat])
+])
+
+dnl Function to detect if benchmark dependencies are available
+AC_DEFUN([AX_LIBLNK_CHECK_BENCH_LOCAL],
+  [dnl Check for monotonic clock support in tests/bench/lnk_bench_functions.c
+  AC_CHECK_HEADERS([time.h])
+  AC_SEARCH_LIBS([clock_gettime], [rt])
+  AC_CHECK_FUNCS([clock_gettime])
 ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,377 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "liblnk_arena.h"
+#include "liblnk_definitions.h"
+#include "liblnk_libcerror.h"
+
+/* The size of the block header rounded up to the allocation alignment
+ */
+#define LIBLNK_ARENA_BLOCK_HEADER_SIZE \
+	( ( sizeof( liblnk_arena_block_t ) + ( LIBLNK_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBLNK_ARENA_ALIGNMENT - 1 ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * The first block is allocated on the first allocation
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_arena_initialize(
+     liblnk_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBLNK_ARENA_BLOCK_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          liblnk_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( liblnk_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	( *arena )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * All memory allocated from the arena is freed
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_arena_free(
+     liblnk_arena_t **arena,
+     libcerror_error_t **error )
+{
+	liblnk_arena_block_t *arena_block = NULL;
+	liblnk_arena_block_t *next_block  = NULL;
+	static char *function             = "liblnk_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		arena_block = ( *arena )->first_block;
+
+		while( arena_block != NULL )
+		{
+			next_block = arena_block->next_block;
+
+			memory_free(
+			 arena_block );
+
+			arena_block = next_block;
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears an arena
+ * All memory allocated from the arena is released, the blocks are kept for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_arena_clear(
+     liblnk_arena_t *arena,
+     libcerror_error_t **error )
+{
+	liblnk_arena_block_t *arena_block = NULL;
+	static char *function             = "liblnk_arena_clear";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	arena_block = arena->first_block;
+
+	while( arena_block != NULL )
+	{
+		arena_block->data_offset = 0;
+
+		arena_block = arena_block->next_block;
+	}
+	arena->current_block         = arena->first_block;
+	arena->number_of_allocations = 0;
+
+	return( 1 );
+}
+
+/* Appends a block to the arena
+ * The block is at least the size of the arena block size and becomes the current block
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_arena_append_block(
+     liblnk_arena_t *arena,
+     size_t minimum_data_size,
+     libcerror_error_t **error )
+{
+	liblnk_arena_block_t *arena_block = NULL;
+	static char *function             = "liblnk_arena_append_block";
+	size_t data_size                  = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = arena->block_size;
+
+	if( minimum_data_size > data_size )
+	{
+		data_size = minimum_data_size;
+	}
+	if( data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBLNK_ARENA_BLOCK_HEADER_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The block header and data are allocated as a single contiguous block
+	 */
+	arena_block = (liblnk_arena_block_t *) memory_allocate(
+	                                        LIBLNK_ARENA_BLOCK_HEADER_SIZE + data_size );
+
+	if( arena_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena block.",
+		 function );
+
+		return( -1 );
+	}
+	arena_block->next_block  = NULL;
+	arena_block->data        = &( ( (uint8_t *) arena_block )[ LIBLNK_ARENA_BLOCK_HEADER_SIZE ] );
+	arena_block->data_size   = data_size;
+	arena_block->data_offset = 0;
+
+	if( arena->first_block == NULL )
+	{
+		arena->first_block = arena_block;
+	}
+	else
+	{
+		arena->current_block->next_block = arena_block;
+	}
+	arena->current_block = arena_block;
+
+	return( 1 );
+}
+
+/* Allocates zero initialized memory from the arena
+ * The memory remains valid until the arena is cleared or freed and must not be freed separately
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_arena_allocate(
+     liblnk_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_arena_allocate";
+	size_t aligned_size   = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBLNK_ARENA_BLOCK_HEADER_SIZE - LIBLNK_ARENA_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = ( size + ( LIBLNK_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBLNK_ARENA_ALIGNMENT - 1 );
+
+	/* Blocks kept by a previous clear are reused before a new block is appended
+	 */
+	while( ( arena->current_block != NULL )
+	    && ( arena->current_block->next_block != NULL )
+	    && ( aligned_size > ( arena->current_block->data_size - arena->current_block->data_offset ) ) )
+	{
+		arena->current_block = arena->current_block->next_block;
+	}
+	if( ( arena->current_block == NULL )
+	 || ( aligned_size > ( arena->current_block->data_size - arena->current_block->data_offset ) ) )
+	{
+		if( liblnk_arena_append_block(
+		     arena,
+		     aligned_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append arena block.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*memory = (void *) &( arena->current_block->data[ arena->current_block->data_offset ] );
+
+	if( memory_set(
+	     *memory,
+	     0,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory.",
+		 function );
+
+		*memory = NULL;
+
+		return( -1 );
+	}
+	arena->current_block->data_offset += aligned_size;
+	arena->number_of_allocations      += 1;
+
+	return( 1 );
+}
+
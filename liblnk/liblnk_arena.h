@@ -0,0 +1,105 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBLNK_ARENA_H )
+#define _LIBLNK_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "liblnk_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct liblnk_arena_block liblnk_arena_block_t;
+
+struct liblnk_arena_block
+{
+	/* The next block
+	 */
+	liblnk_arena_block_t *next_block;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data offset of the next allocation
+	 */
+	size_t data_offset;
+};
+
+typedef struct liblnk_arena liblnk_arena_t;
+
+struct liblnk_arena
+{
+	/* The first block
+	 */
+	liblnk_arena_block_t *first_block;
+
+	/* The current block
+	 */
+	liblnk_arena_block_t *current_block;
+
+	/* The (default) block size
+	 */
+	size_t block_size;
+
+	/* The number of allocations
+	 */
+	int number_of_allocations;
+};
+
+int liblnk_arena_initialize(
+     liblnk_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int liblnk_arena_free(
+     liblnk_arena_t **arena,
+     libcerror_error_t **error );
+
+int liblnk_arena_clear(
+     liblnk_arena_t *arena,
+     libcerror_error_t **error );
+
+int liblnk_arena_append_block(
+     liblnk_arena_t *arena,
+     size_t minimum_data_size,
+     libcerror_error_t **error );
+
+int liblnk_arena_allocate(
+     liblnk_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBLNK_ARENA_H ) */
+
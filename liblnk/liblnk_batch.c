@@ -0,0 +1,1972 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "liblnk_batch.h"
+#include "liblnk_definitions.h"
+#include "liblnk_file.h"
+#include "liblnk_libbfio.h"
+#include "liblnk_libcdata.h"
+#include "liblnk_libcerror.h"
+#include "liblnk_libcnotify.h"
+#include "liblnk_libcthreads.h"
+#include "liblnk_types.h"
+
+/* Creates a batch entry
+ * Make sure the value batch_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_entry_initialize(
+     liblnk_batch_entry_t **batch_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_batch_entry_initialize";
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*batch_entry = memory_allocate_structure(
+	                liblnk_batch_entry_t );
+
+	if( *batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *batch_entry,
+	     0,
+	     sizeof( liblnk_batch_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *batch_entry != NULL )
+	{
+		memory_free(
+		 *batch_entry );
+
+		*batch_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a batch entry
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_entry_free(
+     liblnk_batch_entry_t **batch_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_batch_entry_free";
+	int result            = 1;
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch_entry != NULL )
+	{
+		if( ( *batch_entry )->file != NULL )
+		{
+			if( liblnk_file_free(
+			     &( ( *batch_entry )->file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *batch_entry )->open_error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *batch_entry )->open_error ) );
+		}
+		if( ( *batch_entry )->filename != NULL )
+		{
+			memory_free(
+			 ( *batch_entry )->filename );
+		}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+		if( ( *batch_entry )->filename_wide != NULL )
+		{
+			memory_free(
+			 ( *batch_entry )->filename_wide );
+		}
+#endif
+		memory_free(
+		 *batch_entry );
+
+		*batch_entry = NULL;
+	}
+	return( result );
+}
+
+/* Creates a batch
+ * Make sure the value batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_initialize(
+     liblnk_batch_t **batch,
+     libcerror_error_t **error )
+{
+	liblnk_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "liblnk_batch_initialize";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = memory_allocate_structure(
+	                  liblnk_internal_batch_t );
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_batch,
+	     0,
+	     sizeof( liblnk_internal_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear batch.",
+		 function );
+
+		memory_free(
+		 internal_batch );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_batch->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_batch->callback_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize callback mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_batch->passed_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize passed condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*batch = (liblnk_batch_t *) internal_batch;
+
+	return( 1 );
+
+on_error:
+	if( internal_batch != NULL )
+	{
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+		if( internal_batch->callback_mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( internal_batch->callback_mutex ),
+			 NULL );
+		}
+#endif
+		if( internal_batch->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_batch->entries_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_batch );
+	}
+	return( -1 );
+}
+
+/* Frees a batch
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_free(
+     liblnk_batch_t **batch,
+     libcerror_error_t **error )
+{
+	liblnk_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "liblnk_batch_free";
+	int result                              = 1;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *batch != NULL )
+	{
+		internal_batch = (liblnk_internal_batch_t *) *batch;
+		*batch         = NULL;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_batch->callback_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free callback mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_condition_free(
+		     &( internal_batch->passed_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free passed condition.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcdata_array_free(
+		     &( internal_batch->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &liblnk_batch_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_batch );
+	}
+	return( result );
+}
+
+/* Retrieves the number of threads used to process the batch
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_get_number_of_threads(
+     liblnk_batch_t *batch,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	liblnk_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "liblnk_batch_get_number_of_threads";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (liblnk_internal_batch_t *) batch;
+
+	if( number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_threads = internal_batch->number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the number of threads used to process the batch
+ * A value of 0 processes the batch in the calling thread, which is also
+ * the case when the library was built without multi-thread support
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_set_number_of_threads(
+     liblnk_batch_t *batch,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	liblnk_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "liblnk_batch_set_number_of_threads";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (liblnk_internal_batch_t *) batch;
+
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBLNK_BATCH_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Sets the entry function
+ * The entry function is called by the thread that opened the file of an entry,
+ * with the callback function arguments passed to process, before the entry
+ * is passed to the callback function. It is only called for files that could
+ * be opened and can be called by multiple threads at the same time. Use it
+ * to do per file work, such as retrieving values, concurrently.
+ * The entry function must return 1 to continue or any other value to abort processing
+ * A NULL entry function removes the entry function
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_set_entry_function(
+     liblnk_batch_t *batch,
+     int (*entry_function)(
+            int entry_index,
+            liblnk_file_t *file,
+            void *callback_function_arguments ),
+     libcerror_error_t **error )
+{
+	liblnk_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "liblnk_batch_set_entry_function";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (liblnk_internal_batch_t *) batch;
+
+	internal_batch->entry_function = entry_function;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_get_number_of_entries(
+     liblnk_batch_t *batch,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	liblnk_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "liblnk_batch_get_number_of_entries";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (liblnk_internal_batch_t *) batch;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_batch->entries_array,
+	     number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an entry
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_batch_append_entry(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_internal_batch_append_entry";
+	int entry_index       = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     internal_batch->entries_array,
+	     &entry_index,
+	     (intptr_t *) batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry to array.",
+		 function );
+
+		return( -1 );
+	}
+	batch_entry->entry_index = entry_index;
+
+	return( 1 );
+}
+
+/* Appends a file by name
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_append_filename(
+     liblnk_batch_t *batch,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	liblnk_batch_entry_t *batch_entry = NULL;
+	static char *function             = "liblnk_batch_append_filename";
+	size_t filename_size              = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_size = narrow_string_length(
+	                 filename ) + 1;
+
+	if( liblnk_batch_entry_initialize(
+	     &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	batch_entry->filename = narrow_string_allocate(
+	                         filename_size );
+
+	if( batch_entry->filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( narrow_string_copy(
+	     batch_entry->filename,
+	     filename,
+	     filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_internal_batch_append_entry(
+	     (liblnk_internal_batch_t *) batch,
+	     batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( batch_entry != NULL )
+	{
+		liblnk_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Appends a file by name
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_append_filename_wide(
+     liblnk_batch_t *batch,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	liblnk_batch_entry_t *batch_entry = NULL;
+	static char *function             = "liblnk_batch_append_filename_wide";
+	size_t filename_size              = 0;
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_size = wide_string_length(
+	                 filename ) + 1;
+
+	if( liblnk_batch_entry_initialize(
+	     &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	batch_entry->filename_wide = wide_string_allocate(
+	                              filename_size );
+
+	if( batch_entry->filename_wide == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( wide_string_copy(
+	     batch_entry->filename_wide,
+	     filename,
+	     filename_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_internal_batch_append_entry(
+	     (liblnk_internal_batch_t *) batch,
+	     batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( batch_entry != NULL )
+	{
+		liblnk_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Appends a file using a Basic File IO (bfio) handle
+ * The file IO handle must remain valid until the batch is freed
+ * and must not be shared with other entries
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_append_file_io_handle(
+     liblnk_batch_t *batch,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	liblnk_batch_entry_t *batch_entry = NULL;
+	static char *function             = "liblnk_batch_append_file_io_handle";
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_batch_entry_initialize(
+	     &batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	batch_entry->file_io_handle = file_io_handle;
+
+	if( liblnk_internal_batch_append_entry(
+	     (liblnk_internal_batch_t *) batch,
+	     batch_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append batch entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( batch_entry != NULL )
+	{
+		liblnk_batch_entry_free(
+		 &batch_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the file of an entry
+ * If the file cannot be opened the file of the entry is set to NULL
+ * and the open error of the entry contains the reason
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_batch_open_entry(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *open_error = NULL;
+	static char *function         = "liblnk_internal_batch_open_entry";
+	int result                    = 0;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry->file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid batch entry - file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_file_initialize(
+	     &( batch_entry->file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry->filename != NULL )
+	{
+		result = liblnk_file_open(
+		          batch_entry->file,
+		          batch_entry->filename,
+		          internal_batch->access_flags,
+		          &open_error );
+	}
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	else if( batch_entry->filename_wide != NULL )
+	{
+		result = liblnk_file_open_wide(
+		          batch_entry->file,
+		          batch_entry->filename_wide,
+		          internal_batch->access_flags,
+		          &open_error );
+	}
+#endif
+	else
+	{
+		result = liblnk_file_open_file_io_handle(
+		          batch_entry->file,
+		          batch_entry->file_io_handle,
+		          internal_batch->access_flags,
+		          &open_error );
+	}
+	if( result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to open batch entry: %d.\n",
+			 function,
+			 batch_entry->entry_index );
+
+			libcnotify_print_error_backtrace(
+			 open_error );
+		}
+#endif
+		batch_entry->open_error = open_error;
+
+		if( liblnk_file_free(
+		     &( batch_entry->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Calls the entry function for the opened file of an entry
+ * Returns 1 to continue or 0 if the entry function requested to abort
+ */
+int liblnk_internal_batch_call_entry_function(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry )
+{
+	if( ( internal_batch == NULL )
+	 || ( batch_entry == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( internal_batch->entry_function == NULL )
+	 || ( batch_entry->file == NULL ) )
+	{
+		return( 1 );
+	}
+	if( internal_batch->entry_function(
+	     batch_entry->entry_index,
+	     batch_entry->file,
+	     internal_batch->callback_function_arguments ) != 1 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Passes an entry to the callback function
+ * The callback function is not called after an abort was requested or a worker failed
+ * The file of the entry is closed afterwards by liblnk_internal_batch_close_entries
+ * so that it is not closed while holding the callback mutex
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_batch_pass_entry(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_internal_batch_pass_entry";
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_batch->callback_function != NULL )
+	 && ( internal_batch->abort == 0 )
+	 && ( internal_batch->worker_failed == 0 ) )
+	{
+		if( internal_batch->callback_function(
+		     batch_entry->entry_index,
+		     batch_entry->file,
+		     batch_entry->open_error,
+		     internal_batch->callback_function_arguments ) != 1 )
+		{
+			internal_batch->abort = 1;
+		}
+	}
+	internal_batch->number_of_passed_entries += 1;
+
+	return( 1 );
+}
+
+/* Frees the open error and closes and frees the file of an entry
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_batch_close_entry(
+     liblnk_batch_entry_t *batch_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_internal_batch_close_entry";
+	int result            = 1;
+
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry->open_error != NULL )
+	{
+		libcerror_error_free(
+		 &( batch_entry->open_error ) );
+	}
+	if( batch_entry->file != NULL )
+	{
+		if( liblnk_file_close(
+		     batch_entry->file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			result = -1;
+		}
+		if( liblnk_file_free(
+		     &( batch_entry->file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Closes the entries that were passed to the callback function
+ * The passed entries are no longer accessed by other threads, hence
+ * the callback mutex does not need to be held
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_batch_close_entries(
+     liblnk_internal_batch_t *internal_batch,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	liblnk_batch_entry_t *batch_entry = NULL;
+	static char *function             = "liblnk_internal_batch_close_entries";
+	int entry_index                   = 0;
+	int result                        = 1;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = first_entry_index;
+	     entry_index < ( first_entry_index + number_of_entries );
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_batch->entries_array,
+		     entry_index,
+		     (intptr_t **) &batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( liblnk_internal_batch_close_entry(
+		     batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close entry: %d.",
+			 function,
+			 entry_index );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Marks an entry as processed and passes the entries that are ready to the callback function
+ * In input order an entry is only passed after all the preceding entries have been passed
+ * The passed entries are the number of passed entries starting at the first passed entry index
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_batch_complete_entry(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry,
+     int *first_passed_entry_index,
+     int *number_of_passed_entries,
+     libcerror_error_t **error )
+{
+	liblnk_batch_entry_t *next_batch_entry = NULL;
+	static char *function                  = "liblnk_internal_batch_complete_entry";
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( batch_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_passed_entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first passed entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_passed_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of passed entries.",
+		 function );
+
+		return( -1 );
+	}
+	batch_entry->is_processed = 1;
+
+	if( internal_batch->result_order == LIBLNK_BATCH_RESULT_ORDER_COMPLETION )
+	{
+		*first_passed_entry_index = batch_entry->entry_index;
+		*number_of_passed_entries = 1;
+
+		if( liblnk_internal_batch_pass_entry(
+		     internal_batch,
+		     batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pass entry: %d.",
+			 function,
+			 batch_entry->entry_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	*first_passed_entry_index = internal_batch->next_entry_index;
+	*number_of_passed_entries = 0;
+
+	while( internal_batch->next_entry_index < internal_batch->number_of_entries )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_batch->entries_array,
+		     internal_batch->next_entry_index,
+		     (intptr_t **) &next_batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 internal_batch->next_entry_index );
+
+			return( -1 );
+		}
+		if( ( next_batch_entry == NULL )
+		 || ( next_batch_entry->is_processed == 0 ) )
+		{
+			break;
+		}
+		internal_batch->next_entry_index += 1;
+		*number_of_passed_entries        += 1;
+
+		if( liblnk_internal_batch_pass_entry(
+		     internal_batch,
+		     next_batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to pass entry: %d.",
+			 function,
+			 next_batch_entry->entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+
+/* Processes an entry on a worker thread
+ * The entry is not opened after an abort was requested or a worker failed
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_batch_process_entry_worker(
+     liblnk_batch_entry_t *batch_entry,
+     liblnk_internal_batch_t *internal_batch )
+{
+	libcerror_error_t *error     = NULL;
+	static char *function        = "liblnk_batch_process_entry_worker";
+	int first_passed_entry_index = 0;
+	int number_of_passed_entries = 0;
+	uint8_t abort_entry          = 0;
+	uint8_t entry_completed      = 0;
+	uint8_t skip_entry           = 0;
+	int result                   = 1;
+
+	if( ( batch_entry == NULL )
+	 || ( internal_batch == NULL ) )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     internal_batch->callback_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab callback mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_batch->abort != 0 )
+	 || ( internal_batch->worker_failed != 0 ) )
+	{
+		skip_entry = 1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_batch->callback_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release callback mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( skip_entry == 0 )
+	{
+		if( liblnk_internal_batch_open_entry(
+		     internal_batch,
+		     batch_entry,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open entry: %d.",
+			 function,
+			 batch_entry->entry_index );
+
+			result = -1;
+		}
+		/* The entry function is called without holding the callback mutex
+		 * so that the per file work is done concurrently
+		 */
+		else if( liblnk_internal_batch_call_entry_function(
+		          internal_batch,
+		          batch_entry ) != 1 )
+		{
+			abort_entry = 1;
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     internal_batch->callback_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab callback mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 1 )
+	{
+		internal_batch->worker_failed = 1;
+	}
+	if( abort_entry != 0 )
+	{
+		internal_batch->abort = 1;
+	}
+	entry_completed = 1;
+
+	if( liblnk_internal_batch_complete_entry(
+	     internal_batch,
+	     batch_entry,
+	     &first_passed_entry_index,
+	     &number_of_passed_entries,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to complete entry: %d.",
+		 function,
+		 batch_entry->entry_index );
+
+		internal_batch->worker_failed = 1;
+
+		result = -1;
+	}
+	/* Wake up the thread that pushes the entries and waits for
+	 * entries to be passed to the callback function
+	 */
+	if( libcthreads_condition_broadcast(
+	     internal_batch->passed_condition,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast passed condition.",
+		 function );
+
+		internal_batch->worker_failed = 1;
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     internal_batch->callback_mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release callback mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* The passed entries are closed without holding the callback mutex
+	 */
+	if( liblnk_internal_batch_close_entries(
+	     internal_batch,
+	     first_passed_entry_index,
+	     number_of_passed_entries,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close passed entries.",
+		 function );
+
+		number_of_passed_entries = 0;
+
+		goto on_error;
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+
+on_error:
+	/* Make sure the entry is completed and its file is closed so that
+	 * the entries that follow it in input order are still passed and
+	 * the thread that waits for passed entries is woken up
+	 */
+	if( entry_completed == 0 )
+	{
+		liblnk_internal_batch_close_entry(
+		 batch_entry,
+		 NULL );
+
+		batch_entry->is_processed = 1;
+	}
+	else if( number_of_passed_entries > 0 )
+	{
+		liblnk_internal_batch_close_entries(
+		 internal_batch,
+		 first_passed_entry_index,
+		 number_of_passed_entries,
+		 NULL );
+	}
+	internal_batch->worker_failed = 1;
+
+	libcthreads_condition_broadcast(
+	 internal_batch->passed_condition,
+	 NULL );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Waits until the entry can be pushed onto the thread pool without exceeding
+ * the maximum number of open entries
+ * Returns 1 if the entry can be pushed, 0 if processing was aborted or a worker failed or -1 on error
+ */
+int liblnk_internal_batch_wait_for_open_entry(
+     liblnk_internal_batch_t *internal_batch,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	static char *function              = "liblnk_internal_batch_wait_for_open_entry";
+	int maximum_number_of_open_entries = 0;
+	int result                         = 1;
+
+	if( internal_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_number_of_open_entries = internal_batch->number_of_threads
+	                               * LIBLNK_BATCH_MAXIMUM_NUMBER_OF_OPEN_ENTRIES_PER_THREAD;
+
+	if( libcthreads_mutex_grab(
+	     internal_batch->callback_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab callback mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( internal_batch->abort == 0 )
+	    && ( internal_batch->worker_failed == 0 )
+	    && ( ( entry_index - internal_batch->number_of_passed_entries ) >= maximum_number_of_open_entries ) )
+	{
+		if( libcthreads_condition_wait(
+		     internal_batch->passed_condition,
+		     internal_batch->callback_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for passed condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( ( result == 1 )
+	 && ( ( internal_batch->abort != 0 )
+	  ||  ( internal_batch->worker_failed != 0 ) ) )
+	{
+		result = 0;
+	}
+	if( libcthreads_mutex_release(
+	     internal_batch->callback_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release callback mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT ) */
+
+/* Processes the batch
+ * Every entry is opened with the access flags and passed to the callback function,
+ * the file argument is NULL if the entry could not be opened and the open error
+ * argument contains the reason. The file and the open error are freed after the
+ * callback function returns and must not be used afterwards.
+ * The number of files that are open at the same time is limited to a small multiple
+ * of the number of threads
+ * The callback function is called by one thread at a time and must return 1 to continue
+ * or any other value to abort processing, entries that were not opened before the abort
+ * are not opened and not passed to the callback function
+ * The callback function can be NULL when the files are only processed by the entry function
+ * Returns 1 if successful, 0 if aborted by the callback or entry function or -1 on error
+ */
+int liblnk_batch_process(
+     liblnk_batch_t *batch,
+     int access_flags,
+     int result_order,
+     int (*callback_function)(
+            int entry_index,
+            liblnk_file_t *file,
+            libcerror_error_t *open_error,
+            void *callback_function_arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error )
+{
+	liblnk_batch_entry_t *batch_entry       = NULL;
+	liblnk_internal_batch_t *internal_batch = NULL;
+	static char *function                   = "liblnk_batch_process";
+	int entry_index                         = 0;
+	int first_passed_entry_index            = 0;
+	int number_of_entries                   = 0;
+	int number_of_passed_entries            = 0;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool  = NULL;
+	int result                              = 0;
+#endif
+
+	if( batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid batch.",
+		 function );
+
+		return( -1 );
+	}
+	internal_batch = (liblnk_internal_batch_t *) batch;
+
+	if( ( result_order != LIBLNK_BATCH_RESULT_ORDER_INPUT )
+	 && ( result_order != LIBLNK_BATCH_RESULT_ORDER_COMPLETION ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported result order.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_batch->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_batch->entries_array,
+		     entry_index,
+		     (intptr_t **) &batch_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		batch_entry->is_processed = 0;
+	}
+	internal_batch->access_flags                = access_flags;
+	internal_batch->result_order                = result_order;
+	internal_batch->callback_function           = callback_function;
+	internal_batch->callback_function_arguments = callback_function_arguments;
+	internal_batch->number_of_entries           = number_of_entries;
+	internal_batch->next_entry_index            = 0;
+	internal_batch->number_of_passed_entries    = 0;
+	internal_batch->abort                       = 0;
+	internal_batch->worker_failed               = 0;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( ( internal_batch->number_of_threads > 0 )
+	 && ( number_of_entries > 1 ) )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     internal_batch->number_of_threads,
+		     number_of_entries,
+		     (int (*)(intptr_t *, void *)) &liblnk_batch_process_entry_worker,
+		     (void *) internal_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_batch->entries_array,
+			     entry_index,
+			     (intptr_t **) &batch_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			/* In input order an entry that takes long to process keeps the entries
+			 * that follow it open, hence the number of open entries is limited
+			 */
+			result = liblnk_internal_batch_wait_for_open_entry(
+			          internal_batch,
+			          entry_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for entry: %d.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) batch_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push entry: %d onto thread pool.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif /* defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT ) */
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_batch->entries_array,
+			     entry_index,
+			     (intptr_t **) &batch_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( liblnk_internal_batch_open_entry(
+			     internal_batch,
+			     batch_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( liblnk_internal_batch_call_entry_function(
+			     internal_batch,
+			     batch_entry ) != 1 )
+			{
+				internal_batch->abort = 1;
+			}
+			if( liblnk_internal_batch_complete_entry(
+			     internal_batch,
+			     batch_entry,
+			     &first_passed_entry_index,
+			     &number_of_passed_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to complete entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( liblnk_internal_batch_close_entries(
+			     internal_batch,
+			     first_passed_entry_index,
+			     number_of_passed_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close entry: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( internal_batch->abort != 0 )
+			{
+				break;
+			}
+		}
+	}
+	if( internal_batch->worker_failed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process one or more entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_batch->abort != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+on_error:
+	if( thread_pool != NULL )
+	{
+		internal_batch->abort = 1;
+
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+#endif
+}
+
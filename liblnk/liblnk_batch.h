@@ -0,0 +1,280 @@
+/*
+ * Batch functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBLNK_BATCH_H )
+#define _LIBLNK_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "liblnk_extern.h"
+#include "liblnk_libbfio.h"
+#include "liblnk_libcdata.h"
+#include "liblnk_libcerror.h"
+#include "liblnk_libcthreads.h"
+#include "liblnk_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct liblnk_batch_entry liblnk_batch_entry_t;
+
+struct liblnk_batch_entry
+{
+	/* The entry index
+	 */
+	int entry_index;
+
+	/* The filename
+	 */
+	char *filename;
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+	/* The wide filename
+	 */
+	wchar_t *filename_wide;
+#endif
+
+	/* The file IO handle
+	 * The file IO handle is provided by the caller and not freed by the batch
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The file
+	 */
+	liblnk_file_t *file;
+
+	/* The error that occurred when opening the file
+	 */
+	libcerror_error_t *open_error;
+
+	/* Value to indicate the entry has been processed
+	 */
+	uint8_t is_processed;
+};
+
+typedef struct liblnk_internal_batch liblnk_internal_batch_t;
+
+struct liblnk_internal_batch
+{
+	/* The entries array
+	 */
+	libcdata_array_t *entries_array;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The access flags used to open the entries
+	 */
+	int access_flags;
+
+	/* The result order
+	 */
+	int result_order;
+
+	/* The entry function
+	 */
+	int (*entry_function)(
+	       int entry_index,
+	       liblnk_file_t *file,
+	       void *callback_function_arguments );
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       int entry_index,
+	       liblnk_file_t *file,
+	       libcerror_error_t *open_error,
+	       void *callback_function_arguments );
+
+	/* The callback function arguments
+	 */
+	void *callback_function_arguments;
+
+	/* The number of entries being processed
+	 */
+	int number_of_entries;
+
+	/* The index of the next entry to pass to the callback function
+	 * when the results are passed in input order
+	 */
+	int next_entry_index;
+
+	/* The number of entries passed to the callback function
+	 */
+	int number_of_passed_entries;
+
+	/* Value to indicate the callback function requested to abort
+	 */
+	uint8_t abort;
+
+	/* Value to indicate a worker failed
+	 */
+	uint8_t worker_failed;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	/* The callback mutex
+	 */
+	libcthreads_mutex_t *callback_mutex;
+
+	/* The condition that is signalled when an entry was passed to the callback function
+	 */
+	libcthreads_condition_t *passed_condition;
+#endif
+};
+
+int liblnk_batch_entry_initialize(
+     liblnk_batch_entry_t **batch_entry,
+     libcerror_error_t **error );
+
+int liblnk_batch_entry_free(
+     liblnk_batch_entry_t **batch_entry,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_batch_initialize(
+     liblnk_batch_t **batch,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_batch_free(
+     liblnk_batch_t **batch,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_batch_get_number_of_threads(
+     liblnk_batch_t *batch,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_batch_set_number_of_threads(
+     liblnk_batch_t *batch,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_batch_set_entry_function(
+     liblnk_batch_t *batch,
+     int (*entry_function)(
+            int entry_index,
+            liblnk_file_t *file,
+            void *callback_function_arguments ),
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_batch_get_number_of_entries(
+     liblnk_batch_t *batch,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int liblnk_internal_batch_append_entry(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_batch_append_filename(
+     liblnk_batch_t *batch,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBLNK_EXTERN \
+int liblnk_batch_append_filename_wide(
+     liblnk_batch_t *batch,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBLNK_EXTERN \
+int liblnk_batch_append_file_io_handle(
+     liblnk_batch_t *batch,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int liblnk_internal_batch_open_entry(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry,
+     libcerror_error_t **error );
+
+int liblnk_internal_batch_call_entry_function(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry );
+
+int liblnk_internal_batch_pass_entry(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry,
+     libcerror_error_t **error );
+
+int liblnk_internal_batch_close_entry(
+     liblnk_batch_entry_t *batch_entry,
+     libcerror_error_t **error );
+
+int liblnk_internal_batch_close_entries(
+     liblnk_internal_batch_t *internal_batch,
+     int first_entry_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int liblnk_internal_batch_complete_entry(
+     liblnk_internal_batch_t *internal_batch,
+     liblnk_batch_entry_t *batch_entry,
+     int *first_passed_entry_index,
+     int *number_of_passed_entries,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+
+int liblnk_batch_process_entry_worker(
+     liblnk_batch_entry_t *batch_entry,
+     liblnk_internal_batch_t *internal_batch );
+
+int liblnk_internal_batch_wait_for_open_entry(
+     liblnk_internal_batch_t *internal_batch,
+     int entry_index,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT ) */
+
+LIBLNK_EXTERN \
+int liblnk_batch_process(
+     liblnk_batch_t *batch,
+     int access_flags,
+     int result_order,
+     int (*callback_function)(
+            int entry_index,
+            liblnk_file_t *file,
+            libcerror_error_t *open_error,
+            void *callback_function_arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBLNK_BATCH_H ) */
+
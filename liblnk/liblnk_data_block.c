@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "liblnk_data_block.h"
+#include "liblnk_definitions.h"
 #include "liblnk_libbfio.h"
 #include "liblnk_libcerror.h"
 #include "liblnk_libcnotify.h"
@@ -103,6 +104,80 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a data block
+ * The data block is allocated from the arena if set, otherwise it is allocated separately
+ * Make sure the value data_block is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_data_block_initialize_with_arena(
+     liblnk_data_block_t **data_block,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error )
+{
+	liblnk_internal_data_block_t *internal_data_block = NULL;
+	static char *function                             = "liblnk_data_block_initialize_with_arena";
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_block != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data block value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		if( liblnk_data_block_initialize(
+		     data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data block.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( liblnk_arena_allocate(
+	     arena,
+	     sizeof( liblnk_internal_data_block_t ),
+	     (void **) &internal_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_block->is_arena_allocated = 1;
+
+	*data_block = (liblnk_data_block_t *) internal_data_block;
+
+	return( 1 );
+}
+
 /* Frees a data block
  * Returns 1 if successful or -1 on error
  */
@@ -172,14 +247,17 @@ int liblnk_internal_data_block_free(
 				}
 			}
 		}
-		if( ( *internal_data_block )->data != NULL )
+		if( ( ( *internal_data_block )->data != NULL )
+		 && ( ( *internal_data_block )->data_is_borrowed == 0 ) )
 		{
 			memory_free(
-			 ( *internal_data_block )->data );
+			 (uint8_t *) ( *internal_data_block )->data );
+		}
+		if( ( *internal_data_block )->is_arena_allocated == 0 )
+		{
+			memory_free(
+			 *internal_data_block );
 		}
-		memory_free(
-		 *internal_data_block );
-
 		*internal_data_block = NULL;
 	}
 	return( result );
@@ -195,6 +273,7 @@ int liblnk_data_block_set_data(
      libcerror_error_t **error )
 {
 	liblnk_internal_data_block_t *internal_data_block = NULL;
+	uint8_t *block_data                               = NULL;
 	static char *function                             = "liblnk_data_block_set_data";
 
 	if( data_block == NULL )
@@ -232,10 +311,10 @@ int liblnk_data_block_set_data(
 
 		return( -1 );
 	}
-	internal_data_block->data = (uint8_t *) memory_allocate(
-	                                         sizeof( uint8_t ) * data_size );
+	block_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * data_size );
 
-	if( internal_data_block->data == NULL )
+	if( block_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -246,10 +325,8 @@ int liblnk_data_block_set_data(
 
 		goto on_error;
 	}
-	internal_data_block->data_size = data_size;
-
 	if( memory_copy(
-	     internal_data_block->data,
+	     block_data,
 	     data,
 	     data_size ) == NULL )
 	{
@@ -262,15 +339,16 @@ int liblnk_data_block_set_data(
 
 		goto on_error;
 	}
+	internal_data_block->data      = block_data;
+	internal_data_block->data_size = data_size;
+
 	return( 1 );
 
 on_error:
-	if( internal_data_block->data != NULL )
+	if( block_data != NULL )
 	{
 		memory_free(
-		 internal_data_block->data );
-
-		internal_data_block->data = NULL;
+		 block_data );
 	}
 	internal_data_block->size = 0;
 
@@ -366,21 +444,20 @@ int liblnk_data_block_read_data(
 	return( 1 );
 }
 
-/* Reads a data block
- * Returns the number of bytes read if successful or -1 on error
+/* Reads a data block from a buffer
+ * The buffer starts with the 32-bit data block size
+ * Returns 1 if successful or -1 on error
  */
-int liblnk_data_block_read_file_io_handle(
+int liblnk_data_block_read_buffer(
      liblnk_data_block_t *data_block,
      liblnk_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
+     const uint8_t *buffer,
+     size_t buffer_size,
      libcerror_error_t **error )
 {
-	uint8_t data_block_size_data[ 4 ];
-
 	liblnk_internal_data_block_t *internal_data_block = NULL;
-	static char *function                             = "liblnk_data_block_read_file_io_handle";
-	ssize_t read_count                                = 0;
+	uint8_t *block_data                               = NULL;
+	static char *function                             = "liblnk_data_block_read_buffer";
 
 	if( data_block == NULL )
 	{
@@ -417,38 +494,31 @@ int liblnk_data_block_read_file_io_handle(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( buffer == NULL )
 	{
-		libcnotify_printf(
-		 "%s: reading data block at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 file_offset,
-		 file_offset );
-	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-		      file_io_handle,
-		      data_block_size_data,
-		      4,
-		      file_offset,
-		      error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-	if( read_count != (ssize_t) 4 )
+		return( -1 );
+	}
+	if( ( buffer_size < 4 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read data block size at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	byte_stream_copy_to_uint32_little_endian(
-	 data_block_size_data,
+	 buffer,
 	 internal_data_block->size );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -474,49 +544,55 @@ int liblnk_data_block_read_file_io_handle(
 
 			goto on_error;
 		}
-		internal_data_block->data_size = internal_data_block->size - 4;
-
-		internal_data_block->data = (uint8_t *) memory_allocate(
-		                                         sizeof( uint8_t ) * internal_data_block->data_size );
-
-		if( internal_data_block->data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create data block data.",
-			 function );
-
-			goto on_error;
-		}
-		if( (off64_t) internal_data_block->size > (off64_t) ( io_handle->file_size - file_offset ) )
+		if( (size_t) internal_data_block->size > buffer_size )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid data block size value exceeds file size.",
+			 "%s: invalid data block size value exceeds buffer size.",
 			 function );
 
 			goto on_error;
 		}
-		read_count = libbfio_handle_read_buffer(
-			      file_io_handle,
-			      internal_data_block->data,
-			      internal_data_block->data_size,
-			      error );
+		internal_data_block->data_size = internal_data_block->size - 4;
 
-		if( read_count != (ssize_t) internal_data_block->data_size )
+		if( ( io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read data block data.",
-			 function );
+			internal_data_block->data             = &( buffer[ 4 ] );
+			internal_data_block->data_is_borrowed = 1;
+		}
+		else
+		{
+			block_data = (uint8_t *) memory_allocate(
+			                          sizeof( uint8_t ) * internal_data_block->data_size );
 
-			goto on_error;
+			if( block_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create data block data.",
+				 function );
+
+				goto on_error;
+			}
+			if( memory_copy(
+			     block_data,
+			     &( buffer[ 4 ] ),
+			     (size_t) internal_data_block->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data block data.",
+				 function );
+
+				goto on_error;
+			}
+			internal_data_block->data = block_data;
 		}
 		if( liblnk_data_block_read_data(
 		     data_block,
@@ -539,27 +615,32 @@ int liblnk_data_block_read_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( internal_data_block->data != NULL )
+	if( block_data != NULL )
 	{
 		memory_free(
-		 internal_data_block->data );
-
-		internal_data_block->data = NULL;
+		 block_data );
 	}
+	internal_data_block->data             = NULL;
+	internal_data_block->data_is_borrowed = 0;
 	internal_data_block->size = 0;
 
 	return( -1 );
 }
 
-/* Retrieves the size
+/* Reads the data block size
  * Returns 1 if successful or -1 on error
  */
-int liblnk_internal_data_block_get_size(
+int liblnk_internal_data_block_read_size_file_io_handle(
      liblnk_internal_data_block_t *internal_data_block,
-     uint32_t *size,
+     liblnk_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
      libcerror_error_t **error )
 {
-	static char *function = "liblnk_internal_data_block_get_size";
+	uint8_t data_block_size_data[ 4 ];
+
+	static char *function = "liblnk_internal_data_block_read_size_file_io_handle";
+	ssize_t read_count    = 0;
 
 	if( internal_data_block == NULL )
 	{
@@ -572,32 +653,115 @@ int liblnk_internal_data_block_get_size(
 
 		return( -1 );
 	}
-	if( size == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	*size = internal_data_block->size;
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading data block at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 file_offset,
+		 file_offset );
+	}
+#endif
+	read_count = liblnk_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              data_block_size_data,
+	              4,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block size at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 data_block_size_data,
+	 internal_data_block->size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data block size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 internal_data_block->size );
+	}
+#endif
+	if( internal_data_block->size > 0 )
+	{
+		if( ( internal_data_block->size < 8 )
+		 || ( internal_data_block->size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE + 4 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data block size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( (off64_t) internal_data_block->size > (off64_t) ( io_handle->file_size - file_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data block size value exceeds file size.",
+			 function );
+
+			goto on_error;
+		}
+		internal_data_block->data_size = internal_data_block->size - 4;
+	}
+	internal_data_block->file_offset    = file_offset;
+	internal_data_block->ascii_codepage = io_handle->ascii_codepage;
 
 	return( 1 );
+
+on_error:
+	internal_data_block->size = 0;
+
+	return( -1 );
 }
 
-/* Retrieves the signature
+/* Reads a data block
  * Returns 1 if successful or -1 on error
  */
-int liblnk_data_block_get_signature(
+int liblnk_data_block_read_file_io_handle(
      liblnk_data_block_t *data_block,
-     uint32_t *signature,
+     liblnk_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
      libcerror_error_t **error )
 {
 	liblnk_internal_data_block_t *internal_data_block = NULL;
-	static char *function                             = "liblnk_data_block_get_signature";
+	uint8_t *block_data                               = NULL;
+	const uint8_t *data                               = NULL;
+	static char *function                             = "liblnk_data_block_read_file_io_handle";
+	ssize_t read_count                                = 0;
+	int result                                        = 0;
 
 	if( data_block == NULL )
 	{
@@ -612,34 +776,493 @@ int liblnk_data_block_get_signature(
 	}
 	internal_data_block = (liblnk_internal_data_block_t *) data_block;
 
-	if( internal_data_block->data_size < 4 )
+	if( internal_data_block->data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data block - data size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data block - data already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( signature == NULL )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid signature.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	*signature = internal_data_block->signature;
-
-	return( 1 );
-}
+	/* When the file is parsed from memory the data block is read from the file data
+	 */
+	result = liblnk_io_handle_get_data_at_offset(
+	          io_handle,
+	          file_offset,
+	          4,
+	          &data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
 
-/* Retrieves the data block data size
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( liblnk_data_block_read_buffer(
+		     data_block,
+		     io_handle,
+		     data,
+		     io_handle->data_size - (size_t) file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block.",
+			 function );
+
+			return( -1 );
+		}
+		internal_data_block->file_offset = file_offset;
+
+		return( 1 );
+	}
+	if( liblnk_internal_data_block_read_size_file_io_handle(
+	     internal_data_block,
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block size.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_data_block->size > 0 )
+	{
+		block_data = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * internal_data_block->data_size );
+
+		if( block_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data block data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = liblnk_io_handle_read_buffer(
+		              io_handle,
+		              file_io_handle,
+		              block_data,
+		              internal_data_block->data_size,
+		              error );
+
+		if( read_count != (ssize_t) internal_data_block->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block data.",
+			 function );
+
+			goto on_error;
+		}
+		internal_data_block->data = block_data;
+
+		if( liblnk_data_block_read_data(
+		     data_block,
+		     internal_data_block->data,
+		     internal_data_block->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( block_data != NULL )
+	{
+		memory_free(
+		 block_data );
+	}
+	internal_data_block->data = NULL;
+	internal_data_block->size = 0;
+
+	return( -1 );
+}
+
+/* Reads the data block size and signature
+ * The data itself is read by liblnk_data_block_read_data_file_io_handle
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_data_block_read_header_file_io_handle(
+     liblnk_data_block_t *data_block,
+     liblnk_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t data_block_signature_data[ 4 ];
+
+	liblnk_internal_data_block_t *internal_data_block = NULL;
+	static char *function                             = "liblnk_data_block_read_header_file_io_handle";
+	ssize_t read_count                                = 0;
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_block = (liblnk_internal_data_block_t *) data_block;
+
+	if( internal_data_block->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data block - data already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_internal_data_block_read_size_file_io_handle(
+	     internal_data_block,
+	     io_handle,
+	     file_io_handle,
+	     file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block size.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_data_block->size > 0 )
+	{
+		read_count = liblnk_io_handle_read_buffer(
+		              io_handle,
+		              file_io_handle,
+		              data_block_signature_data,
+		              4,
+		              error );
+
+		if( read_count != (ssize_t) 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block signature.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 data_block_signature_data,
+		 internal_data_block->signature );
+	}
+	return( 1 );
+
+on_error:
+	internal_data_block->size = 0;
+
+	return( -1 );
+}
+
+/* Reads the data block data
+ * The size and signature must have been read by liblnk_data_block_read_header_file_io_handle
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_data_block_read_data_file_io_handle(
+     liblnk_data_block_t *data_block,
+     liblnk_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	liblnk_internal_data_block_t *internal_data_block = NULL;
+	uint8_t *block_data                               = NULL;
+	const uint8_t *data                               = NULL;
+	static char *function                             = "liblnk_data_block_read_data_file_io_handle";
+	ssize_t read_count                                = 0;
+	int result                                        = 0;
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_block = (liblnk_internal_data_block_t *) data_block;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_data_block->size == 0 )
+	 || ( internal_data_block->data != NULL ) )
+	{
+		return( 1 );
+	}
+	/* When the file is parsed from memory the data is not read into a separate buffer
+	 */
+	result = liblnk_io_handle_get_data_at_offset(
+	          io_handle,
+	          internal_data_block->file_offset + 4,
+	          internal_data_block->data_size,
+	          &data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_data_block->file_offset + 4,
+		 internal_data_block->file_offset + 4 );
+
+		goto on_error;
+	}
+	else if( ( result != 0 )
+	      && ( ( io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED ) != 0 ) )
+	{
+		internal_data_block->data             = data;
+		internal_data_block->data_is_borrowed = 1;
+	}
+	else
+	{
+		block_data = (uint8_t *) memory_allocate(
+		                          sizeof( uint8_t ) * internal_data_block->data_size );
+
+		if( block_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data block data.",
+			 function );
+
+			goto on_error;
+		}
+		if( result != 0 )
+		{
+			if( memory_copy(
+			     block_data,
+			     data,
+			     internal_data_block->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data block data.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			read_count = liblnk_io_handle_read_buffer_at_offset(
+			              io_handle,
+			              file_io_handle,
+			              block_data,
+			              internal_data_block->data_size,
+			              internal_data_block->file_offset + 4,
+			              error );
+
+			if( read_count != (ssize_t) internal_data_block->data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data block data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 internal_data_block->file_offset + 4,
+				 internal_data_block->file_offset + 4 );
+
+				goto on_error;
+			}
+		}
+		internal_data_block->data = block_data;
+	}
+	if( liblnk_data_block_read_data(
+	     data_block,
+	     internal_data_block->data,
+	     internal_data_block->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( block_data != NULL )
+	{
+		memory_free(
+		 block_data );
+	}
+	internal_data_block->data             = NULL;
+	internal_data_block->data_is_borrowed = 0;
+	return( -1 );
+}
+
+/* Retrieves the size
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_data_block_get_size(
+     liblnk_internal_data_block_t *internal_data_block,
+     uint32_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_internal_data_block_get_size";
+
+	if( internal_data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*size = internal_data_block->size;
+
+	return( 1 );
+}
+
+/* Retrieves the signature
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_data_block_get_signature(
+     liblnk_data_block_t *data_block,
+     uint32_t *signature,
+     libcerror_error_t **error )
+{
+	liblnk_internal_data_block_t *internal_data_block = NULL;
+	static char *function                             = "liblnk_data_block_get_signature";
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_block = (liblnk_internal_data_block_t *) data_block;
+
+	if( internal_data_block->data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data block - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	*signature = internal_data_block->signature;
+
+	return( 1 );
+}
+
+/* Retrieves the data block data size
  * Returns 1 if successful or -1 on error
  */
 int liblnk_data_block_get_data_size(
@@ -690,6 +1313,73 @@ int liblnk_data_block_get_data_size(
 	return( 1 );
 }
 
+/* Retrieves the data block data
+ * The data references the data of the data block without copying it and is valid
+ * as long as the data block, and the file it was retrieved from, are not freed or closed
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_data_block_get_data(
+     liblnk_data_block_t *data_block,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	liblnk_internal_data_block_t *internal_data_block = NULL;
+	static char *function                             = "liblnk_data_block_get_data";
+
+	if( data_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	internal_data_block = (liblnk_internal_data_block_t *) data_block;
+
+	if( ( internal_data_block->data == NULL )
+	 || ( internal_data_block->data_size < 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data block - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = &( internal_data_block->data[ 4 ] );
+	*data_size = (size_t) internal_data_block->data_size - 4;
+
+	return( 1 );
+}
+
 /* Copies the data block data to the buffer
  * Returns 1 if successful or -1 on error
  */
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "liblnk_arena.h"
 #include "liblnk_extern.h"
 #include "liblnk_io_handle.h"
 #include "liblnk_libcerror.h"
@@ -55,12 +56,24 @@ struct liblnk_internal_data_block
 
 	/* The data
 	 */
-	uint8_t *data;
+	const uint8_t *data;
 
 	/* The data size
 	 */
 	uint32_t data_size;
 
+	/* Value to indicate the data references a caller provided buffer
+	 */
+	uint8_t data_is_borrowed;
+
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* Value to indicate the values have been read
+	 */
+	uint8_t values_read;
+
 	/* The item value
 	 */
 	intptr_t *value;
@@ -74,12 +87,21 @@ struct liblnk_internal_data_block
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
+
+	/* Value to indicate the structure is allocated from an arena
+	 */
+	uint8_t is_arena_allocated;
 };
 
 int liblnk_data_block_initialize(
      liblnk_data_block_t **data_block,
      libcerror_error_t **error );
 
+int liblnk_data_block_initialize_with_arena(
+     liblnk_data_block_t **data_block,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBLNK_EXTERN \
 int liblnk_data_block_free(
      liblnk_data_block_t **data_block,
@@ -101,6 +123,20 @@ int liblnk_data_block_read_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int liblnk_data_block_read_buffer(
+     liblnk_data_block_t *data_block,
+     liblnk_io_handle_t *io_handle,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int liblnk_internal_data_block_read_size_file_io_handle(
+     liblnk_internal_data_block_t *internal_data_block,
+     liblnk_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
 int liblnk_data_block_read_file_io_handle(
      liblnk_data_block_t *data_block,
      liblnk_io_handle_t *io_handle,
@@ -108,6 +144,19 @@ int liblnk_data_block_read_file_io_handle(
      off64_t file_offset,
      libcerror_error_t **error );
 
+int liblnk_data_block_read_header_file_io_handle(
+     liblnk_data_block_t *data_block,
+     liblnk_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int liblnk_data_block_read_data_file_io_handle(
+     liblnk_data_block_t *data_block,
+     liblnk_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 int liblnk_internal_data_block_get_size(
      liblnk_internal_data_block_t *internal_data_block,
      uint32_t *size,
@@ -125,6 +174,13 @@ int liblnk_data_block_get_data_size(
      size_t *data_size,
      libcerror_error_t **error );
 
+LIBLNK_EXTERN \
+int liblnk_data_block_get_data(
+     liblnk_data_block_t *data_block,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 LIBLNK_EXTERN \
 int liblnk_data_block_copy_data(
      liblnk_data_block_t *data_block,
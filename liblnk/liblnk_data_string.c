@@ -34,6 +34,7 @@
 #include "liblnk_libcerror.h"
 #include "liblnk_libcnotify.h"
 #include "liblnk_libuna.h"
+#include "liblnk_utf8_string.h"
 
 /* Creates a data string
  * Make sure the value data_string is referencing, is set to NULL
@@ -108,6 +109,77 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a data string
+ * The data string is allocated from the arena if set, otherwise it is allocated separately
+ * Make sure the value data_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_data_string_initialize_with_arena(
+     liblnk_data_string_t **data_string,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_data_string_initialize_with_arena";
+
+	if( data_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		if( liblnk_data_string_initialize(
+		     data_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( liblnk_arena_allocate(
+	     arena,
+	     sizeof( liblnk_data_string_t ),
+	     (void **) data_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data string.",
+		 function );
+
+		return( -1 );
+	}
+	( *data_string )->is_arena_allocated = 1;
+
+	return( 1 );
+}
+
 /* Frees a data string
  * Returns 1 if successful or -1 on error
  */
@@ -116,6 +188,7 @@ int liblnk_data_string_free(
      libcerror_error_t **error )
 {
 	static char *function = "liblnk_data_string_free";
+	int result            = 1;
 
 	if( data_string == NULL )
 	{
@@ -130,16 +203,86 @@ int liblnk_data_string_free(
 	}
 	if( *data_string != NULL )
 	{
-		if( ( *data_string )->data != NULL )
+		if( liblnk_data_string_clear(
+		     *data_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear data string.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *data_string )->is_arena_allocated == 0 )
 		{
 			memory_free(
-			 ( *data_string )->data );
+			 *data_string );
 		}
+		*data_string = NULL;
+	}
+	return( result );
+}
+
+/* Clears a data string
+ * Frees the data if it is not borrowed and the cached strings
+ * this is also used for a data string that is not allocated on the heap
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_data_string_clear(
+     liblnk_data_string_t *data_string,
+     libcerror_error_t **error )
+{
+	static char *function      = "liblnk_data_string_clear";
+	uint8_t is_arena_allocated = 0;
+
+	if( data_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data string.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_string->cached_utf8_string != NULL )
+	{
 		memory_free(
-		 *data_string );
+		 data_string->cached_utf8_string );
+	}
+	if( data_string->cached_utf16_string != NULL )
+	{
+		memory_free(
+		 data_string->cached_utf16_string );
+	}
+	if( ( data_string->data != NULL )
+	 && ( data_string->data_is_borrowed == 0 ) )
+	{
+		memory_free(
+		 (uint8_t *) data_string->data );
+	}
+	is_arena_allocated = data_string->is_arena_allocated;
 
-		*data_string = NULL;
+	if( memory_set(
+	     data_string,
+	     0,
+	     sizeof( liblnk_data_string_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data string.",
+		 function );
+
+		return( -1 );
 	}
+	data_string->is_arena_allocated = is_arena_allocated;
+
 	return( 1 );
 }
 
@@ -154,6 +297,7 @@ int liblnk_data_string_read_data(
      uint32_t encoding_flags,
      libcerror_error_t **error )
 {
+	uint8_t *string_data  = NULL;
 	static char *function = "liblnk_data_string_read_data";
 
 	if( data_string == NULL )
@@ -274,44 +418,42 @@ int liblnk_data_string_read_data(
 
 			goto on_error;
 		}
-		data_string->data = (uint8_t *) memory_allocate(
-		                                 sizeof( uint8_t ) * data_string->data_size );
-
-		if( data_string->data == NULL )
+		if( ( io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create data string data.",
-			 function );
-
-			goto on_error;
+			data_string->data             = &( data[ 2 ] );
+			data_string->data_is_borrowed = 1;
 		}
-		if( memory_copy(
-		     data_string->data,
-		     &( data[ 2 ] ),
-		     data_string->data_size ) == NULL )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy data string data.",
-			 function );
+			string_data = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * data_string->data_size );
 
-			goto on_error;
-		}
-		if( data_string->data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create data string data.",
-			 function );
+			if( string_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create data string data.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( memory_copy(
+			     string_data,
+			     &( data[ 2 ] ),
+			     data_string->data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data string data.",
+				 function );
+
+				goto on_error;
+			}
+			data_string->data = string_data;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -376,13 +518,14 @@ int liblnk_data_string_read_data(
 	return( 1 );
 
 on_error:
-	if( data_string->data != NULL )
+	if( string_data != NULL )
 	{
 		memory_free(
-		 data_string->data );
-
-		data_string->data = NULL;
+		 string_data );
 	}
+	data_string->data             = NULL;
+	data_string->data_is_borrowed = 0;
+
 	return( -1 );
 }
 
@@ -399,8 +542,11 @@ int liblnk_data_string_read_file_io_handle(
 {
 	uint8_t data_string_size_data[ 2 ];
 
+	const uint8_t *data   = NULL;
+	uint8_t *string_data  = NULL;
 	static char *function = "liblnk_data_string_read_file_io_handle";
 	ssize_t read_count    = 0;
+	int result            = 0;
 
 	if( data_string == NULL )
 	{
@@ -435,6 +581,49 @@ int liblnk_data_string_read_file_io_handle(
 
 		return( -1 );
 	}
+	/* When the file is parsed from memory the data string is read from the file data
+	 */
+	result = liblnk_io_handle_get_data_at_offset(
+	          io_handle,
+	          file_offset,
+	          2,
+	          &data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data string data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( liblnk_data_string_read_data(
+		     data_string,
+		     io_handle,
+		     data,
+		     io_handle->data_size - (size_t) file_offset,
+		     encoding_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	/* Store is unicode value for internal use
 	 */
 	data_string->is_unicode = io_handle->is_unicode;
@@ -449,7 +638,8 @@ int liblnk_data_string_read_file_io_handle(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = liblnk_io_handle_read_buffer_at_offset(
+	              io_handle,
 	              file_io_handle,
 	              data_string_size_data,
 	              2,
@@ -502,10 +692,10 @@ int liblnk_data_string_read_file_io_handle(
 
 			goto on_error;
 		}
-		data_string->data = (uint8_t *) memory_allocate(
-		                                 sizeof( uint8_t ) * data_string->data_size );
+		string_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * data_string->data_size );
 
-		if( data_string->data == NULL )
+		if( string_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -516,96 +706,465 @@ int liblnk_data_string_read_file_io_handle(
 
 			goto on_error;
 		}
-		read_count = libbfio_handle_read_buffer(
-		              file_io_handle,
-		              data_string->data,
-		              data_string->data_size,
-		              error );
-
-		if( read_count != (ssize_t) data_string->data_size )
+		read_count = liblnk_io_handle_read_buffer(
+		              io_handle,
+		              file_io_handle,
+		              string_data,
+		              data_string->data_size,
+		              error );
+
+		if( read_count != (ssize_t) data_string->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data string data.",
+			 function );
+
+			goto on_error;
+		}
+		data_string->data = string_data;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: data string data:\n",
+			 function );
+			libcnotify_print_data(
+			 data_string->data,
+			 data_string->data_size,
+			 0 );
+		}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( data_string->is_unicode != 0 )
+			{
+				if( liblnk_debug_print_utf16_string_value(
+				     function,
+				     "data string\t\t\t",
+				     data_string->data,
+				     data_string->data_size,
+				     LIBUNA_ENDIAN_LITTLE | encoding_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print UTF-16 string value.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				if( liblnk_debug_print_string_value(
+				     function,
+				     "data string\t\t\t",
+				     data_string->data,
+				     data_string->data_size,
+				     io_handle->ascii_codepage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print string value.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	}
+	return( 1 );
+
+on_error:
+	if( string_data != NULL )
+	{
+		memory_free(
+		 string_data );
+	}
+	data_string->data = NULL;
+
+	return( -1 );
+}
+
+/* Determines if the data string has a cached string for the specified conversion
+ * Returns 1 if cached or 0 if not
+ */
+int liblnk_data_string_has_cached_string(
+     liblnk_data_string_t *data_string,
+     int ascii_codepage,
+     int string_format,
+     uint8_t is_path )
+{
+	if( data_string == NULL )
+	{
+		return( 0 );
+	}
+	if( string_format == LIBLNK_DATA_STRING_FORMAT_UTF8 )
+	{
+		if( data_string->cached_utf8_string == NULL )
+		{
+			return( 0 );
+		}
+		/* The codepage only applies to byte stream strings
+		 * and path strings only differ for Unicode strings
+		 */
+		if( data_string->is_unicode != 0 )
+		{
+			if( data_string->cached_utf8_string_is_path != is_path )
+			{
+				return( 0 );
+			}
+		}
+		else if( data_string->cached_utf8_string_codepage != ascii_codepage )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	else if( string_format == LIBLNK_DATA_STRING_FORMAT_UTF16 )
+	{
+		if( data_string->cached_utf16_string == NULL )
+		{
+			return( 0 );
+		}
+		if( data_string->is_unicode != 0 )
+		{
+			if( data_string->cached_utf16_string_is_path != is_path )
+			{
+				return( 0 );
+			}
+		}
+		else if( data_string->cached_utf16_string_codepage != ascii_codepage )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Converts the data string and caches the result for the specified conversion
+ * A previously cached string of the same format is replaced
+ * Returns 1 if successful, 0 if the data string has no data or -1 on error
+ */
+int liblnk_data_string_cache_string(
+     liblnk_data_string_t *data_string,
+     int ascii_codepage,
+     int string_format,
+     uint8_t is_path,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string     = NULL;
+	uint16_t *utf16_string   = NULL;
+	static char *function    = "liblnk_data_string_cache_string";
+	size_t utf8_string_size  = 0;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	if( data_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_format != LIBLNK_DATA_STRING_FORMAT_UTF8 )
+	 && ( string_format != LIBLNK_DATA_STRING_FORMAT_UTF16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_string->data == NULL )
+	{
+		return( 0 );
+	}
+	if( liblnk_data_string_has_cached_string(
+	     data_string,
+	     ascii_codepage,
+	     string_format,
+	     is_path ) != 0 )
+	{
+		return( 1 );
+	}
+	if( string_format == LIBLNK_DATA_STRING_FORMAT_UTF8 )
+	{
+		if( is_path != 0 )
+		{
+			result = liblnk_data_string_get_utf8_path_string_size(
+			          data_string,
+			          ascii_codepage,
+			          &utf8_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_data_string_get_utf8_string_size(
+			          data_string,
+			          ascii_codepage,
+			          &utf8_string_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( is_path != 0 )
+		{
+			result = liblnk_data_string_get_utf8_path_string(
+			          data_string,
+			          ascii_codepage,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_data_string_get_utf8_string(
+			          data_string,
+			          ascii_codepage,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( data_string->cached_utf8_string != NULL )
+		{
+			memory_free(
+			 data_string->cached_utf8_string );
+
+			data_string->cached_utf8_string = NULL;
+		}
+		data_string->cached_utf8_string_size     = utf8_string_size;
+		data_string->cached_utf8_string_codepage = ascii_codepage;
+		data_string->cached_utf8_string_is_path  = is_path;
+
+		/* The string is set last so that it is completely filled in
+		 * before it is used to determine the data string has a cached string
+		 */
+		data_string->cached_utf8_string = utf8_string;
+	}
+	else
+	{
+		if( is_path != 0 )
+		{
+			result = liblnk_data_string_get_utf16_path_string_size(
+			          data_string,
+			          ascii_codepage,
+			          &utf16_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_data_string_get_utf16_string_size(
+			          data_string,
+			          ascii_codepage,
+			          &utf16_string_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( utf16_string_size == 0 )
+		 || ( utf16_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-16 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf16_string = (uint16_t *) memory_allocate(
+		                             sizeof( uint16_t ) * utf16_string_size );
+
+		if( utf16_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( is_path != 0 )
+		{
+			result = liblnk_data_string_get_utf16_path_string(
+			          data_string,
+			          ascii_codepage,
+			          utf16_string,
+			          utf16_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_data_string_get_utf16_string(
+			          data_string,
+			          ascii_codepage,
+			          utf16_string,
+			          utf16_string_size,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read data string data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: data string data:\n",
-			 function );
-			libcnotify_print_data(
-			 data_string->data,
-			 data_string->data_size,
-			 0 );
-		}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( data_string->cached_utf16_string != NULL )
 		{
-			if( data_string->is_unicode != 0 )
-			{
-				if( liblnk_debug_print_utf16_string_value(
-				     function,
-				     "data string\t\t\t",
-				     data_string->data,
-				     data_string->data_size,
-				     LIBUNA_ENDIAN_LITTLE | encoding_flags,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-					 "%s: unable to print UTF-16 string value.",
-					 function );
-
-					goto on_error;
-				}
-			}
-			else
-			{
-				if( liblnk_debug_print_string_value(
-				     function,
-				     "data string\t\t\t",
-				     data_string->data,
-				     data_string->data_size,
-				     io_handle->ascii_codepage,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-					 "%s: unable to print string value.",
-					 function );
+			memory_free(
+			 data_string->cached_utf16_string );
 
-					goto on_error;
-				}
-			}
-			libcnotify_printf(
-			 "\n" );
+			data_string->cached_utf16_string = NULL;
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		data_string->cached_utf16_string_size     = utf16_string_size;
+		data_string->cached_utf16_string_codepage = ascii_codepage;
+		data_string->cached_utf16_string_is_path  = is_path;
+
+		/* The string is set last so that it is completely filled in
+		 * before it is used to determine the data string has a cached string
+		 */
+		data_string->cached_utf16_string = utf16_string;
 	}
 	return( 1 );
 
 on_error:
-	if( data_string->data != NULL )
+	if( utf16_string != NULL )
 	{
 		memory_free(
-		 data_string->data );
-
-		data_string->data = NULL;
+		 utf16_string );
+	}
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
 	}
 	return( -1 );
 }
 
+/* Clears the cached strings
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_data_string_clear_cache(
+     liblnk_data_string_t *data_string,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_data_string_clear_cache";
+
+	if( data_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data string.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_string->cached_utf8_string != NULL )
+	{
+		memory_free(
+		 data_string->cached_utf8_string );
+
+		data_string->cached_utf8_string = NULL;
+	}
+	if( data_string->cached_utf16_string != NULL )
+	{
+		memory_free(
+		 data_string->cached_utf16_string );
+
+		data_string->cached_utf16_string = NULL;
+	}
+	data_string->cached_utf8_string_size  = 0;
+	data_string->cached_utf16_string_size = 0;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded string
  * The size includes the end of string character
  * Returns 1 if successful, 0 if value is not available or -1 on error
@@ -652,9 +1211,19 @@ int liblnk_data_string_get_utf8_string_size(
 
 		return( -1 );
 	}
+	if( liblnk_data_string_has_cached_string(
+	     data_string,
+	     ascii_codepage,
+	     LIBLNK_DATA_STRING_FORMAT_UTF8,
+	     0 ) != 0 )
+	{
+		*utf8_string_size = data_string->cached_utf8_string_size;
+
+		return( 1 );
+	}
 	if( data_string->is_unicode != 0 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = liblnk_utf8_string_size_from_utf16_stream(
 			  data_string->data,
 			  data_string->data_size,
 			  LIBUNA_ENDIAN_LITTLE,
@@ -742,9 +1311,42 @@ int liblnk_data_string_get_utf8_string(
 
 		return( -1 );
 	}
+	if( liblnk_data_string_has_cached_string(
+	     data_string,
+	     ascii_codepage,
+	     LIBLNK_DATA_STRING_FORMAT_UTF8,
+	     0 ) != 0 )
+	{
+		if( utf8_string_size < data_string->cached_utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     data_string->cached_utf8_string,
+		     sizeof( uint8_t ) * data_string->cached_utf8_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	if( data_string->is_unicode != 0 )
 	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
+		result = liblnk_utf8_string_copy_from_utf16_stream(
 			  utf8_string,
 			  utf8_string_size,
 			  data_string->data,
@@ -822,6 +1424,16 @@ int liblnk_data_string_get_utf16_string_size(
 
 		return( -1 );
 	}
+	if( liblnk_data_string_has_cached_string(
+	     data_string,
+	     ascii_codepage,
+	     LIBLNK_DATA_STRING_FORMAT_UTF16,
+	     0 ) != 0 )
+	{
+		*utf16_string_size = data_string->cached_utf16_string_size;
+
+		return( 1 );
+	}
 	if( data_string->is_unicode != 0 )
 	{
 		result = libuna_utf16_string_size_from_utf16_stream(
@@ -912,6 +1524,39 @@ int liblnk_data_string_get_utf16_string(
 
 		return( -1 );
 	}
+	if( liblnk_data_string_has_cached_string(
+	     data_string,
+	     ascii_codepage,
+	     LIBLNK_DATA_STRING_FORMAT_UTF16,
+	     0 ) != 0 )
+	{
+		if( utf16_string_size < data_string->cached_utf16_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-16 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf16_string,
+		     data_string->cached_utf16_string,
+		     sizeof( uint16_t ) * data_string->cached_utf16_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	if( data_string->is_unicode != 0 )
 	{
 		result = libuna_utf16_string_copy_from_utf16_stream(
@@ -993,9 +1638,19 @@ int liblnk_data_string_get_utf8_path_string_size(
 
 		return( -1 );
 	}
+	if( liblnk_data_string_has_cached_string(
+	     data_string,
+	     ascii_codepage,
+	     LIBLNK_DATA_STRING_FORMAT_UTF8,
+	     1 ) != 0 )
+	{
+		*utf8_string_size = data_string->cached_utf8_string_size;
+
+		return( 1 );
+	}
 	if( data_string->is_unicode != 0 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = liblnk_utf8_string_size_from_utf16_stream(
 			  data_string->data,
 			  data_string->data_size,
 			  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
@@ -1038,6 +1693,46 @@ int liblnk_data_string_get_utf8_path_string(
      libcerror_error_t **error )
 {
 	static char *function = "liblnk_data_string_get_utf8_path_string";
+	size_t string_index   = 0;
+	int result            = 0;
+
+	result = liblnk_data_string_get_utf8_path_string_with_index(
+	          data_string,
+	          ascii_codepage,
+	          utf8_string,
+	          utf8_string_size,
+	          &string_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 path string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded path string
+ * This function uses UTF-8 RFC 2279 (or 6-byte UTF-8) to support characters outside Unicode
+ * The size should include the end of string character
+ * The string is copied at the string index, which is set to the index after the end of string character
+ * Returns 1 if successful, 0 if value is not available or -1 on error
+ */
+int liblnk_data_string_get_utf8_path_string_with_index(
+     liblnk_data_string_t *data_string,
+     int ascii_codepage,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_data_string_get_utf8_path_string_with_index";
 	int result            = 0;
 
 	if( data_string == NULL )
@@ -1084,11 +1779,59 @@ int liblnk_data_string_get_utf8_path_string(
 
 		return( -1 );
 	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_data_string_has_cached_string(
+	     data_string,
+	     ascii_codepage,
+	     LIBLNK_DATA_STRING_FORMAT_UTF8,
+	     1 ) != 0 )
+	{
+		if( ( *utf8_string_index > utf8_string_size )
+		 || ( ( utf8_string_size - *utf8_string_index ) < data_string->cached_utf8_string_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( utf8_string[ *utf8_string_index ] ),
+		     data_string->cached_utf8_string,
+		     sizeof( uint8_t ) * data_string->cached_utf8_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		*utf8_string_index += data_string->cached_utf8_string_size;
+
+		return( 1 );
+	}
 	if( data_string->is_unicode != 0 )
 	{
-		result = libuna_utf8_string_copy_from_utf16_stream(
+		result = liblnk_utf8_string_with_index_copy_from_utf16_stream(
 			  utf8_string,
 			  utf8_string_size,
+			  utf8_string_index,
 			  data_string->data,
 			  data_string->data_size,
 			  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
@@ -1096,9 +1839,10 @@ int liblnk_data_string_get_utf8_path_string(
 	}
 	else
 	{
-		result = libuna_utf8_string_copy_from_byte_stream(
+		result = libuna_utf8_string_with_index_copy_from_byte_stream(
 			  utf8_string,
 			  utf8_string_size,
+			  utf8_string_index,
 			  data_string->data,
 			  data_string->data_size,
 			  ascii_codepage,
@@ -1165,6 +1909,16 @@ int liblnk_data_string_get_utf16_path_string_size(
 
 		return( -1 );
 	}
+	if( liblnk_data_string_has_cached_string(
+	     data_string,
+	     ascii_codepage,
+	     LIBLNK_DATA_STRING_FORMAT_UTF16,
+	     1 ) != 0 )
+	{
+		*utf16_string_size = data_string->cached_utf16_string_size;
+
+		return( 1 );
+	}
 	if( data_string->is_unicode != 0 )
 	{
 		result = libuna_utf16_string_size_from_utf16_stream(
@@ -1210,6 +1964,46 @@ int liblnk_data_string_get_utf16_path_string(
      libcerror_error_t **error )
 {
 	static char *function = "liblnk_data_string_get_utf16_path_string";
+	size_t string_index   = 0;
+	int result            = 0;
+
+	result = liblnk_data_string_get_utf16_path_string_with_index(
+	          data_string,
+	          ascii_codepage,
+	          utf16_string,
+	          utf16_string_size,
+	          &string_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 path string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded path string
+ * This function uses UCS-2 (with surrogates) to support characters outside Unicode
+ * The size should include the end of string character
+ * The string is copied at the string index, which is set to the index after the end of string character
+ * Returns 1 if successful, 0 if value is not available or -1 on error
+ */
+int liblnk_data_string_get_utf16_path_string_with_index(
+     liblnk_data_string_t *data_string,
+     int ascii_codepage,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_data_string_get_utf16_path_string_with_index";
 	int result            = 0;
 
 	if( data_string == NULL )
@@ -1256,11 +2050,59 @@ int liblnk_data_string_get_utf16_path_string(
 
 		return( -1 );
 	}
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_data_string_has_cached_string(
+	     data_string,
+	     ascii_codepage,
+	     LIBLNK_DATA_STRING_FORMAT_UTF16,
+	     1 ) != 0 )
+	{
+		if( ( *utf16_string_index > utf16_string_size )
+		 || ( ( utf16_string_size - *utf16_string_index ) < data_string->cached_utf16_string_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-16 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     &( utf16_string[ *utf16_string_index ] ),
+		     data_string->cached_utf16_string,
+		     sizeof( uint16_t ) * data_string->cached_utf16_string_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		*utf16_string_index += data_string->cached_utf16_string_size;
+
+		return( 1 );
+	}
 	if( data_string->is_unicode != 0 )
 	{
-		result = libuna_utf16_string_copy_from_utf16_stream(
+		result = libuna_utf16_string_with_index_copy_from_utf16_stream(
 			  utf16_string,
 			  utf16_string_size,
+			  utf16_string_index,
 			  data_string->data,
 			  data_string->data_size,
 			  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
@@ -1268,9 +2110,10 @@ int liblnk_data_string_get_utf16_path_string(
 	}
 	else
 	{
-		result = libuna_utf16_string_copy_from_byte_stream(
+		result = libuna_utf16_string_with_index_copy_from_byte_stream(
 			  utf16_string,
 			  utf16_string_size,
+			  utf16_string_index,
 			  data_string->data,
 			  data_string->data_size,
 			  ascii_codepage,
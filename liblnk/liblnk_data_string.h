@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "liblnk_arena.h"
 #include "liblnk_io_handle.h"
 #include "liblnk_libbfio.h"
 #include "liblnk_libcerror.h"
@@ -43,21 +44,70 @@ struct liblnk_data_string
 
 	/* The data
 	 */
-	uint8_t *data;
+	const uint8_t *data;
 
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* Value to indicate the data references a caller provided buffer
+	 */
+	uint8_t data_is_borrowed;
+
+	/* The cached UTF-8 string
+	 */
+	uint8_t *cached_utf8_string;
+
+	/* The cached UTF-8 string size
+	 */
+	size_t cached_utf8_string_size;
+
+	/* The ASCII codepage the cached UTF-8 string was converted with
+	 */
+	int cached_utf8_string_codepage;
+
+	/* Value to indicate the cached UTF-8 string is a path string
+	 */
+	uint8_t cached_utf8_string_is_path;
+
+	/* The cached UTF-16 string
+	 */
+	uint16_t *cached_utf16_string;
+
+	/* The cached UTF-16 string size
+	 */
+	size_t cached_utf16_string_size;
+
+	/* The ASCII codepage the cached UTF-16 string was converted with
+	 */
+	int cached_utf16_string_codepage;
+
+	/* Value to indicate the cached UTF-16 string is a path string
+	 */
+	uint8_t cached_utf16_string_is_path;
+
+	/* Value to indicate the structure is allocated from an arena
+	 */
+	uint8_t is_arena_allocated;
 };
 
 int liblnk_data_string_initialize(
      liblnk_data_string_t **data_string,
      libcerror_error_t **error );
 
+int liblnk_data_string_initialize_with_arena(
+     liblnk_data_string_t **data_string,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error );
+
 int liblnk_data_string_free(
      liblnk_data_string_t **data_string,
      libcerror_error_t **error );
 
+int liblnk_data_string_clear(
+     liblnk_data_string_t *data_string,
+     libcerror_error_t **error );
+
 int liblnk_data_string_read_data(
      liblnk_data_string_t *data_string,
      liblnk_io_handle_t *io_handle,
@@ -74,6 +124,23 @@ int liblnk_data_string_read_file_io_handle(
      uint32_t encoding_flags,
      libcerror_error_t **error );
 
+int liblnk_data_string_has_cached_string(
+     liblnk_data_string_t *data_string,
+     int ascii_codepage,
+     int string_format,
+     uint8_t is_path );
+
+int liblnk_data_string_cache_string(
+     liblnk_data_string_t *data_string,
+     int ascii_codepage,
+     int string_format,
+     uint8_t is_path,
+     libcerror_error_t **error );
+
+int liblnk_data_string_clear_cache(
+     liblnk_data_string_t *data_string,
+     libcerror_error_t **error );
+
 int liblnk_data_string_get_utf8_string_size(
      liblnk_data_string_t *data_string,
      int ascii_codepage,
@@ -113,6 +180,14 @@ int liblnk_data_string_get_utf8_path_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int liblnk_data_string_get_utf8_path_string_with_index(
+     liblnk_data_string_t *data_string,
+     int ascii_codepage,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
 int liblnk_data_string_get_utf16_path_string_size(
      liblnk_data_string_t *data_string,
      int ascii_codepage,
@@ -126,6 +201,14 @@ int liblnk_data_string_get_utf16_path_string(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int liblnk_data_string_get_utf16_path_string_with_index(
+     liblnk_data_string_t *data_string,
+     int ascii_codepage,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
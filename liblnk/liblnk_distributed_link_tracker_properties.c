@@ -32,6 +32,7 @@
 #include "liblnk_libfguid.h"
 #include "liblnk_libfwsi.h"
 #include "liblnk_libuna.h"
+#include "liblnk_string_size.h"
 
 #include "lnk_data_blocks.h"
 
@@ -147,11 +148,11 @@ int liblnk_distributed_link_tracker_properties_read(
      int ascii_codepage,
      libcerror_error_t **error )
 {
-	liblnk_internal_data_block_t *internal_data_block                                              = NULL;
-	lnk_data_block_distributed_link_tracker_properties_t *distributed_link_tracker_properties_data = NULL;
-	static char *function                                                                          = "liblnk_distributed_link_tracker_properties_read";
-	uint32_t data_size                                                                             = 0;
-	uint32_t data_version                                                                          = 0;
+	liblnk_internal_data_block_t *internal_data_block                                                    = NULL;
+	const lnk_data_block_distributed_link_tracker_properties_t *distributed_link_tracker_properties_data = NULL;
+	static char *function                                                                                = "liblnk_distributed_link_tracker_properties_read";
+	uint32_t data_size                                                                                   = 0;
+	uint32_t data_version                                                                                = 0;
 
 	if( distributed_link_tracker_properties == NULL )
 	{
@@ -199,7 +200,7 @@ int liblnk_distributed_link_tracker_properties_read(
 
 		return( -1 );
 	}
-	distributed_link_tracker_properties_data = (lnk_data_block_distributed_link_tracker_properties_t *) internal_data_block->data;
+	distributed_link_tracker_properties_data = (const lnk_data_block_distributed_link_tracker_properties_t *) internal_data_block->data;
 
 	byte_stream_copy_to_uint32_little_endian(
 	 distributed_link_tracker_properties_data->data_size,
@@ -248,6 +249,21 @@ int liblnk_distributed_link_tracker_properties_read(
 
 		return( -1 );
 	}
+	if( liblnk_string_size_from_byte_stream(
+	     distributed_link_tracker_properties->machine_identifier_string,
+	     16,
+	     &( distributed_link_tracker_properties->machine_identifier_string_size ),
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine machine identifier string size.",
+		 function );
+
+		return( -1 );
+	}
 	if( memory_copy(
 	     distributed_link_tracker_properties->droid_volume_identifier,
 	     distributed_link_tracker_properties_data->droid_volume_identifier,
@@ -461,7 +477,7 @@ int liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier_size(
 	}
 	if( libuna_utf8_string_size_from_byte_stream(
 	     distributed_link_tracker_properties->machine_identifier_string,
-	     16,
+	     distributed_link_tracker_properties->machine_identifier_string_size,
 	     ascii_codepage,
 	     utf8_string_size,
 	     error ) != 1 )
@@ -490,6 +506,45 @@ int liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier(
      libcerror_error_t **error )
 {
 	static char *function = "liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier";
+	size_t string_index   = 0;
+	int result            = 0;
+
+	result = liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier_with_index(
+	          distributed_link_tracker_properties,
+	          utf8_string,
+	          utf8_string_size,
+	          &string_index,
+	          ascii_codepage,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 machine identifier string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded machine identifier
+ * The size should include the end of string character
+ * The string is copied at the string index, which is set to the index after the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier_with_index(
+     liblnk_distributed_link_tracker_properties_t *distributed_link_tracker_properties,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier_with_index";
 
 	if( distributed_link_tracker_properties == NULL )
 	{
@@ -502,11 +557,23 @@ int liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier(
 
 		return( -1 );
 	}
-	if( libuna_utf8_string_copy_from_byte_stream(
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_with_index_copy_from_byte_stream(
 	     utf8_string,
 	     utf8_string_size,
+	     utf8_string_index,
 	     distributed_link_tracker_properties->machine_identifier_string,
-	     16,
+	     distributed_link_tracker_properties->machine_identifier_string_size,
 	     ascii_codepage,
 	     error ) != 1 )
 	{
@@ -547,7 +614,7 @@ int liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier_size
 	}
 	if( libuna_utf16_string_size_from_byte_stream(
 	     distributed_link_tracker_properties->machine_identifier_string,
-	     16,
+	     distributed_link_tracker_properties->machine_identifier_string_size,
 	     ascii_codepage,
 	     utf16_string_size,
 	     error ) != 1 )
@@ -576,6 +643,45 @@ int liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier(
      libcerror_error_t **error )
 {
 	static char *function = "liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier";
+	size_t string_index   = 0;
+	int result            = 0;
+
+	result = liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier_with_index(
+	          distributed_link_tracker_properties,
+	          utf16_string,
+	          utf16_string_size,
+	          &string_index,
+	          ascii_codepage,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 machine identifier string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded machine identifier
+ * The size should include the end of string character
+ * The string is copied at the string index, which is set to the index after the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier_with_index(
+     liblnk_distributed_link_tracker_properties_t *distributed_link_tracker_properties,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier_with_index";
 
 	if( distributed_link_tracker_properties == NULL )
 	{
@@ -588,11 +694,23 @@ int liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier(
 
 		return( -1 );
 	}
-	if( libuna_utf16_string_copy_from_byte_stream(
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_with_index_copy_from_byte_stream(
 	     utf16_string,
 	     utf16_string_size,
+	     utf16_string_index,
 	     distributed_link_tracker_properties->machine_identifier_string,
-	     16,
+	     distributed_link_tracker_properties->machine_identifier_string_size,
 	     ascii_codepage,
 	     error ) != 1 )
 	{
@@ -40,6 +40,10 @@ struct liblnk_distributed_link_tracker_properties
 	 */
 	uint8_t machine_identifier_string[ 16 ];
 
+	/* The machine identifier string size
+	 */
+	size_t machine_identifier_string_size;
+
 	/* The droid volume identifier
 	 */
 	uint8_t droid_volume_identifier[ 16 ];
@@ -84,6 +88,14 @@ int liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier_with_index(
+     liblnk_distributed_link_tracker_properties_t *distributed_link_tracker_properties,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
 int liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier_size(
      liblnk_distributed_link_tracker_properties_t *distributed_link_tracker_properties,
      size_t *utf16_string_size,
@@ -97,6 +109,14 @@ int liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier_with_index(
+     liblnk_distributed_link_tracker_properties_t *distributed_link_tracker_properties,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
 int liblnk_distributed_link_tracker_properties_get_droid_volume_identifier(
      liblnk_distributed_link_tracker_properties_t *distributed_link_tracker_properties,
      uint8_t *guid_data,
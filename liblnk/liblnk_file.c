@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
@@ -30,6 +31,7 @@
 #include "liblnk_data_string.h"
 #include "liblnk_debug.h"
 #include "liblnk_definitions.h"
+#include "liblnk_distributed_link_tracker_properties.h"
 #include "liblnk_distributed_link_tracking_data_block.h"
 #include "liblnk_file.h"
 #include "liblnk_file_header.h"
@@ -43,7 +45,9 @@
 #include "liblnk_libuna.h"
 #include "liblnk_link_target_identifier.h"
 #include "liblnk_location_information.h"
+#include "liblnk_memory_map.h"
 #include "liblnk_special_folder_location.h"
+#include "liblnk_statistics.h"
 #include "liblnk_strings_data_block.h"
 #include "liblnk_types.h"
 
@@ -153,6 +157,9 @@ int liblnk_file_initialize(
 		goto on_error;
 	}
 #endif
+	internal_file->maximum_read_buffer_size = LIBLNK_DEFAULT_MAXIMUM_READ_BUFFER_SIZE;
+	internal_file->field_mask               = LIBLNK_FIELD_ALL;
+
 	*file = (liblnk_file_t *) internal_file;
 
 	return( 1 );
@@ -198,7 +205,8 @@ int liblnk_file_free(
 	{
 		internal_file = (liblnk_internal_file_t *) *file;
 
-		if( internal_file->file_io_handle != NULL )
+		if( ( internal_file->file_io_handle != NULL )
+		 || ( internal_file->memory_buffer != NULL ) )
 		{
 			if( liblnk_file_close(
 			     *file,
@@ -245,6 +253,54 @@ int liblnk_file_free(
 
 			result = -1;
 		}
+		if( internal_file->retained_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->retained_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free retained file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file->arena != NULL )
+		{
+			if( liblnk_arena_free(
+			     &( internal_file->arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file->statistics != NULL )
+		{
+			if( liblnk_statistics_free(
+			     (liblnk_statistics_t **) &( internal_file->statistics ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free statistics.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( liblnk_io_handle_free(
 		     &( internal_file->io_handle ),
 		     error ) != 1 )
@@ -304,6 +360,7 @@ int liblnk_file_signal_abort(
 }
 
 /* Opens a file
+ * The file must be opened before it is accessed by other threads
  * Returns 1 if successful or -1 on error
  */
 int liblnk_file_open(
@@ -314,8 +371,11 @@ int liblnk_file_open(
 {
 	libbfio_handle_t *file_io_handle      = NULL;
 	liblnk_internal_file_t *internal_file = NULL;
+	uint8_t *mapped_data                  = NULL;
 	static char *function                 = "liblnk_file_open";
 	size_t filename_length                = 0;
+	size_t mapped_data_size               = 0;
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -364,9 +424,62 @@ int liblnk_file_open(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( ( access_flags & LIBLNK_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		result = liblnk_memory_map_file(
+		          filename,
+		          &mapped_data,
+		          &mapped_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( liblnk_file_open_memory(
+			     file,
+			     mapped_data,
+			     mapped_data_size,
+			     access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file: %s.",
+				 function,
+				 filename );
+
+				goto on_error;
+			}
+			internal_file->memory_buffer_mapped_in_library = 1;
+
+			return( 1 );
+		}
+		/* Fall back to reading the file if it cannot be memory mapped
+		 */
+	}
+	if( internal_file->retained_file_io_handle != NULL )
+	{
+		/* Reuse the file IO handle retained by a previous close
+		 */
+		file_io_handle = internal_file->retained_file_io_handle;
+
+		internal_file->retained_file_io_handle = NULL;
+	}
+	else if( libbfio_file_initialize(
+	          &file_io_handle,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -438,12 +551,20 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
+	if( mapped_data != NULL )
+	{
+		liblnk_memory_unmap_file(
+		 &mapped_data,
+		 mapped_data_size,
+		 NULL );
+	}
 	return( -1 );
 }
 
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Opens a file
+ * The file must be opened before it is accessed by other threads
  * Returns 1 if successful or -1 on error
  */
 int liblnk_file_open_wide(
@@ -454,8 +575,11 @@ int liblnk_file_open_wide(
 {
 	libbfio_handle_t *file_io_handle      = NULL;
 	liblnk_internal_file_t *internal_file = NULL;
+	uint8_t *mapped_data                  = NULL;
 	static char *function                 = "liblnk_file_open_wide";
 	size_t filename_length                = 0;
+	size_t mapped_data_size               = 0;
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -504,9 +628,62 @@ int liblnk_file_open_wide(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( ( access_flags & LIBLNK_ACCESS_FLAG_MEMORY_MAP ) != 0 )
+	{
+		result = liblnk_memory_map_file_wide(
+		          filename,
+		          &mapped_data,
+		          &mapped_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to memory map file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( liblnk_file_open_memory(
+			     file,
+			     mapped_data,
+			     mapped_data_size,
+			     access_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file: %ls.",
+				 function,
+				 filename );
+
+				goto on_error;
+			}
+			internal_file->memory_buffer_mapped_in_library = 1;
+
+			return( 1 );
+		}
+		/* Fall back to reading the file if it cannot be memory mapped
+		 */
+	}
+	if( internal_file->retained_file_io_handle != NULL )
+	{
+		/* Reuse the file IO handle retained by a previous close
+		 */
+		file_io_handle = internal_file->retained_file_io_handle;
+
+		internal_file->retained_file_io_handle = NULL;
+	}
+	else if( libbfio_file_initialize(
+	          &file_io_handle,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -578,12 +755,20 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
+	if( mapped_data != NULL )
+	{
+		liblnk_memory_unmap_file(
+		 &mapped_data,
+		 mapped_data_size,
+		 NULL );
+	}
 	return( -1 );
 }
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
 /* Opens a file using a Basic File IO (bfio) handle
+ * The file must be opened before it is accessed by other threads
  * Returns 1 if successful or -1 on error
  */
 int liblnk_file_open_file_io_handle(
@@ -594,6 +779,7 @@ int liblnk_file_open_file_io_handle(
 {
 	liblnk_internal_file_t *internal_file    = NULL;
 	static char *function                    = "liblnk_file_open_file_io_handle";
+	uint64_t start_timestamp                 = 0;
 	uint8_t file_io_handle_opened_in_library = 0;
 	int bfio_access_flags                    = 0;
 	int file_io_handle_is_open               = 0;
@@ -622,6 +808,17 @@ int liblnk_file_open_file_io_handle(
 
 		return( -1 );
 	}
+	if( internal_file->memory_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - memory buffer already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -693,6 +890,78 @@ int liblnk_file_open_file_io_handle(
 		}
 		file_io_handle_opened_in_library = 1;
 	}
+	if( ( access_flags & LIBLNK_ACCESS_FLAG_LAZY_DATA_BLOCKS ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBLNK_IO_HANDLE_FLAG_DATA_BLOCKS_ON_DEMAND;
+	}
+	if( ( access_flags & LIBLNK_ACCESS_FLAG_USE_ARENA ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBLNK_IO_HANDLE_FLAG_USE_ARENA;
+
+		if( internal_file->arena == NULL )
+		{
+			if( liblnk_arena_initialize(
+			     &( internal_file->arena ),
+			     LIBLNK_ARENA_DEFAULT_BLOCK_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create arena.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	else if( internal_file->arena != NULL )
+	{
+		/* Release an arena retained by a previous close that is not used by this open
+		 */
+		if( liblnk_arena_free(
+		     &( internal_file->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( liblnk_internal_file_set_statistics(
+	     internal_file,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_statistics_start_phase(
+	     internal_file->statistics,
+	     &start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start open phase.",
+		 function );
+
+		goto on_error;
+	}
 	if( liblnk_internal_file_open_read(
 	     internal_file,
 	     file_io_handle,
@@ -707,12 +976,61 @@ int liblnk_file_open_file_io_handle(
 
 		goto on_error;
 	}
+	if( liblnk_internal_file_add_value_statistics(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add value statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_statistics_end_phase(
+	     internal_file->statistics,
+	     LIBLNK_STATISTICS_PHASE_OPEN,
+	     start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end open phase.",
+		 function );
+
+		goto on_error;
+	}
 	internal_file->file_io_handle                   = file_io_handle;
 	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
 
+	/* Extra data blocks read on demand are changed after open
+	 */
+	if( ( internal_file->io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_BLOCKS_ON_DEMAND ) == 0 )
+	{
+		internal_file->is_frozen = 1;
+	}
 	return( 1 );
 
 on_error:
+	internal_file->io_handle->flags &= (uint8_t) ~( LIBLNK_IO_HANDLE_FLAG_DATA_BLOCKS_ON_DEMAND | LIBLNK_IO_HANDLE_FLAG_USE_ARENA );
+	internal_file->io_handle->statistics = NULL;
+
+	if( internal_file->arena != NULL )
+	{
+		libcdata_array_empty(
+		 internal_file->data_blocks_array,
+		 (int(*)(intptr_t **, libcerror_error_t **)) &liblnk_internal_data_block_free,
+		 NULL );
+
+		liblnk_arena_free(
+		 &( internal_file->arena ),
+		 NULL );
+	}
+
 	if( ( file_io_handle_is_open == 0 )
 	 && ( file_io_handle_opened_in_library != 0 ) )
 	{
@@ -723,16 +1041,22 @@ on_error:
 	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+/* Opens a file from a caller provided buffer
+ * The buffer is referenced and not copied, it must remain valid and unchanged until the file is closed
+ * The file must be opened before it is accessed by other threads
+ * Returns 1 if successful or -1 on error
  */
-int liblnk_file_close(
+int liblnk_file_open_memory(
      liblnk_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle      = NULL;
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_close";
-	int result                            = 0;
+	static char *function                 = "liblnk_file_open_memory";
+	uint64_t start_timestamp              = 0;
 
 	if( file == NULL )
 	{
@@ -747,1433 +1071,4636 @@ int liblnk_file_close(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_file->file_io_handle != NULL )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( liblnk_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	if( internal_file->memory_buffer != NULL )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - memory buffer already set.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
-	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
-			 function );
-
-			result = -1;
-		}
-		internal_file->file_io_handle_created_in_library = 0;
-	}
-	internal_file->file_io_handle = NULL;
-
-	if( liblnk_io_handle_clear(
-	     internal_file->io_handle,
-	     error ) != 1 )
+	if( buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
 		 function );
 
-		result = -1;
-	}
-	if( internal_file->file_information != NULL )
-	{
-		if( liblnk_file_header_free(
-		     &( internal_file->file_information ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file information.",
-			 function );
-
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_file->link_target_identifier != NULL )
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size_t) SSIZE_MAX ) )
 	{
-		if( liblnk_link_target_identifier_free(
-		     &( internal_file->link_target_identifier ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free link target identifier.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_file->location_information != NULL )
+	if( ( ( access_flags & LIBLNK_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBLNK_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( liblnk_location_information_free(
-		     &( internal_file->location_information ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free location information.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_file->description != NULL )
+	if( ( access_flags & LIBLNK_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		if( liblnk_data_string_free(
-		     &( internal_file->description ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free description.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
 
-			result = -1;
-		}
+		return( -1 );
 	}
-	if( internal_file->relative_path != NULL )
+	if( liblnk_internal_file_open_memory_file_io_handle(
+	     &file_io_handle,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
 	{
-		if( liblnk_data_string_free(
-		     &( internal_file->relative_path ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free relative path.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open memory file IO handle.",
+		 function );
 
-			result = -1;
-		}
+		goto on_error;
 	}
-	if( internal_file->working_directory != NULL )
-	{
-		if( liblnk_data_string_free(
-		     &( internal_file->working_directory ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free working directory.",
-			 function );
+	/* The values reference the buffer and the buffer is used to read data blocks on demand
+	 */
+	internal_file->io_handle->flags    |= LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED;
+	internal_file->io_handle->data      = buffer;
+	internal_file->io_handle->data_size = buffer_size;
 
-			result = -1;
-		}
-	}
-	if( internal_file->command_line_arguments != NULL )
+	if( ( access_flags & LIBLNK_ACCESS_FLAG_LAZY_DATA_BLOCKS ) != 0 )
 	{
-		if( liblnk_data_string_free(
-		     &( internal_file->command_line_arguments ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free command line arguments.",
-			 function );
-
-			result = -1;
-		}
+		internal_file->io_handle->flags |= LIBLNK_IO_HANDLE_FLAG_DATA_BLOCKS_ON_DEMAND;
 	}
-	if( internal_file->icon_location != NULL )
+	if( ( access_flags & LIBLNK_ACCESS_FLAG_USE_ARENA ) != 0 )
 	{
-		if( liblnk_data_string_free(
-		     &( internal_file->icon_location ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free icon location.",
-			 function );
+		internal_file->io_handle->flags |= LIBLNK_IO_HANDLE_FLAG_USE_ARENA;
 
-			result = -1;
-		}
-	}
-	if( internal_file->special_folder_location != NULL )
-	{
-		if( liblnk_special_folder_location_free(
-		     &( internal_file->special_folder_location ),
-		     error ) != 1 )
+		if( internal_file->arena == NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free special folder location.",
-			 function );
+			if( liblnk_arena_initialize(
+			     &( internal_file->arena ),
+			     LIBLNK_ARENA_DEFAULT_BLOCK_SIZE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create arena.",
+				 function );
 
-			result = -1;
+				goto on_error;
+			}
 		}
 	}
-	if( internal_file->known_folder_location != NULL )
+	else if( internal_file->arena != NULL )
 	{
-		if( liblnk_known_folder_location_free(
-		     &( internal_file->known_folder_location ),
+		/* Release an arena retained by a previous close that is not used by this open
+		 */
+		if( liblnk_arena_free(
+		     &( internal_file->arena ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free known folder location.",
+			 "%s: unable to free arena.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
 	}
-	if( libcdata_array_empty(
-	     internal_file->data_blocks_array,
-	     (int(*)(intptr_t **, libcerror_error_t **)) &liblnk_internal_data_block_free,
+	if( liblnk_internal_file_set_statistics(
+	     internal_file,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty data blocks array.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set statistics.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	internal_file->environment_variables_location_data_block = NULL;
-	internal_file->distributed_link_tracking_data_block      = NULL;
-
-	return( result );
-}
-
-/* Opens a file for reading
- * Returns 1 if successful or -1 on error
- */
-int liblnk_internal_file_open_read(
-     liblnk_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
-     libcerror_error_t **error )
-{
-	static char *function     = "liblnk_internal_file_open_read";
-	ssize_t read_count        = 0;
-	off64_t file_offset       = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *trailing_data    = NULL;
-	size_t trailing_data_size = 0;
-#endif
-
-	if( internal_file == NULL )
+	if( liblnk_statistics_start_phase(
+	     internal_file->statistics,
+	     &start_timestamp,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start open phase.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_file->io_handle == NULL )
+	if( liblnk_internal_file_open_read(
+	     internal_file,
+	     file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from buffer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_file->file_information != NULL )
+	if( liblnk_internal_file_add_value_statistics(
+	     internal_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file information value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add value statistics.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_file->link_target_identifier != NULL )
+	if( liblnk_statistics_end_phase(
+	     internal_file->statistics,
+	     LIBLNK_STATISTICS_PHASE_OPEN,
+	     start_timestamp,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - link target identifier value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end open phase.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( internal_file->location_information != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - location information value already set.",
-		 function );
+	internal_file->file_io_handle                    = file_io_handle;
+	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->file_io_handle_opened_in_library  = 1;
+	internal_file->memory_buffer                     = buffer;
+	internal_file->memory_buffer_size                = buffer_size;
 
-		return( -1 );
-	}
-	if( internal_file->description != NULL )
+	/* Extra data blocks read on demand are changed after open
+	 */
+	if( ( internal_file->io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_BLOCKS_ON_DEMAND ) == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - description value already set.",
-		 function );
-
-		return( -1 );
+		internal_file->is_frozen = 1;
 	}
-	if( internal_file->relative_path != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - relative path value already set.",
-		 function );
+	return( 1 );
 
-		return( -1 );
-	}
-	if( internal_file->working_directory != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - working directory value already set.",
-		 function );
+on_error:
+	internal_file->io_handle->flags &= (uint8_t) ~( LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED | LIBLNK_IO_HANDLE_FLAG_DATA_BLOCKS_ON_DEMAND | LIBLNK_IO_HANDLE_FLAG_USE_ARENA );
+	internal_file->io_handle->statistics = NULL;
+	internal_file->io_handle->data       = NULL;
+	internal_file->io_handle->data_size  = 0;
 
-		return( -1 );
-	}
-	if( internal_file->command_line_arguments != NULL )
+	if( internal_file->arena != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - command line arguments value already set.",
-		 function );
+		libcdata_array_empty(
+		 internal_file->data_blocks_array,
+		 (int(*)(intptr_t **, libcerror_error_t **)) &liblnk_internal_data_block_free,
+		 NULL );
 
-		return( -1 );
+		liblnk_arena_free(
+		 &( internal_file->arena ),
+		 NULL );
 	}
-	if( internal_file->icon_location != NULL )
+	if( file_io_handle != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - icon location value already set.",
-		 function );
-
-		return( -1 );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
-	if( internal_file->special_folder_location != NULL )
+	return( -1 );
+}
+
+/* Closes a file
+ * The file must not be closed while it is accessed by other threads
+ * Returns 0 if successful or -1 on error
+ */
+int liblnk_file_close(
+     liblnk_file_t *file,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_close";
+	int result                            = 0;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - special folder location value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->known_folder_location != NULL )
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( ( internal_file->file_io_handle == NULL )
+	 && ( internal_file->memory_buffer == NULL ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - known folder location value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( liblnk_file_header_initialize(
-	     &( internal_file->file_information ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file header.",
-		 function );
+	internal_file->is_frozen = 0;
 
-		goto on_error;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
-	}
-#endif
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &( internal_file->io_handle->file_size ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
-		 function );
-
-		goto on_error;
-	}
-	if( liblnk_file_header_read_file_io_handle(
-	     internal_file->file_information,
-	     file_io_handle,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
-		 function );
-
-		goto on_error;
-	}
-	file_offset = 76;
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( liblnk_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
 
-	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_IS_UNICODE ) != 0 )
-	{
-		internal_file->io_handle->is_unicode = 1;
-	}
-	else
-	{
-		internal_file->io_handle->is_unicode = 0;
+				result = -1;
+			}
+		}
 	}
-	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_LINK_TARGET_IDENTIFIER ) != 0 )
+#endif
+	if( internal_file->file_io_handle_opened_in_library != 0 )
 	{
-		if( liblnk_link_target_identifier_initialize(
-		     &( internal_file->link_target_identifier ),
-		     error ) != 1 )
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create link target identifier.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		/* The memory file IO handle of a file opened from memory is not retained
+		 */
+		if( ( internal_file->retain_capacity != 0 )
+		 && ( internal_file->retained_file_io_handle == NULL )
+		 && ( internal_file->memory_buffer == NULL ) )
 		{
-			libcnotify_printf(
-			 "Reading link target identifier:\n" );
+			internal_file->retained_file_io_handle = internal_file->file_io_handle;
 		}
-#endif
-		read_count = liblnk_link_target_identifier_read(
-		              internal_file->link_target_identifier,
-		              internal_file->io_handle,
-		              file_io_handle,
-		              file_offset,
-		              error );
-
-		if( read_count <= -1 )
+		else if( libbfio_handle_free(
+		          &( internal_file->file_io_handle ),
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read link target identifier.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		file_offset += read_count;
+		internal_file->file_io_handle_created_in_library = 0;
 	}
-	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_LOCATION_INFORMATION ) != 0 )
+	if( internal_file->memory_buffer_mapped_in_library != 0 )
 	{
-		if( liblnk_location_information_initialize(
-		     &( internal_file->location_information ),
+		if( liblnk_memory_unmap_file(
+		     (uint8_t **) &( internal_file->memory_buffer ),
+		     internal_file->memory_buffer_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create location information.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to unmap memory buffer.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading location information:\n" );
+			result = -1;
 		}
-#endif
-		read_count = liblnk_location_information_read(
-		              internal_file->location_information,
-		              internal_file->io_handle,
-		              file_io_handle,
-		              file_offset,
-		              error );
+		internal_file->memory_buffer_mapped_in_library = 0;
+	}
+	internal_file->file_io_handle     = NULL;
+	internal_file->memory_buffer      = NULL;
+	internal_file->memory_buffer_size = 0;
 
-		if( read_count <= -1 )
+	if( internal_file->statistics != NULL )
+	{
+		if( liblnk_statistics_merge_global(
+		     internal_file->statistics,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read location information.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add statistics to global statistics.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		file_offset += read_count;
 	}
-	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_DESCRIPTION_STRING ) != 0 )
+	if( liblnk_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
 	{
-		if( liblnk_data_string_initialize(
-		     &( internal_file->description ),
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->file_information != NULL )
+	{
+		if( liblnk_file_header_free(
+		     &( internal_file->file_information ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create description.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file information.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading description data string:\n" );
+			result = -1;
 		}
-#endif
-		if( liblnk_data_string_read_file_io_handle(
-		     internal_file->description,
-		     internal_file->io_handle,
-		     file_io_handle,
-		     file_offset,
-		     0,
+	}
+	if( internal_file->link_target_identifier != NULL )
+	{
+		if( liblnk_link_target_identifier_free(
+		     &( internal_file->link_target_identifier ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read description data string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free link target identifier.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		file_offset += 2 + internal_file->description->data_size;
 	}
-	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_RELATIVE_PATH_STRING ) != 0 )
+	if( internal_file->location_information != NULL )
 	{
-		if( liblnk_data_string_initialize(
-		     &( internal_file->relative_path ),
+		if( liblnk_location_information_free(
+		     &( internal_file->location_information ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create relative path.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free location information.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading relative path data string:\n" );
+			result = -1;
 		}
-#endif
-		if( liblnk_data_string_read_file_io_handle(
-		     internal_file->relative_path,
-		     internal_file->io_handle,
-		     file_io_handle,
-		     file_offset,
-		     LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+	}
+	if( internal_file->description != NULL )
+	{
+		if( liblnk_data_string_free(
+		     &( internal_file->description ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read relative path data string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free description.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		file_offset += 2 + internal_file->relative_path->data_size;
 	}
-	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_WORKING_DIRECTORY_STRING ) != 0 )
+	if( internal_file->relative_path != NULL )
 	{
-		if( liblnk_data_string_initialize(
-		     &( internal_file->working_directory ),
+		if( liblnk_data_string_free(
+		     &( internal_file->relative_path ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create working directory.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free relative path.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading working directory data string:\n" );
+			result = -1;
 		}
-#endif
-		if( liblnk_data_string_read_file_io_handle(
-		     internal_file->working_directory,
-		     internal_file->io_handle,
-		     file_io_handle,
-		     file_offset,
-		     LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+	}
+	if( internal_file->working_directory != NULL )
+	{
+		if( liblnk_data_string_free(
+		     &( internal_file->working_directory ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read working directory data string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free working directory.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		file_offset += 2 + internal_file->working_directory->data_size;
 	}
-	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_COMMAND_LINE_ARGUMENTS_STRING ) != 0 )
+	if( internal_file->command_line_arguments != NULL )
 	{
-		if( liblnk_data_string_initialize(
+		if( liblnk_data_string_free(
 		     &( internal_file->command_line_arguments ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create command line arguments.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free command line arguments.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading command line arguments data string:\n" );
+			result = -1;
 		}
-#endif
-		if( liblnk_data_string_read_file_io_handle(
-		     internal_file->command_line_arguments,
-		     internal_file->io_handle,
-		     file_io_handle,
-		     file_offset,
-		     LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+	}
+	if( internal_file->icon_location != NULL )
+	{
+		if( liblnk_data_string_free(
+		     &( internal_file->icon_location ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read command line arguments data string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free icon location.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		file_offset += 2 + internal_file->command_line_arguments->data_size;
 	}
-	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_ICON_LOCATION_STRING ) != 0 )
+	if( internal_file->special_folder_location != NULL )
 	{
-		if( liblnk_data_string_initialize(
-		     &( internal_file->icon_location ),
+		if( liblnk_special_folder_location_free(
+		     &( internal_file->special_folder_location ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create icon location.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free special folder location.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "Reading icon location data string:\n" );
+			result = -1;
 		}
-#endif
-		if( liblnk_data_string_read_file_io_handle(
-		     internal_file->icon_location,
-		     internal_file->io_handle,
-		     file_io_handle,
-		     file_offset,
-		     LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+	}
+	if( internal_file->known_folder_location != NULL )
+	{
+		if( liblnk_known_folder_location_free(
+		     &( internal_file->known_folder_location ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read icon location data string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free known folder location.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		file_offset += 2 + internal_file->icon_location->data_size;
 	}
-	if( file_offset < (off64_t) internal_file->io_handle->file_size )
+	if( libcdata_array_empty(
+	     internal_file->data_blocks_array,
+	     (int(*)(intptr_t **, libcerror_error_t **)) &liblnk_internal_data_block_free,
+	     error ) != 1 )
 	{
-		read_count = liblnk_internal_file_read_extra_data_blocks(
-		              internal_file,
-		              file_io_handle,
-		              file_offset,
-		              error );
-
-		if( read_count <= -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read extra data blocks.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty data blocks array.",
+		 function );
 
-			goto on_error;
-		}
-		file_offset += read_count;
+		result = -1;
 	}
-	internal_file->data_size = (size64_t) file_offset;
+	internal_file->environment_variables_location_data_block = NULL;
+	internal_file->distributed_link_tracking_data_block      = NULL;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* The arena is cleared or freed after the values allocated from it
+	 */
+	if( internal_file->arena != NULL )
 	{
-		if( file_offset < (off64_t) internal_file->io_handle->file_size )
+		if( internal_file->retain_capacity != 0 )
 		{
-			trailing_data_size = (size_t) ( internal_file->io_handle->file_size - file_offset );
-
-			if( trailing_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			if( liblnk_arena_clear(
+			     internal_file->arena,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid trailing data size value exceed maximum allocation size.",
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear arena.",
 				 function );
 
-				goto on_error;
+				result = -1;
 			}
-			trailing_data = (uint8_t *) memory_allocate(
-						     sizeof( uint8_t ) * trailing_data_size );
+		}
+		else if( liblnk_arena_free(
+		     &( internal_file->arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free arena.",
+			 function );
 
-			if( trailing_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create trailing data.",
-				 function );
+			result = -1;
+		}
+	}
+	return( result );
+}
 
-				goto on_error;
-			}
-			read_count = libbfio_handle_read_buffer(
-				      file_io_handle,
-				      trailing_data,
-				      trailing_data_size,
-				      error );
+/* Sets up the statistics collected by the next open
+ * The statistics of a previous open are cleared or freed
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_set_statistics(
+     liblnk_internal_file_t *internal_file,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_internal_file_set_statistics";
 
-			if( read_count != (ssize_t) trailing_data_size )
-			{
-				libcerror_error_set(
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBLNK_ACCESS_FLAG_COLLECT_STATISTICS ) == 0 )
+	{
+		if( internal_file->statistics != NULL )
+		{
+			if( liblnk_statistics_free(
+			     (liblnk_statistics_t **) &( internal_file->statistics ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read trailing data.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free statistics.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
-			file_offset += read_count;
-
-			libcnotify_printf(
-			 "%s: trailing data:\n",
+		}
+	}
+	else if( internal_file->statistics == NULL )
+	{
+		if( liblnk_statistics_initialize(
+		     (liblnk_statistics_t **) &( internal_file->statistics ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create statistics.",
 			 function );
-			libcnotify_print_data(
-			 trailing_data,
-			 trailing_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
-			memory_free(
-			 trailing_data );
 
-			trailing_data = NULL;
+			return( -1 );
 		}
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	else if( liblnk_statistics_clear(
+	          (liblnk_statistics_t *) internal_file->statistics,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->statistics = internal_file->statistics;
 
 	return( 1 );
+}
 
-on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( trailing_data != NULL )
+/* Adds the number of values created by the open to the statistics
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_add_value_statistics(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function     = "liblnk_internal_file_add_value_statistics";
+	uint64_t number_of_values = 0;
+	int number_of_data_blocks = 0;
+
+	if( internal_file == NULL )
 	{
-		memory_free(
-		 trailing_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( internal_file->known_folder_location != NULL )
+	if( internal_file->io_handle == NULL )
 	{
-		liblnk_known_folder_location_free(
-		 &( internal_file->known_folder_location ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->special_folder_location != NULL )
+	if( internal_file->io_handle->statistics == NULL )
 	{
-		liblnk_special_folder_location_free(
-		 &( internal_file->special_folder_location ),
-		 NULL );
+		return( 1 );
 	}
-	if( internal_file->icon_location != NULL )
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->data_blocks_array,
+	     &number_of_data_blocks,
+	     error ) != 1 )
 	{
-		liblnk_data_string_free(
-		 &( internal_file->icon_location ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data blocks.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->command_line_arguments != NULL )
+	number_of_values = (uint64_t) number_of_data_blocks;
+
+	if( internal_file->file_information != NULL )
 	{
-		liblnk_data_string_free(
-		 &( internal_file->command_line_arguments ),
-		 NULL );
+		number_of_values++;
 	}
-	if( internal_file->working_directory != NULL )
+	if( internal_file->link_target_identifier != NULL )
 	{
-		liblnk_data_string_free(
-		 &( internal_file->working_directory ),
-		 NULL );
+		number_of_values++;
 	}
-	if( internal_file->relative_path != NULL )
+	if( internal_file->location_information != NULL )
 	{
-		liblnk_data_string_free(
-		 &( internal_file->relative_path ),
-		 NULL );
+		number_of_values++;
 	}
 	if( internal_file->description != NULL )
 	{
-		liblnk_data_string_free(
-		 &( internal_file->description ),
-		 NULL );
+		number_of_values++;
 	}
-	if( internal_file->location_information != NULL )
+	if( internal_file->relative_path != NULL )
 	{
-		liblnk_location_information_free(
-		 &( internal_file->location_information ),
-		 NULL );
+		number_of_values++;
 	}
-	if( internal_file->link_target_identifier != NULL )
+	if( internal_file->working_directory != NULL )
 	{
-		liblnk_link_target_identifier_free(
-		 &( internal_file->link_target_identifier ),
-		 NULL );
+		number_of_values++;
 	}
-	if( internal_file->file_information != NULL )
+	if( internal_file->command_line_arguments != NULL )
 	{
-		liblnk_file_header_free(
-		 &( internal_file->file_information ),
-		 NULL );
+		number_of_values++;
 	}
-	internal_file->data_size = (size64_t) file_offset;
+	if( internal_file->icon_location != NULL )
+	{
+		number_of_values++;
+	}
+	if( internal_file->special_folder_location != NULL )
+	{
+		number_of_values++;
+	}
+	if( internal_file->known_folder_location != NULL )
+	{
+		number_of_values++;
+	}
+	if( liblnk_statistics_add_counter(
+	     internal_file->io_handle->statistics,
+	     LIBLNK_STATISTICS_COUNTER_NUMBER_OF_VALUES,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add number of values.",
+		 function );
 
-	return( -1 );
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Reads the extra data blocks
+/* Creates and opens a memory range file IO handle of file data
  * Returns 1 if successful or -1 on error
  */
-ssize_t liblnk_internal_file_read_extra_data_blocks(
-         liblnk_internal_file_t *internal_file,
-         libbfio_handle_t *file_io_handle,
-         off64_t file_offset,
-         libcerror_error_t **error )
+int liblnk_internal_file_open_memory_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
 {
-	liblnk_data_block_t *data_block = NULL;
-	static char *function           = "liblnk_internal_file_read_extra_data_blocks";
-	ssize_t read_count              = 0;
-	uint32_t data_block_signature   = 0;
-	uint32_t data_block_size        = 0;
-	int entry_index                 = 0;
-	int result                      = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-        libfwps_store_t *property_store = NULL;
-#endif
+	static char *function = "liblnk_internal_file_open_memory_file_io_handle";
 
-	if( internal_file == NULL )
+	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	if( *file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->file_information == NULL )
+	if( libbfio_memory_range_initialize(
+	     file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file information.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* libbfio takes a non-const range, the handle is only opened for reading
+	 * so the caller provided data is not modified
+	 */
+	if( libbfio_memory_range_set(
+	     *file_io_handle,
+	     (uint8_t *) data,
+	     data_size,
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "Reading extra data blocks:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
+
+		goto on_error;
 	}
-#endif
-	while( file_offset < (off64_t) internal_file->io_handle->file_size )
+	if( libbfio_handle_open(
+	     *file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
 	{
-		if( liblnk_data_block_initialize(
-		     &data_block,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create data block.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
 
-			goto on_error;
-		}
-		data_block_size = 0;
+		goto on_error;
+	}
+	return( 1 );
 
-		result = liblnk_data_block_read_file_io_handle(
-		          data_block,
-		          internal_file->io_handle,
-		          file_io_handle,
-		          file_offset,
-		          error );
+on_error:
+	if( *file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read data block.",
-			 function );
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_open_read(
+     liblnk_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *memory_file_io_handle = NULL;
+	uint8_t *arena_buffer                   = NULL;
+	uint8_t *read_buffer                    = NULL;
+	static char *function                   = "liblnk_internal_file_open_read";
+	size_t read_buffer_size                 = 0;
+	ssize_t read_count                      = 0;
+	uint64_t phase_timestamp                = 0;
+	off64_t file_offset                     = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
+	uint8_t *trailing_data    = NULL;
+	size_t trailing_data_size = 0;
 #endif
-			libcerror_error_free(
-			 error );
 
-			internal_file->io_handle->flags |= LIBLNK_IO_HANDLE_FLAG_IS_CORRUPTED;
-		}
-		else
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->link_target_identifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - link target identifier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->location_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - location information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->description != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - description value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->relative_path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - relative path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->working_directory != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - working directory value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->command_line_arguments != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - command line arguments value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->icon_location != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - icon location value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->special_folder_location != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - special folder location value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->known_folder_location != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - known folder location value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_file->io_handle->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	/* Small files are read with a single read and parsed from memory
+	 */
+	if( ( internal_file->io_handle->data == NULL )
+	 && ( internal_file->io_handle->file_size > 0 )
+	 && ( internal_file->io_handle->file_size <= (size64_t) internal_file->maximum_read_buffer_size ) )
+	{
+		read_buffer_size = (size_t) internal_file->io_handle->file_size;
+
+		/* When an arena is used the read buffer is kept for the lifetime of the open file
+		 * so that the values can reference the data instead of copying it
+		 */
+		if( internal_file->arena != NULL )
 		{
-			if( liblnk_internal_data_block_get_size(
-			     (liblnk_internal_data_block_t *) data_block,
-			     &data_block_size,
+			if( liblnk_arena_allocate(
+			     internal_file->arena,
+			     sizeof( uint8_t ) * read_buffer_size,
+			     (void **) &arena_buffer,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve data block size.",
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to allocate read buffer from arena.",
 				 function );
 
 				goto on_error;
 			}
+			read_buffer = arena_buffer;
 		}
-		if( data_block_size == 0 )
+		else
 		{
-			if( liblnk_internal_data_block_free(
-			     (liblnk_internal_data_block_t **) &data_block,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free data block.",
-				 function );
+			read_buffer = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * read_buffer_size );
+		}
+		if( read_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read buffer.",
+			 function );
 
-				goto on_error;
-			}
-			read_count += 4;
+			goto on_error;
+		}
+		read_count = liblnk_io_handle_read_buffer_at_offset(
+		              internal_file->io_handle,
+		              file_io_handle,
+		              read_buffer,
+		              read_buffer_size,
+		              0,
+		              error );
 
-			break;
+		if( read_count != (ssize_t) read_buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file data at offset: 0 (0x00000000).",
+			 function );
+
+			goto on_error;
 		}
-		if( liblnk_data_block_get_signature(
-		     data_block,
-		     &data_block_signature,
+		if( liblnk_internal_file_open_memory_file_io_handle(
+		     &memory_file_io_handle,
+		     read_buffer,
+		     read_buffer_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data block signature.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open memory file IO handle.",
 			 function );
 
 			goto on_error;
 		}
-		file_offset += data_block_size;
-		read_count  += data_block_size;
-
-		switch( data_block_signature )
+		/* When an arena is used the values reference the read buffer
+		 */
+		if( arena_buffer != NULL )
 		{
-			case LIBLNK_DATA_BLOCK_SIGNATURE_ENVIRONMENT_VARIABLES_LOCATION:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "Reading environment variables location data block:\n" );
-
-					if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_ENVIRONMENT_VARIABLES_LOCATION_BLOCK ) == 0 )
-					{
-						libcnotify_printf(
-						 "%s: environment variables location data block found but data flag was not set\n",
-						 function );
-					}
-				}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-				if( internal_file->environment_variables_location_data_block == NULL )
-				{
-					internal_file->environment_variables_location_data_block = data_block;
-				}
-				if( liblnk_strings_data_block_read(
-				     data_block,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read strings in environment variables data block.",
-					 function );
+			internal_file->io_handle->flags |= LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED;
+		}
+		internal_file->io_handle->data      = read_buffer;
+		internal_file->io_handle->data_size = read_buffer_size;
 
-					goto on_error;
-				}
-				break;
+		file_io_handle = memory_file_io_handle;
+	}
+	if( liblnk_file_header_initialize_with_arena(
+	     &( internal_file->file_information ),
+	     internal_file->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
 
-			case LIBLNK_DATA_BLOCK_SIGNATURE_DISTRIBUTED_LINK_TRACKER_PROPERTIES:
+		goto on_error;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "Reading distributed link tracker properties data block:\n" );
-
-					if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_NO_DISTRIBUTED_LINK_TRACKING_DATA_BLOCK ) != 0 )
-					{
-						libcnotify_printf(
-						 "%s: distributed link tracker properties data block found but data flag was not set\n",
-						 function );
-					}
-				}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-				if( internal_file->distributed_link_tracking_data_block == NULL )
-				{
-					internal_file->distributed_link_tracking_data_block = data_block;
-				}
-				if( liblnk_distributed_link_tracking_data_block_read(
-				     data_block,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read distributed link tracking data block.",
-					 function );
-
-					goto on_error;
-				}
-				break;
-
-			case LIBLNK_DATA_BLOCK_SIGNATURE_SPECIAL_FOLDER_LOCATION:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "Reading special folder location data block:\n" );
-				}
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
 #endif
-				if( liblnk_special_folder_location_initialize(
-				     &( internal_file->special_folder_location ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create special folder location.",
-					 function );
-
-					goto on_error;
-				}
-				if( liblnk_special_folder_location_read_data_block(
-				     internal_file->special_folder_location,
-				     data_block,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read special folder location data block.",
-					 function );
+	if( liblnk_statistics_start_phase(
+	     internal_file->io_handle->statistics,
+	     &phase_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start file header phase.",
+		 function );
 
-					goto on_error;
-				}
-				break;
+		goto on_error;
+	}
+	if( liblnk_file_header_read_file_io_handle(
+	     internal_file->file_information,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
 
-			case LIBLNK_DATA_BLOCK_SIGNATURE_DARWIN_PROPERTIES:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "Reading darwin application identifier data block:\n" );
-
-					if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_DARWIN_IDENTIFIER ) == 0 )
-					{
-						libcnotify_printf(
-						 "%s: darwin application identifier data block found but data flag was not set\n",
-						 function );
-					}
-				}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+		goto on_error;
+	}
+	if( liblnk_statistics_end_phase(
+	     internal_file->io_handle->statistics,
+	     LIBLNK_STATISTICS_PHASE_FILE_HEADER,
+	     phase_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end file header phase.",
+		 function );
 
-				if( liblnk_strings_data_block_read(
-				     data_block,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read Darwin application identifier data block.",
-					 function );
+		goto on_error;
+	}
+	/* The file header is read with a single read without the IO handle
+	 */
+	if( internal_file->io_handle->data == NULL )
+	{
+		if( liblnk_statistics_add_counter(
+		     internal_file->io_handle->statistics,
+		     LIBLNK_STATISTICS_COUNTER_NUMBER_OF_READS,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add number of reads.",
+			 function );
 
-					goto on_error;
-				}
-				break;
+			goto on_error;
+		}
+		if( liblnk_statistics_add_counter(
+		     internal_file->io_handle->statistics,
+		     LIBLNK_STATISTICS_COUNTER_BYTES_READ,
+		     76,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add bytes read.",
+			 function );
 
-			case LIBLNK_DATA_BLOCK_SIGNATURE_ICON_LOCATION:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "Reading icon location data block:\n" );
-
-					if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_ICON_LOCATION_BLOCK ) == 0 )
-					{
-						libcnotify_printf(
-						 "%s: icon location data block found but data flag was not set\n",
-						 function );
-					}
-				}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+			goto on_error;
+		}
+	}
+	file_offset = 76;
 
-				if( liblnk_strings_data_block_read(
-				     data_block,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read icon location data block.",
-					 function );
+	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_IS_UNICODE ) != 0 )
+	{
+		internal_file->io_handle->is_unicode = 1;
+	}
+	else
+	{
+		internal_file->io_handle->is_unicode = 0;
+	}
+	if( ( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_LINK_TARGET_IDENTIFIER ) != 0 )
+	 && ( ( internal_file->field_mask & LIBLNK_FIELD_LINK_TARGET_IDENTIFIER ) == 0 ) )
+	{
+		if( liblnk_internal_file_skip_structure_file_io_handle(
+		     internal_file,
+		     LIBLNK_DATA_FLAG_HAS_LINK_TARGET_IDENTIFIER,
+		     file_io_handle,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to skip link target identifier.",
+			 function );
 
-					goto on_error;
-				}
-				break;
+			goto on_error;
+		}
+	}
+	else if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_LINK_TARGET_IDENTIFIER ) != 0 )
+	{
+		if( liblnk_link_target_identifier_initialize_with_arena(
+		     &( internal_file->link_target_identifier ),
+		     internal_file->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create link target identifier.",
+			 function );
 
-			case LIBLNK_DATA_BLOCK_SIGNATURE_KNOWN_FOLDER_LOCATION:
+			goto on_error;
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "Reading known folder location data block:\n" );
-				}
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading link target identifier:\n" );
+		}
 #endif
-				if( liblnk_known_folder_location_initialize(
-				     &( internal_file->known_folder_location ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create known folder location.",
-					 function );
-
-					goto on_error;
-				}
-				if( liblnk_known_folder_location_read_data_block(
-				     internal_file->known_folder_location,
-				     data_block,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read known folder location data block.",
-					 function );
-
-					goto on_error;
-				}
-				break;
+		if( liblnk_statistics_start_phase(
+		     internal_file->io_handle->statistics,
+		     &phase_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start link target identifier phase.",
+			 function );
 
-			case LIBLNK_DATA_BLOCK_SIGNATURE_METADATA_PROPERTY_STORE:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "Reading metadata property store data block:\n" );
-
-					if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_METADATA_PROPERTY_STORE_DATA_BLOCK ) == 0 )
-					{
-						libcnotify_printf(
-						 "%s: metadata property store data block found but data flag was not set\n",
-						 function );
-					}
-				}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+			goto on_error;
+		}
+		read_count = liblnk_link_target_identifier_read(
+		              internal_file->link_target_identifier,
+		              internal_file->io_handle,
+		              file_io_handle,
+		              file_offset,
+		              error );
 
-				/* TODO preserve information in file */
+		if( read_count <= -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read link target identifier.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-/* TODO add support for more than one store */
-					if( libfwps_store_initialize(
-					     &property_store,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-						 "%s: unable to create property store.",
-						 function );
-
-						goto on_error;
-					}
-					if( libfwps_store_copy_from_byte_stream(
-					     property_store,
-					     &( ( (liblnk_internal_data_block_t *) data_block )->data[ 4 ] ),
-					     ( (liblnk_internal_data_block_t *) data_block )->data_size,
-					     internal_file->io_handle->ascii_codepage,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-						 "%s: unable to copy byte stream to property store.",
-						 function );
-
-						goto on_error;
-					}
-					if( libfwps_store_free(
-					     &property_store,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-						 "%s: unable to free property store.",
-						 function );
-
-						goto on_error;
-					}
-				}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+			goto on_error;
+		}
+		if( liblnk_statistics_end_phase(
+		     internal_file->io_handle->statistics,
+		     LIBLNK_STATISTICS_PHASE_LINK_TARGET_IDENTIFIER,
+		     phase_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to end link target identifier phase.",
+			 function );
 
-				break;
+			goto on_error;
+		}
+		file_offset += read_count;
+	}
+	if( ( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_LOCATION_INFORMATION ) != 0 )
+	 && ( ( internal_file->field_mask & LIBLNK_FIELD_LOCATION_INFORMATION ) == 0 ) )
+	{
+		if( liblnk_internal_file_skip_structure_file_io_handle(
+		     internal_file,
+		     LIBLNK_DATA_FLAG_HAS_LOCATION_INFORMATION,
+		     file_io_handle,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to skip location information.",
+			 function );
 
-			default:
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: unsupported extra data block type: 0x%08" PRIx32 ".\n\n",
-					 function,
-					 data_block_signature );
-				}
-#endif
-				break;
+			goto on_error;
 		}
-		if( libcdata_array_append_entry(
-		     internal_file->data_blocks_array,
-		     &entry_index,
-		     (intptr_t *) data_block,
+	}
+	else if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_LOCATION_INFORMATION ) != 0 )
+	{
+		if( liblnk_location_information_initialize_with_arena(
+		     &( internal_file->location_information ),
+		     internal_file->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to append data block to array.",
+			 "%s: unable to create location information.",
 			 function );
 
 			goto on_error;
 		}
-		data_block = NULL;
-	}
-	return( read_count );
-
-on_error:
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( property_store != NULL )
-	{
-		libfwps_store_free(
-		 &property_store,
-		 NULL );
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading location information:\n" );
+		}
+#endif
+		if( liblnk_statistics_start_phase(
+		     internal_file->io_handle->statistics,
+		     &phase_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start location information phase.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = liblnk_location_information_read(
+		              internal_file->location_information,
+		              internal_file->io_handle,
+		              file_io_handle,
+		              file_offset,
+		              error );
+
+		if( read_count <= -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read location information.",
+			 function );
+
+			goto on_error;
+		}
+		if( liblnk_statistics_end_phase(
+		     internal_file->io_handle->statistics,
+		     LIBLNK_STATISTICS_PHASE_LOCATION_INFORMATION,
+		     phase_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to end location information phase.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset += read_count;
+	}
+	if( liblnk_statistics_start_phase(
+	     internal_file->io_handle->statistics,
+	     &phase_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start data strings phase.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_DESCRIPTION_STRING ) != 0 )
+	 && ( ( internal_file->field_mask & LIBLNK_FIELD_DATA_STRINGS ) == 0 ) )
+	{
+		if( liblnk_internal_file_skip_structure_file_io_handle(
+		     internal_file,
+		     LIBLNK_DATA_FLAG_HAS_DESCRIPTION_STRING,
+		     file_io_handle,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to skip description data string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_DESCRIPTION_STRING ) != 0 )
+	{
+		if( liblnk_data_string_initialize_with_arena(
+		     &( internal_file->description ),
+		     internal_file->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create description.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading description data string:\n" );
+		}
+#endif
+		if( liblnk_data_string_read_file_io_handle(
+		     internal_file->description,
+		     internal_file->io_handle,
+		     file_io_handle,
+		     file_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read description data string.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset += 2 + internal_file->description->data_size;
+	}
+	if( ( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_RELATIVE_PATH_STRING ) != 0 )
+	 && ( ( internal_file->field_mask & LIBLNK_FIELD_DATA_STRINGS ) == 0 ) )
+	{
+		if( liblnk_internal_file_skip_structure_file_io_handle(
+		     internal_file,
+		     LIBLNK_DATA_FLAG_HAS_RELATIVE_PATH_STRING,
+		     file_io_handle,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to skip relative path data string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_RELATIVE_PATH_STRING ) != 0 )
+	{
+		if( liblnk_data_string_initialize_with_arena(
+		     &( internal_file->relative_path ),
+		     internal_file->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create relative path.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading relative path data string:\n" );
+		}
+#endif
+		if( liblnk_data_string_read_file_io_handle(
+		     internal_file->relative_path,
+		     internal_file->io_handle,
+		     file_io_handle,
+		     file_offset,
+		     LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read relative path data string.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset += 2 + internal_file->relative_path->data_size;
+	}
+	if( ( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_WORKING_DIRECTORY_STRING ) != 0 )
+	 && ( ( internal_file->field_mask & LIBLNK_FIELD_DATA_STRINGS ) == 0 ) )
+	{
+		if( liblnk_internal_file_skip_structure_file_io_handle(
+		     internal_file,
+		     LIBLNK_DATA_FLAG_HAS_WORKING_DIRECTORY_STRING,
+		     file_io_handle,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to skip working directory data string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_WORKING_DIRECTORY_STRING ) != 0 )
+	{
+		if( liblnk_data_string_initialize_with_arena(
+		     &( internal_file->working_directory ),
+		     internal_file->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create working directory.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading working directory data string:\n" );
+		}
+#endif
+		if( liblnk_data_string_read_file_io_handle(
+		     internal_file->working_directory,
+		     internal_file->io_handle,
+		     file_io_handle,
+		     file_offset,
+		     LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read working directory data string.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset += 2 + internal_file->working_directory->data_size;
+	}
+	if( ( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_COMMAND_LINE_ARGUMENTS_STRING ) != 0 )
+	 && ( ( internal_file->field_mask & LIBLNK_FIELD_DATA_STRINGS ) == 0 ) )
+	{
+		if( liblnk_internal_file_skip_structure_file_io_handle(
+		     internal_file,
+		     LIBLNK_DATA_FLAG_HAS_COMMAND_LINE_ARGUMENTS_STRING,
+		     file_io_handle,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to skip command line arguments data string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_COMMAND_LINE_ARGUMENTS_STRING ) != 0 )
+	{
+		if( liblnk_data_string_initialize_with_arena(
+		     &( internal_file->command_line_arguments ),
+		     internal_file->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create command line arguments.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading command line arguments data string:\n" );
+		}
+#endif
+		if( liblnk_data_string_read_file_io_handle(
+		     internal_file->command_line_arguments,
+		     internal_file->io_handle,
+		     file_io_handle,
+		     file_offset,
+		     LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read command line arguments data string.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset += 2 + internal_file->command_line_arguments->data_size;
+	}
+	if( ( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_ICON_LOCATION_STRING ) != 0 )
+	 && ( ( internal_file->field_mask & LIBLNK_FIELD_DATA_STRINGS ) == 0 ) )
+	{
+		if( liblnk_internal_file_skip_structure_file_io_handle(
+		     internal_file,
+		     LIBLNK_DATA_FLAG_HAS_ICON_LOCATION_STRING,
+		     file_io_handle,
+		     &file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to skip icon location data string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_ICON_LOCATION_STRING ) != 0 )
+	{
+		if( liblnk_data_string_initialize_with_arena(
+		     &( internal_file->icon_location ),
+		     internal_file->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create icon location.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading icon location data string:\n" );
+		}
+#endif
+		if( liblnk_data_string_read_file_io_handle(
+		     internal_file->icon_location,
+		     internal_file->io_handle,
+		     file_io_handle,
+		     file_offset,
+		     LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read icon location data string.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset += 2 + internal_file->icon_location->data_size;
+	}
+	if( liblnk_statistics_end_phase(
+	     internal_file->io_handle->statistics,
+	     LIBLNK_STATISTICS_PHASE_DATA_STRINGS,
+	     phase_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end data strings phase.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_statistics_start_phase(
+	     internal_file->io_handle->statistics,
+	     &phase_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start extra data blocks phase.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_offset < (off64_t) internal_file->io_handle->file_size )
+	{
+		read_count = liblnk_internal_file_read_extra_data_blocks(
+		              internal_file,
+		              file_io_handle,
+		              file_offset,
+		              error );
+
+		if( read_count <= -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extra data blocks.",
+			 function );
+
+			goto on_error;
+		}
+		file_offset += read_count;
+	}
+	if( liblnk_statistics_end_phase(
+	     internal_file->io_handle->statistics,
+	     LIBLNK_STATISTICS_PHASE_EXTRA_DATA_BLOCKS,
+	     phase_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end extra data blocks phase.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_internal_file_cache_strings(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to cache strings.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->data_size = (size64_t) file_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( file_offset < (off64_t) internal_file->io_handle->file_size )
+		{
+			trailing_data_size = (size_t) ( internal_file->io_handle->file_size - file_offset );
+
+			if( trailing_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid trailing data size value exceed maximum allocation size.",
+				 function );
+
+				goto on_error;
+			}
+			trailing_data = (uint8_t *) memory_allocate(
+						     sizeof( uint8_t ) * trailing_data_size );
+
+			if( trailing_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create trailing data.",
+				 function );
+
+				goto on_error;
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+				      file_io_handle,
+				      trailing_data,
+				      trailing_data_size,
+				      file_offset,
+				      error );
+
+			if( read_count != (ssize_t) trailing_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read trailing data.",
+				 function );
+
+				goto on_error;
+			}
+			file_offset += read_count;
+
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 trailing_data,
+			 trailing_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			memory_free(
+			 trailing_data );
+
+			trailing_data = NULL;
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( memory_file_io_handle != NULL )
+	{
+		internal_file->io_handle->flags    &= (uint8_t) ~( LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED );
+		internal_file->io_handle->data      = NULL;
+		internal_file->io_handle->data_size = 0;
+
+		if( libbfio_handle_close(
+		     memory_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close memory file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_free(
+		     &memory_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( ( read_buffer != NULL )
+	 && ( arena_buffer == NULL ) )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( trailing_data != NULL )
+	{
+		memory_free(
+		 trailing_data );
+	}
+#endif
+	if( memory_file_io_handle != NULL )
+	{
+		internal_file->io_handle->flags    &= (uint8_t) ~( LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED );
+		internal_file->io_handle->data      = NULL;
+		internal_file->io_handle->data_size = 0;
+
+		libbfio_handle_free(
+		 &memory_file_io_handle,
+		 NULL );
+	}
+	if( ( read_buffer != NULL )
+	 && ( arena_buffer == NULL ) )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	if( internal_file->known_folder_location != NULL )
+	{
+		liblnk_known_folder_location_free(
+		 &( internal_file->known_folder_location ),
+		 NULL );
+	}
+	if( internal_file->special_folder_location != NULL )
+	{
+		liblnk_special_folder_location_free(
+		 &( internal_file->special_folder_location ),
+		 NULL );
+	}
+	if( internal_file->icon_location != NULL )
+	{
+		liblnk_data_string_free(
+		 &( internal_file->icon_location ),
+		 NULL );
+	}
+	if( internal_file->command_line_arguments != NULL )
+	{
+		liblnk_data_string_free(
+		 &( internal_file->command_line_arguments ),
+		 NULL );
+	}
+	if( internal_file->working_directory != NULL )
+	{
+		liblnk_data_string_free(
+		 &( internal_file->working_directory ),
+		 NULL );
+	}
+	if( internal_file->relative_path != NULL )
+	{
+		liblnk_data_string_free(
+		 &( internal_file->relative_path ),
+		 NULL );
+	}
+	if( internal_file->description != NULL )
+	{
+		liblnk_data_string_free(
+		 &( internal_file->description ),
+		 NULL );
+	}
+	if( internal_file->location_information != NULL )
+	{
+		liblnk_location_information_free(
+		 &( internal_file->location_information ),
+		 NULL );
+	}
+	if( internal_file->link_target_identifier != NULL )
+	{
+		liblnk_link_target_identifier_free(
+		 &( internal_file->link_target_identifier ),
+		 NULL );
+	}
+	if( internal_file->file_information != NULL )
+	{
+		liblnk_file_header_free(
+		 &( internal_file->file_information ),
+		 NULL );
+	}
+	internal_file->data_size = (size64_t) file_offset;
+
+	return( -1 );
+}
+
+/* Determines the size of a structure from its size value
+ * The data flag identifies the structure and the size includes the size value
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_get_structure_size(
+     liblnk_internal_file_t *internal_file,
+     uint32_t data_flag,
+     const uint8_t *data,
+     size_t data_size,
+     size64_t *structure_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "liblnk_internal_file_get_structure_size";
+	size_t size_value_size = 0;
+	uint32_t size_value    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( structure_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid structure size.",
+		 function );
+
+		return( -1 );
+	}
+	switch( data_flag )
+	{
+		case LIBLNK_DATA_FLAG_HAS_LOCATION_INFORMATION:
+			size_value_size = 4;
+			break;
+
+		case LIBLNK_DATA_FLAG_HAS_LINK_TARGET_IDENTIFIER:
+		case LIBLNK_DATA_FLAG_HAS_DESCRIPTION_STRING:
+		case LIBLNK_DATA_FLAG_HAS_RELATIVE_PATH_STRING:
+		case LIBLNK_DATA_FLAG_HAS_WORKING_DIRECTORY_STRING:
+		case LIBLNK_DATA_FLAG_HAS_COMMAND_LINE_ARGUMENTS_STRING:
+		case LIBLNK_DATA_FLAG_HAS_ICON_LOCATION_STRING:
+			size_value_size = 2;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported data flag: 0x%08" PRIx32 ".",
+			 function,
+			 data_flag );
+
+			return( -1 );
+	}
+	if( data_size < size_value_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value too small for structure size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size_value_size == 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 data,
+		 size_value );
+
+		/* The location information size includes the size value
+		 */
+		if( size_value < 4 )
+		{
+			size_value = 4;
+		}
+		*structure_size = (size64_t) size_value;
+	}
+	else
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 data,
+		 size_value );
+
+		/* The data string size contains the number of characters
+		 * a Unicode (UTF-16) string requires 2 bytes per character
+		 */
+		if( ( data_flag != LIBLNK_DATA_FLAG_HAS_LINK_TARGET_IDENTIFIER )
+		 && ( internal_file->io_handle->is_unicode != 0 ) )
+		{
+			size_value *= 2;
+		}
+		*structure_size = (size64_t) size_value + 2;
+	}
+	return( 1 );
+}
+
+/* Skips a structure in the file using its size value
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_skip_structure_file_io_handle(
+     liblnk_internal_file_t *internal_file,
+     uint32_t data_flag,
+     libbfio_handle_t *file_io_handle,
+     off64_t *file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t size_data[ 4 ];
+
+	static char *function   = "liblnk_internal_file_skip_structure_file_io_handle";
+	size64_t remaining_size = 0;
+	size64_t structure_size = 0;
+	size_t read_size        = 4;
+	ssize_t read_count      = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *file_offset < 0 )
+	 || ( (size64_t) *file_offset > internal_file->io_handle->file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	remaining_size = internal_file->io_handle->file_size - (size64_t) *file_offset;
+
+	if( remaining_size < (size64_t) read_size )
+	{
+		read_size = (size_t) remaining_size;
+	}
+	read_count = liblnk_io_handle_read_buffer_at_offset(
+	              internal_file->io_handle,
+	              file_io_handle,
+	              size_data,
+	              read_size,
+	              *file_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read structure size at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 *file_offset,
+		 *file_offset );
+
+		return( -1 );
+	}
+	if( liblnk_internal_file_get_structure_size(
+	     internal_file,
+	     data_flag,
+	     size_data,
+	     read_size,
+	     &structure_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve structure size.",
+		 function );
+
+		return( -1 );
+	}
+	if( structure_size > remaining_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid structure size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_offset += (off64_t) structure_size;
+
+	return( 1 );
+}
+
+/* Determines if an extra data block is skipped by the field mask
+ * The data must contain at least the 8 bytes of the data block size and signature
+ * Returns 1 if the data block is skipped, 0 if not or -1 on error
+ */
+int liblnk_internal_file_skip_extra_data_block(
+     liblnk_internal_file_t *internal_file,
+     const uint8_t *data,
+     size64_t remaining_size,
+     uint32_t *data_block_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "liblnk_internal_file_skip_extra_data_block";
+	uint32_t data_block_signature = 0;
+	uint32_t safe_data_block_size = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->field_mask & LIBLNK_FIELD_EXTRA_DATA_BLOCKS ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 data,
+	 safe_data_block_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 4 ] ),
+	 data_block_signature );
+
+	/* The terminal and invalid data blocks are handled by the regular read
+	 */
+	if( ( safe_data_block_size < 8 )
+	 || ( (size64_t) safe_data_block_size > remaining_size ) )
+	{
+		return( 0 );
+	}
+	if( ( data_block_signature == LIBLNK_DATA_BLOCK_SIGNATURE_DISTRIBUTED_LINK_TRACKER_PROPERTIES )
+	 && ( ( internal_file->field_mask & LIBLNK_FIELD_TRACKER ) != 0 ) )
+	{
+		return( 0 );
+	}
+	*data_block_size = safe_data_block_size;
+
+	return( 1 );
+}
+
+/* Reads the extra data blocks
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t liblnk_internal_file_read_extra_data_blocks(
+         liblnk_internal_file_t *internal_file,
+         libbfio_handle_t *file_io_handle,
+         off64_t file_offset,
+         libcerror_error_t **error )
+{
+	uint8_t data_block_header[ 8 ];
+
+	liblnk_data_block_t *data_block = NULL;
+	static char *function           = "liblnk_internal_file_read_extra_data_blocks";
+	ssize_t header_read_count       = 0;
+	ssize_t read_count              = 0;
+	uint32_t data_block_size        = 0;
+	int result                      = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading extra data blocks:\n" );
+	}
+#endif
+	while( file_offset < (off64_t) internal_file->io_handle->file_size )
+	{
+		/* Data blocks that are not selected by the field mask are skipped by their size
+		 */
+		if( ( ( internal_file->field_mask & LIBLNK_FIELD_EXTRA_DATA_BLOCKS ) == 0 )
+		 && ( ( internal_file->io_handle->file_size - (size64_t) file_offset ) >= 8 ) )
+		{
+			header_read_count = liblnk_io_handle_read_buffer_at_offset(
+			                     internal_file->io_handle,
+			                     file_io_handle,
+			                     data_block_header,
+			                     8,
+			                     file_offset,
+			                     error );
+
+			if( header_read_count != (ssize_t) 8 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data block header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			result = liblnk_internal_file_skip_extra_data_block(
+			          internal_file,
+			          data_block_header,
+			          internal_file->io_handle->file_size - (size64_t) file_offset,
+			          &data_block_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to determine if data block is skipped.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				file_offset += data_block_size;
+				read_count  += data_block_size;
+
+				continue;
+			}
+		}
+		if( liblnk_data_block_initialize_with_arena(
+		     &data_block,
+		     internal_file->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create data block.",
+			 function );
+
+			goto on_error;
+		}
+		data_block_size = 0;
+
+		if( ( internal_file->io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_BLOCKS_ON_DEMAND ) != 0 )
+		{
+			result = liblnk_data_block_read_header_file_io_handle(
+			          data_block,
+			          internal_file->io_handle,
+			          file_io_handle,
+			          file_offset,
+			          error );
+		}
+		else
+		{
+			result = liblnk_data_block_read_file_io_handle(
+			          data_block,
+			          internal_file->io_handle,
+			          file_io_handle,
+			          file_offset,
+			          error );
+		}
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			internal_file->io_handle->flags |= LIBLNK_IO_HANDLE_FLAG_IS_CORRUPTED;
+		}
+		else
+		{
+			if( liblnk_internal_data_block_get_size(
+			     (liblnk_internal_data_block_t *) data_block,
+			     &data_block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data block size.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( data_block_size == 0 )
+		{
+			if( liblnk_internal_data_block_free(
+			     (liblnk_internal_data_block_t **) &data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free data block.",
+				 function );
+
+				goto on_error;
+			}
+			read_count += 4;
+
+			break;
+		}
+		file_offset += data_block_size;
+		read_count  += data_block_size;
+
+		if( liblnk_internal_file_append_extra_data_block(
+		     internal_file,
+		     data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append extra data block.",
+			 function );
+
+			goto on_error;
+		}
+		data_block = NULL;
+	}
+	return( read_count );
+
+on_error:
+	if( data_block != NULL )
+	{
+		liblnk_internal_data_block_free(
+		 (liblnk_internal_data_block_t **) &data_block,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 internal_file->data_blocks_array,
+	 (int(*)(intptr_t **, libcerror_error_t **)) &liblnk_internal_data_block_free,
+	 NULL );
+
+	internal_file->environment_variables_location_data_block = NULL;
+	internal_file->distributed_link_tracking_data_block      = NULL;
+
+	return( -1 );
+}
+
+/* Appends an extra data block
+ * The values of the data block are read unless they are read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_append_extra_data_block(
+     liblnk_internal_file_t *internal_file,
+     liblnk_data_block_t *data_block,
+     libcerror_error_t **error )
+{
+	static char *function         = "liblnk_internal_file_append_extra_data_block";
+	uint32_t data_block_signature = 0;
+	int entry_index               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_data_block_get_signature(
+	     data_block,
+	     &data_block_signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data block signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_add_data_block(
+	     internal_file->io_handle->statistics,
+	     data_block_signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add data block to statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_block_signature == LIBLNK_DATA_BLOCK_SIGNATURE_ENVIRONMENT_VARIABLES_LOCATION )
+	{
+		if( internal_file->environment_variables_location_data_block == NULL )
+		{
+			internal_file->environment_variables_location_data_block = data_block;
+		}
+	}
+	else if( data_block_signature == LIBLNK_DATA_BLOCK_SIGNATURE_DISTRIBUTED_LINK_TRACKER_PROPERTIES )
+	{
+		if( internal_file->distributed_link_tracking_data_block == NULL )
+		{
+			internal_file->distributed_link_tracking_data_block = data_block;
+		}
+	}
+	if( ( internal_file->io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_BLOCKS_ON_DEMAND ) == 0 )
+	{
+		if( liblnk_internal_file_read_extra_data_block_values(
+		     internal_file,
+		     data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extra data block values.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_append_entry(
+	     internal_file->data_blocks_array,
+	     &entry_index,
+	     (intptr_t *) data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data block to array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the values of an extra data block
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_read_extra_data_block_values(
+     liblnk_internal_file_t *internal_file,
+     liblnk_data_block_t *data_block,
+     libcerror_error_t **error )
+{
+	liblnk_known_folder_location_t *known_folder_location     = NULL;
+	liblnk_special_folder_location_t *special_folder_location = NULL;
+	static char *function                                     = "liblnk_internal_file_read_extra_data_block_values";
+	uint32_t data_block_signature                             = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	libfwps_store_t *property_store                           = NULL;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_data_block_get_signature(
+	     data_block,
+	     &data_block_signature,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data block signature.",
+		 function );
+
+		goto on_error;
+	}
+	switch( data_block_signature )
+	{
+		case LIBLNK_DATA_BLOCK_SIGNATURE_ENVIRONMENT_VARIABLES_LOCATION:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading environment variables location data block:\n" );
+
+				if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_ENVIRONMENT_VARIABLES_LOCATION_BLOCK ) == 0 )
+				{
+					libcnotify_printf(
+					 "%s: environment variables location data block found but data flag was not set\n",
+					 function );
+				}
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			if( liblnk_strings_data_block_read(
+			     data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read strings in environment variables data block.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBLNK_DATA_BLOCK_SIGNATURE_DISTRIBUTED_LINK_TRACKER_PROPERTIES:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading distributed link tracker properties data block:\n" );
+
+				if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_NO_DISTRIBUTED_LINK_TRACKING_DATA_BLOCK ) != 0 )
+				{
+					libcnotify_printf(
+					 "%s: distributed link tracker properties data block found but data flag was not set\n",
+					 function );
+				}
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			if( liblnk_distributed_link_tracking_data_block_read(
+			     data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read distributed link tracking data block.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBLNK_DATA_BLOCK_SIGNATURE_SPECIAL_FOLDER_LOCATION:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading special folder location data block:\n" );
+			}
+#endif
+			if( internal_file->special_folder_location != NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+				 "%s: invalid file - special folder location value already set.",
+				 function );
+
+				goto on_error;
+			}
+			if( liblnk_special_folder_location_initialize(
+			     &special_folder_location,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create special folder location.",
+				 function );
+
+				goto on_error;
+			}
+			if( liblnk_special_folder_location_read_data_block(
+			     special_folder_location,
+			     data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read special folder location data block.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file->special_folder_location = special_folder_location;
+			special_folder_location                = NULL;
+
+			break;
+
+		case LIBLNK_DATA_BLOCK_SIGNATURE_DARWIN_PROPERTIES:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading darwin application identifier data block:\n" );
+
+				if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_DARWIN_IDENTIFIER ) == 0 )
+				{
+					libcnotify_printf(
+					 "%s: darwin application identifier data block found but data flag was not set\n",
+					 function );
+				}
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			if( liblnk_strings_data_block_read(
+			     data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read Darwin application identifier data block.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBLNK_DATA_BLOCK_SIGNATURE_ICON_LOCATION:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading icon location data block:\n" );
+
+				if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_ICON_LOCATION_BLOCK ) == 0 )
+				{
+					libcnotify_printf(
+					 "%s: icon location data block found but data flag was not set\n",
+					 function );
+				}
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			if( liblnk_strings_data_block_read(
+			     data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read icon location data block.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBLNK_DATA_BLOCK_SIGNATURE_KNOWN_FOLDER_LOCATION:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading known folder location data block:\n" );
+			}
+#endif
+			if( internal_file->known_folder_location != NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+				 "%s: invalid file - known folder location value already set.",
+				 function );
+
+				goto on_error;
+			}
+			if( liblnk_known_folder_location_initialize(
+			     &known_folder_location,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create known folder location.",
+				 function );
+
+				goto on_error;
+			}
+			if( liblnk_known_folder_location_read_data_block(
+			     known_folder_location,
+			     data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read known folder location data block.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file->known_folder_location = known_folder_location;
+			known_folder_location                = NULL;
+
+			break;
+
+		case LIBLNK_DATA_BLOCK_SIGNATURE_METADATA_PROPERTY_STORE:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading metadata property store data block:\n" );
+
+				if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_METADATA_PROPERTY_STORE_DATA_BLOCK ) == 0 )
+				{
+					libcnotify_printf(
+					 "%s: metadata property store data block found but data flag was not set\n",
+					 function );
+				}
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			/* TODO preserve information in file */
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+/* TODO add support for more than one store */
+				if( libfwps_store_initialize(
+				     &property_store,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create property store.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfwps_store_copy_from_byte_stream(
+				     property_store,
+				     &( ( (liblnk_internal_data_block_t *) data_block )->data[ 4 ] ),
+				     ( (liblnk_internal_data_block_t *) data_block )->data_size,
+				     internal_file->io_handle->ascii_codepage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy byte stream to property store.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfwps_store_free(
+				     &property_store,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free property store.",
+					 function );
+
+					goto on_error;
+				}
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			break;
+
+		default:
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unsupported extra data block type: 0x%08" PRIx32 ".\n\n",
+				 function,
+				 data_block_signature );
+			}
+#endif
+			break;
+	}
+	( (liblnk_internal_data_block_t *) data_block )->values_read = 1;
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( property_store != NULL )
+	{
+		libfwps_store_free(
+		 &property_store,
+		 NULL );
+	}
+#endif
+	if( known_folder_location != NULL )
+	{
+		liblnk_known_folder_location_free(
+		 &known_folder_location,
+		 NULL );
+	}
+	if( special_folder_location != NULL )
+	{
+		liblnk_special_folder_location_free(
+		 &special_folder_location,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the values of an extra data block that were not read on open
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_read_data_block_on_demand(
+     liblnk_internal_file_t *internal_file,
+     liblnk_data_block_t *data_block,
+     libcerror_error_t **error )
+{
+	liblnk_internal_data_block_t *internal_data_block = NULL;
+	static char *function                             = "liblnk_internal_file_read_data_block_on_demand";
+	int result                                        = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_block == NULL )
+	 || ( ( internal_file->io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_BLOCKS_ON_DEMAND ) == 0 ) )
+	{
+		return( 1 );
+	}
+	internal_data_block = (liblnk_internal_data_block_t *) data_block;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_data_block->values_read == 0 )
+	{
+		if( internal_data_block->data == NULL )
+		{
+			if( internal_file->file_io_handle == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid file - missing file IO handle.",
+				 function );
+
+				result = -1;
+			}
+			else if( liblnk_data_block_read_data_file_io_handle(
+			          data_block,
+			          internal_file->io_handle,
+			          internal_file->file_io_handle,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data block data.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( result == 1 )
+		{
+			if( liblnk_internal_file_read_extra_data_block_values(
+			     internal_file,
+			     data_block,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read extra data block values.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Converts the data strings and location information paths and caches the results
+ * The caches are only filled on open and when the codepage changes, hence
+ * the retrieval functions only read them and do not lock a frozen file
+ * Strings that cannot be converted are not cached, the retrieval functions
+ * convert these on demand and report the conversion error
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_cache_strings(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	liblnk_data_string_t *data_strings[ 5 ];
+
+	static char *function    = "liblnk_internal_file_cache_strings";
+	uint64_t start_timestamp = 0;
+	int data_string_index    = 0;
+	int path_type            = 0;
+	uint8_t is_path          = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	data_strings[ 0 ] = internal_file->description;
+	data_strings[ 1 ] = internal_file->relative_path;
+	data_strings[ 2 ] = internal_file->working_directory;
+	data_strings[ 3 ] = internal_file->command_line_arguments;
+	data_strings[ 4 ] = internal_file->icon_location;
+
+	if( liblnk_statistics_start_phase(
+	     internal_file->io_handle->statistics,
+	     &start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start string conversion phase.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_string_index = 0;
+	     data_string_index < 5;
+	     data_string_index++ )
+	{
+		if( data_strings[ data_string_index ] == NULL )
+		{
+			continue;
+		}
+		/* Only the description is not retrieved as a path string
+		 */
+		is_path = (uint8_t) ( data_string_index != 0 );
+
+		liblnk_data_string_cache_string(
+		 data_strings[ data_string_index ],
+		 internal_file->io_handle->ascii_codepage,
+		 LIBLNK_DATA_STRING_FORMAT_UTF8,
+		 is_path,
+		 NULL );
+
+		liblnk_data_string_cache_string(
+		 data_strings[ data_string_index ],
+		 internal_file->io_handle->ascii_codepage,
+		 LIBLNK_DATA_STRING_FORMAT_UTF16,
+		 is_path,
+		 NULL );
+	}
+	if( internal_file->location_information != NULL )
+	{
+		for( path_type = LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL;
+		     path_type <= LIBLNK_LOCATION_INFORMATION_PATH_TYPE_NETWORK;
+		     path_type++ )
+		{
+			liblnk_location_information_cache_path(
+			 internal_file->location_information,
+			 internal_file->io_handle->ascii_codepage,
+			 path_type,
+			 LIBLNK_DATA_STRING_FORMAT_UTF8,
+			 NULL );
+
+			liblnk_location_information_cache_path(
+			 internal_file->location_information,
+			 internal_file->io_handle->ascii_codepage,
+			 path_type,
+			 LIBLNK_DATA_STRING_FORMAT_UTF16,
+			 NULL );
+		}
+	}
+	if( liblnk_statistics_end_phase(
+	     internal_file->io_handle->statistics,
+	     LIBLNK_STATISTICS_PHASE_STRING_CONVERSION,
+	     start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end string conversion phase.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Clears the cached strings of the data strings and location information
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_clear_string_caches(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	liblnk_data_string_t *data_strings[ 5 ];
+
+	static char *function = "liblnk_internal_file_clear_string_caches";
+	int data_string_index = 0;
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	data_strings[ 0 ] = internal_file->description;
+	data_strings[ 1 ] = internal_file->relative_path;
+	data_strings[ 2 ] = internal_file->working_directory;
+	data_strings[ 3 ] = internal_file->command_line_arguments;
+	data_strings[ 4 ] = internal_file->icon_location;
+
+	for( data_string_index = 0;
+	     data_string_index < 5;
+	     data_string_index++ )
+	{
+		if( data_strings[ data_string_index ] == NULL )
+		{
+			continue;
+		}
+		if( liblnk_data_string_clear_cache(
+		     data_strings[ data_string_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear data string: %d cache.",
+			 function,
+			 data_string_index );
+
+			result = -1;
+		}
+	}
+	if( internal_file->location_information != NULL )
+	{
+		if( liblnk_location_information_clear_cache(
+		     internal_file->location_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear location information cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+
+/* Grabs the read/write lock for reading
+ * The lock is not grabbed when the file is frozen
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_grab_for_read(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_internal_file_grab_for_read";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->is_frozen != 0 )
+	{
+		return( 1 );
+	}
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases the read/write lock for reading
+ * The lock is not released when the file is frozen
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_internal_file_release_for_read(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_internal_file_release_for_read";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->is_frozen != 0 )
+	{
+		return( 1 );
+	}
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#endif /* defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_get_ascii_codepage(
+     liblnk_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the file ASCII codepage
+ * The string caches are refilled while holding the read/write lock for writing,
+ * the retrieval functions do not lock a frozen file, hence the codepage must
+ * not be changed while the file is accessed by other threads
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_set_ascii_codepage(
+     liblnk_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_set_ascii_codepage";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBLNK_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ascii_codepage != internal_file->io_handle->ascii_codepage )
+	{
+		if( liblnk_internal_file_clear_string_caches(
+		     internal_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear string caches.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			internal_file->io_handle->ascii_codepage = ascii_codepage;
+
+			if( liblnk_internal_file_cache_strings(
+			     internal_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to cache strings.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the maximum size of a file that is read into a single buffer on open
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_get_maximum_read_buffer_size(
+     liblnk_file_t *file,
+     size_t *maximum_read_buffer_size,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_maximum_read_buffer_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( maximum_read_buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum read buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_read_buffer_size = internal_file->maximum_read_buffer_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum size of a file that is read into a single buffer on open
+ * A value of 0 disables reading the file into a single buffer
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_set_maximum_read_buffer_size(
+     liblnk_file_t *file,
+     size_t maximum_read_buffer_size,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_set_maximum_read_buffer_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( maximum_read_buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum read buffer size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->maximum_read_buffer_size = maximum_read_buffer_size;
+
+	return( 1 );
+}
+
+/* Retrieves the value to indicate if memory is retained on close
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_get_retain_capacity(
+     liblnk_file_t *file,
+     uint8_t *retain_capacity,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_retain_capacity";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( retain_capacity == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid retain capacity.",
+		 function );
+
+		return( -1 );
+	}
+	*retain_capacity = internal_file->retain_capacity;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate if memory is retained on close
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_set_retain_capacity(
+     liblnk_file_t *file,
+     uint8_t retain_capacity,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_set_retain_capacity";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( retain_capacity > 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported retain capacity.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->retain_capacity = retain_capacity;
+
+	return( 1 );
+}
+
+/* Retrieves the field mask
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_get_field_mask(
+     liblnk_file_t *file,
+     uint32_t *field_mask,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_field_mask";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( field_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field mask.",
+		 function );
+
+		return( -1 );
+	}
+	*field_mask = internal_file->field_mask;
+
+	return( 1 );
+}
+
+/* Sets the field mask
+ * The field mask selects the structures that are read by the next open,
+ * the structures that are not selected are skipped by their size and
+ * are reported as not available. The file header is always read
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_set_field_mask(
+     liblnk_file_t *file,
+     uint32_t field_mask,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_set_field_mask";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( ( field_mask & ~( LIBLNK_FIELD_ALL ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported field mask.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->field_mask = field_mask | LIBLNK_FIELD_HEADER;
+
+	return( 1 );
+}
+
+/* Determine if the file corrupted
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int liblnk_file_is_corrupted(
+     liblnk_file_t *file,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_is_corrupted";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->io_handle->flags & LIBLNK_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the statistics
+ * The statistics are collected from when the file was opened with
+ * LIBLNK_ACCESS_FLAG_COLLECT_STATISTICS and are copied into statistics
+ * Returns 1 if successful, 0 if no statistics were collected or -1 on error
+ */
+int liblnk_file_get_statistics(
+     liblnk_file_t *file,
+     liblnk_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_statistics";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->statistics != NULL )
+	{
+		result = liblnk_statistics_copy(
+		          (liblnk_internal_statistics_t *) statistics,
+		          internal_file->statistics,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy statistics.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* -------------------------------------------------------------------------
+ * Link information functions
+ * ------------------------------------------------------------------------- */
+
+/* Retrieves the data flags
+ * The data flags contain information about the available link information
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_get_data_flags(
+     liblnk_file_t *file,
+     uint32_t *data_flags,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_data_flags";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data flags.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*data_flags = internal_file->file_information->data_flags;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the size of the data
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_get_data_size(
+     liblnk_file_t *file,
+     size64_t *data_size,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_data_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*data_size = internal_file->data_size;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Determines if the link refers to a file
+ * Returns 1 if the link refers to a file, 0 if not or -1 on error
+ */
+int liblnk_file_link_refers_to_file(
+     liblnk_file_t *file,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_link_refers_to_file";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_LOCATION_INFORMATION ) != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the 64-bit filetime value containing the linked file's creation date and time
+ * The creation time is only set when the link refers to a file
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_get_file_creation_time(
+     liblnk_file_t *file,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_file_creation_time";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*filetime = internal_file->file_information->creation_time;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the 64-bit filetime value containing the linked file's last modification date and time
+ * The modification time is only set when the link refers to a file
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_get_file_modification_time(
+     liblnk_file_t *file,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_file_modification_time";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*filetime = internal_file->file_information->modification_time;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the 64-bit filetime value containing the linked file's last access date and time
+ * The access time is only set when the link refers to a file
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_get_file_access_time(
+     liblnk_file_t *file,
+     uint64_t *filetime,
+     libcerror_error_t **error )
+{
+	liblnk_internal_file_t *internal_file = NULL;
+	static char *function                 = "liblnk_file_get_file_access_time";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filetime.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*filetime = internal_file->file_information->access_time;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
 #endif
-	if( data_block != NULL )
-	{
-		liblnk_internal_data_block_free(
-		 (liblnk_internal_data_block_t **) &data_block,
-		 NULL );
-	}
-	libcdata_array_empty(
-	 internal_file->data_blocks_array,
-	 (int(*)(intptr_t **, libcerror_error_t **)) &liblnk_internal_data_block_free,
-	 NULL );
-
-	internal_file->environment_variables_location_data_block = NULL;
-	internal_file->distributed_link_tracking_data_block      = NULL;
-
-	return( -1 );
+	return( 1 );
 }
 
-/* Retrieves the file ASCII codepage
+/* Retrieves the linked file's size
+ * The file size is only set if the link refers to a file
  * Returns 1 if successful or -1 on error
  */
-int liblnk_file_get_ascii_codepage(
+int liblnk_file_get_file_size(
      liblnk_file_t *file,
-     int *ascii_codepage,
+     uint32_t *file_size,
      libcerror_error_t **error )
 {
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_ascii_codepage";
+	static char *function                 = "liblnk_file_get_file_size";
 
 	if( file == NULL )
 	{
@@ -2188,43 +5715,73 @@ int liblnk_file_get_ascii_codepage(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_information == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file information.",
 		 function );
 
 		return( -1 );
 	}
-	if( ascii_codepage == NULL )
+	if( file_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 "%s: invalid file size.",
 		 function );
 
 		return( -1 );
 	}
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*file_size = internal_file->file_information->file_size;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
+		return( -1 );
+	}
+#endif
 	return( 1 );
 }
 
-/* Sets the file ASCII codepage
+/* Retrieves the icon index
  * Returns 1 if successful or -1 on error
  */
-int liblnk_file_set_ascii_codepage(
+int liblnk_file_get_icon_index(
      liblnk_file_t *file,
-     int ascii_codepage,
+     uint32_t *icon_index,
      libcerror_error_t **error )
 {
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_set_ascii_codepage";
+	static char *function                 = "liblnk_file_get_icon_index";
 
 	if( file == NULL )
 	{
@@ -2239,57 +5796,73 @@ int liblnk_file_set_ascii_codepage(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_information == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file information.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBLNK_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBLNK_CODEPAGE_WINDOWS_1258 ) )
+	if( icon_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid icon index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file->io_handle->ascii_codepage = ascii_codepage;
+#endif
+	*icon_index = internal_file->file_information->icon_index;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
+		return( -1 );
+	}
+#endif
 	return( 1 );
 }
 
-/* Determine if the file corrupted
- * Returns 1 if corrupted, 0 if not or -1 on error
+/* Retrieves the show window value
+ * Returns 1 if successful or -1 on error
  */
-int liblnk_file_is_corrupted(
+int liblnk_file_get_show_window_value(
      liblnk_file_t *file,
+     uint32_t *show_window_value,
      libcerror_error_t **error )
 {
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_is_corrupted";
-	int result                            = 0;
+	static char *function                 = "liblnk_file_get_show_window_value";
 
 	if( file == NULL )
 	{
@@ -2304,20 +5877,31 @@ int liblnk_file_is_corrupted(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_information == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( show_window_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid show window value.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2330,13 +5914,11 @@ int liblnk_file_is_corrupted(
 		return( -1 );
 	}
 #endif
-	if( ( internal_file->io_handle->flags & LIBLNK_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
-	{
-		result = 1;
-	}
+	*show_window_value = internal_file->file_information->show_window;
+
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2349,24 +5931,19 @@ int liblnk_file_is_corrupted(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
-/* -------------------------------------------------------------------------
- * Link information functions
- * ------------------------------------------------------------------------- */
-
-/* Retrieves the data flags
- * The data flags contain information about the available link information
+/* Retrieves the hot key value
  * Returns 1 if successful or -1 on error
  */
-int liblnk_file_get_data_flags(
+int liblnk_file_get_hot_key_value(
      liblnk_file_t *file,
-     uint32_t *data_flags,
+     uint16_t *hot_key_value,
      libcerror_error_t **error )
 {
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_data_flags";
+	static char *function                 = "liblnk_file_get_hot_key_value";
 
 	if( file == NULL )
 	{
@@ -2392,20 +5969,20 @@ int liblnk_file_get_data_flags(
 
 		return( -1 );
 	}
-	if( data_flags == NULL )
+	if( hot_key_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data flags.",
+		 "%s: invalid hot key value.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2418,11 +5995,11 @@ int liblnk_file_get_data_flags(
 		return( -1 );
 	}
 #endif
-	*data_flags = internal_file->file_information->data_flags;
+	*hot_key_value = internal_file->file_information->hot_key;
 
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2438,16 +6015,17 @@ int liblnk_file_get_data_flags(
 	return( 1 );
 }
 
-/* Retrieves the size of the data
+/* Retrieves the linked file's attribute flags
+ * The file attribute flags are only set if the link refers to a file
  * Returns 1 if successful or -1 on error
  */
-int liblnk_file_get_data_size(
+int liblnk_file_get_file_attribute_flags(
      liblnk_file_t *file,
-     size64_t *data_size,
+     uint32_t *file_attribute_flags,
      libcerror_error_t **error )
 {
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_data_size";
+	static char *function                 = "liblnk_file_get_file_attribute_flags";
 
 	if( file == NULL )
 	{
@@ -2462,20 +6040,31 @@ int liblnk_file_get_data_size(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
-	if( data_size == NULL )
+	if( internal_file->file_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file information.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_attribute_flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data size.",
+		 "%s: invalid file attribute flags.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2488,11 +6077,11 @@ int liblnk_file_get_data_size(
 		return( -1 );
 	}
 #endif
-	*data_size = internal_file->data_size;
+	*file_attribute_flags = internal_file->file_information->file_attribute_flags;
 
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2508,15 +6097,17 @@ int liblnk_file_get_data_size(
 	return( 1 );
 }
 
-/* Determines if the link refers to a file
- * Returns 1 if the link refers to a file, 0 if not or -1 on error
+/* Retrieves the drive type
+ * The drive type is only set if the link refers to a file on a local volume
+ * Returns 1 if successful, 0 if value is not available or -1 on error
  */
-int liblnk_file_link_refers_to_file(
+int liblnk_file_get_drive_type(
      liblnk_file_t *file,
+     uint32_t *drive_type,
      libcerror_error_t **error )
 {
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_link_refers_to_file";
+	static char *function                 = "liblnk_file_get_drive_type";
 	int result                            = 0;
 
 	if( file == NULL )
@@ -2543,9 +6134,20 @@ int liblnk_file_link_refers_to_file(
 
 		return( -1 );
 	}
+	if( drive_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid drive type.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2558,13 +6160,15 @@ int liblnk_file_link_refers_to_file(
 		return( -1 );
 	}
 #endif
-	if( ( internal_file->file_information->data_flags & LIBLNK_DATA_FLAG_HAS_LOCATION_INFORMATION ) != 0 )
+	if( internal_file->location_information != NULL )
 	{
+		*drive_type = internal_file->location_information->drive_type;
+
 		result = 1;
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2578,19 +6182,20 @@ int liblnk_file_link_refers_to_file(
 	}
 #endif
 	return( result );
-}
-
-/* Retrieves the 64-bit filetime value containing the linked file's creation date and time
- * The creation time is only set when the link refers to a file
- * Returns 1 if successful or -1 on error
+}
+
+/* Retrieves the drive serial number
+ * The drive serial number is only set if the link refers to a file on a local volume
+ * Returns 1 if successful, 0 if value is not available or -1 on error
  */
-int liblnk_file_get_file_creation_time(
+int liblnk_file_get_drive_serial_number(
      liblnk_file_t *file,
-     uint64_t *filetime,
+     uint32_t *drive_serial_number,
      libcerror_error_t **error )
 {
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_file_creation_time";
+	static char *function                 = "liblnk_file_get_drive_serial_number";
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -2605,31 +6210,31 @@ int liblnk_file_get_file_creation_time(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
-	if( internal_file->file_information == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file information.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( filetime == NULL )
+	if( drive_serial_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filetime.",
+		 "%s: invalid drive serial number.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2642,11 +6247,15 @@ int liblnk_file_get_file_creation_time(
 		return( -1 );
 	}
 #endif
-	*filetime = internal_file->file_information->creation_time;
+	if( internal_file->location_information != NULL )
+	{
+		*drive_serial_number = internal_file->location_information->drive_serial_number;
 
+		result = 1;
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2659,22 +6268,26 @@ int liblnk_file_get_file_creation_time(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the 64-bit filetime value containing the linked file's last modification date and time
- * The modification time is only set when the link refers to a file
- * Returns 1 if successful or -1 on error
+/* TODO add raw string functions */
+
+/* Retrieves the size of a UTF-8 encoded string by identifier
+ * The size includes the end of string character
+ * This function does not lock the file
+ * Returns 1 if successful, 0 if value is not available or -1 on error
  */
-int liblnk_file_get_file_modification_time(
-     liblnk_file_t *file,
-     uint64_t *filetime,
+int liblnk_internal_file_get_utf8_string_size(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_file_modification_time";
+	static char *function = "liblnk_internal_file_get_utf8_string_size";
+	int result            = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2685,239 +6298,587 @@ int liblnk_file_get_file_modification_time(
 
 		return( -1 );
 	}
-	internal_file = (liblnk_internal_file_t *) file;
-
-	if( internal_file->file_information == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file information.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( filetime == NULL )
+	switch( string_identifier )
+	{
+		case LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf8_volume_label_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_LOCAL_PATH:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf8_local_path_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_NETWORK_PATH:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf8_network_path_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_DESCRIPTION:
+			if( internal_file->description != NULL )
+			{
+				result = liblnk_data_string_get_utf8_string_size(
+				          internal_file->description,
+				          internal_file->io_handle->ascii_codepage,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_RELATIVE_PATH:
+			if( internal_file->relative_path != NULL )
+			{
+				result = liblnk_data_string_get_utf8_path_string_size(
+				          internal_file->relative_path,
+				          internal_file->io_handle->ascii_codepage,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_WORKING_DIRECTORY:
+			if( internal_file->working_directory != NULL )
+			{
+				result = liblnk_data_string_get_utf8_path_string_size(
+				          internal_file->working_directory,
+				          internal_file->io_handle->ascii_codepage,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_COMMAND_LINE_ARGUMENTS:
+			if( internal_file->command_line_arguments != NULL )
+			{
+				result = liblnk_data_string_get_utf8_path_string_size(
+				          internal_file->command_line_arguments,
+				          internal_file->io_handle->ascii_codepage,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_ICON_LOCATION:
+			if( internal_file->icon_location != NULL )
+			{
+				result = liblnk_data_string_get_utf8_path_string_size(
+				          internal_file->icon_location,
+				          internal_file->io_handle->ascii_codepage,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_ENVIRONMENT_VARIABLES_LOCATION:
+			if( internal_file->environment_variables_location_data_block != NULL )
+			{
+				result = liblnk_strings_data_block_get_utf8_path_string_size(
+				          internal_file->environment_variables_location_data_block,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_MACHINE_IDENTIFIER:
+			if( internal_file->distributed_link_tracking_data_block != NULL )
+			{
+				result = liblnk_distributed_link_tracking_data_block_get_utf8_machine_identifier_size(
+				          internal_file->distributed_link_tracking_data_block,
+				          utf8_string_size,
+				          error );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported string identifier: %d.",
+			 function,
+			 string_identifier );
+
+			return( -1 );
+	}
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filetime.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %d size.",
+		 function,
+		 string_identifier );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	return( result );
+}
+
+/* Retrieves a UTF-8 encoded string by identifier
+ * The string is copied at the string index, which is set to the index after the end of string character
+ * The volume label, environment variables location and machine identifier are
+ * converted directly into the string, the other strings are copied from the caches
+ * This function does not lock the file
+ * Returns 1 if successful, 0 if value is not available or -1 on error
+ */
+int liblnk_internal_file_get_utf8_string_with_index(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	liblnk_data_string_t *data_string                 = NULL;
+	liblnk_internal_data_block_t *internal_data_block = NULL;
+	static char *function                             = "liblnk_internal_file_get_utf8_string_with_index";
+	size_t safe_string_size                           = 0;
+	int result                                        = 0;
+	uint8_t is_path                                   = 1;
+
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*filetime = internal_file->file_information->modification_time;
-
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
-}
-
-/* Retrieves the 64-bit filetime value containing the linked file's last access date and time
- * The access time is only set when the link refers to a file
- * Returns 1 if successful or -1 on error
- */
-int liblnk_file_get_file_access_time(
-     liblnk_file_t *file,
-     uint64_t *filetime,
-     libcerror_error_t **error )
-{
-	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_file_access_time";
-
-	if( file == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (liblnk_internal_file_t *) file;
-
-	if( internal_file->file_information == NULL )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file information.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( filetime == NULL )
+	if( utf8_string_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filetime.",
+		 "%s: invalid UTF-8 string index.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( *utf8_string_index >= utf8_string_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*filetime = internal_file->file_information->access_time;
+	switch( string_identifier )
+	{
+		case LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf8_volume_label_with_index(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          utf8_string,
+				          utf8_string_size,
+				          utf8_string_index,
+				          error );
+			}
+			break;
 
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+		case LIBLNK_STRING_IDENTIFIER_LOCAL_PATH:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf8_local_path_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          &safe_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_NETWORK_PATH:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf8_network_path_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          &safe_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_DESCRIPTION:
+			data_string = internal_file->description;
+			is_path     = 0;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_RELATIVE_PATH:
+			data_string = internal_file->relative_path;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_WORKING_DIRECTORY:
+			data_string = internal_file->working_directory;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_COMMAND_LINE_ARGUMENTS:
+			data_string = internal_file->command_line_arguments;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_ICON_LOCATION:
+			data_string = internal_file->icon_location;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_ENVIRONMENT_VARIABLES_LOCATION:
+			internal_data_block = (liblnk_internal_data_block_t *) internal_file->environment_variables_location_data_block;
+
+			if( ( internal_data_block != NULL )
+			 && ( internal_data_block->value != NULL ) )
+			{
+				result = liblnk_data_string_get_utf8_path_string_with_index(
+				          (liblnk_data_string_t *) internal_data_block->value,
+				          internal_data_block->ascii_codepage,
+				          utf8_string,
+				          utf8_string_size,
+				          utf8_string_index,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_MACHINE_IDENTIFIER:
+			internal_data_block = (liblnk_internal_data_block_t *) internal_file->distributed_link_tracking_data_block;
+
+			if( ( internal_data_block != NULL )
+			 && ( internal_data_block->value != NULL ) )
+			{
+				result = liblnk_distributed_link_tracker_properties_get_utf8_machine_identifier_with_index(
+				          (liblnk_distributed_link_tracker_properties_t *) internal_data_block->value,
+				          utf8_string,
+				          utf8_string_size,
+				          utf8_string_index,
+				          internal_data_block->ascii_codepage,
+				          error );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported string identifier: %d.",
+			 function,
+			 string_identifier );
+
+			return( -1 );
+	}
+	if( data_string != NULL )
+	{
+		if( is_path != 0 )
+		{
+			result = liblnk_data_string_get_utf8_path_string_size(
+			          data_string,
+			          internal_file->io_handle->ascii_codepage,
+			          &safe_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_data_string_get_utf8_string_size(
+			          data_string,
+			          internal_file->io_handle->ascii_codepage,
+			          &safe_string_size,
+			          error );
+		}
+	}
+	/* The cached strings are copied after their size is checked
+	 */
+	if( ( result == 1 )
+	 && ( safe_string_size > 0 ) )
+	{
+		if( safe_string_size > ( utf8_string_size - *utf8_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_string == NULL )
+		{
+			if( string_identifier == LIBLNK_STRING_IDENTIFIER_LOCAL_PATH )
+			{
+				result = liblnk_location_information_get_utf8_local_path(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          &( utf8_string[ *utf8_string_index ] ),
+				          utf8_string_size - *utf8_string_index,
+				          error );
+			}
+			else
+			{
+				result = liblnk_location_information_get_utf8_network_path(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          &( utf8_string[ *utf8_string_index ] ),
+				          utf8_string_size - *utf8_string_index,
+				          error );
+			}
+		}
+		else if( is_path != 0 )
+		{
+			result = liblnk_data_string_get_utf8_path_string(
+			          data_string,
+			          internal_file->io_handle->ascii_codepage,
+			          &( utf8_string[ *utf8_string_index ] ),
+			          utf8_string_size - *utf8_string_index,
+			          error );
+		}
+		else
+		{
+			result = liblnk_data_string_get_utf8_string(
+			          data_string,
+			          internal_file->io_handle->ascii_codepage,
+			          &( utf8_string[ *utf8_string_index ] ),
+			          utf8_string_size - *utf8_string_index,
+			          error );
+		}
+		if( result == 1 )
+		{
+			*utf8_string_index += safe_string_size;
+		}
+	}
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %d.",
+		 function,
+		 string_identifier );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the linked file's size
- * The file size is only set if the link refers to a file
- * Returns 1 if successful or -1 on error
+/* Retrieves the truncated UTF-8 encoded string by identifier
+ * The string is truncated to fit utf8_string_size without splitting a character
+ * and is terminated by an end of string character
+ * This function does not lock the file
+ * Returns 1 if successful, 0 if value is not available or -1 on error
  */
-int liblnk_file_get_file_size(
-     liblnk_file_t *file,
-     uint32_t *file_size,
+int liblnk_internal_file_get_truncated_utf8_string(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     size_t string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_file_size";
+	uint8_t *safe_string  = NULL;
+	static char *function = "liblnk_internal_file_get_truncated_utf8_string";
+	size_t string_index   = 0;
+	int result            = 0;
 
-	if( file == NULL )
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (liblnk_internal_file_t *) file;
-
-	if( internal_file->file_information == NULL )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file information.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_size == NULL )
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size >= string_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file size.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	safe_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * string_size );
+
+	if( safe_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	*file_size = internal_file->file_information->file_size;
+	result = liblnk_internal_file_get_utf8_string_with_index(
+	          internal_file,
+	          string_identifier,
+	          safe_string,
+	          string_size,
+	          &string_index,
+	          error );
 
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %d.",
+		 function,
+		 string_identifier );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( 1 );
+	else if( result != 0 )
+	{
+		/* Do not split a multi byte character
+		 */
+		string_index = utf8_string_size - 1;
+
+		while( ( string_index > 0 )
+		    && ( ( safe_string[ string_index ] & 0xc0 ) == 0x80 ) )
+		{
+			string_index--;
+		}
+		if( memory_copy(
+		     utf8_string,
+		     safe_string,
+		     sizeof( uint8_t ) * string_index ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_string[ string_index ] = 0;
+	}
+	memory_free(
+	 safe_string );
+
+	return( result );
+
+on_error:
+	if( safe_string != NULL )
+	{
+		memory_free(
+		 safe_string );
+	}
+	return( -1 );
 }
 
-/* Retrieves the icon index
- * Returns 1 if successful or -1 on error
+/* Retrieves a UTF-8 encoded string by identifier in a single call
+ * The string identifier is one of the LIBLNK_STRING_IDENTIFIER_* definitions
+ * The required utf8_string_size is set to the size of the string including
+ * the end of string character. If utf8_string is set the string is copied,
+ * if utf8_string_size is too small the string is truncated without splitting
+ * a character and terminated by an end of string character
+ * Returns 1 if successful, 0 if value is not available or -1 on error
  */
-int liblnk_file_get_icon_index(
+int liblnk_file_get_utf8_string(
      liblnk_file_t *file,
-     uint32_t *icon_index,
+     int string_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
      libcerror_error_t **error )
 {
+	liblnk_data_block_t *data_block       = NULL;
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_icon_index";
+	static char *function                 = "liblnk_file_get_utf8_string";
+	size_t safe_string_size               = 0;
+	size_t string_index                   = 0;
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -2932,31 +6893,53 @@ int liblnk_file_get_icon_index(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
-	if( internal_file->file_information == NULL )
+	if( utf8_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file information.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( icon_index == NULL )
+	if( required_utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid icon index.",
+		 "%s: invalid required UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_identifier == LIBLNK_STRING_IDENTIFIER_ENVIRONMENT_VARIABLES_LOCATION )
+	{
+		data_block = internal_file->environment_variables_location_data_block;
+	}
+	else if( string_identifier == LIBLNK_STRING_IDENTIFIER_MACHINE_IDENTIFIER )
+	{
+		data_block = internal_file->distributed_link_tracking_data_block;
+	}
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2969,11 +6952,74 @@ int liblnk_file_get_icon_index(
 		return( -1 );
 	}
 #endif
-	*icon_index = internal_file->file_information->icon_index;
+	/* The string is converted or copied directly into utf8_string, the size is
+	 * only retrieved separately if utf8_string is not set or too small
+	 */
+	if( ( utf8_string != NULL )
+	 && ( utf8_string_size > 0 ) )
+	{
+		result = liblnk_internal_file_get_utf8_string_with_index(
+		          internal_file,
+		          string_identifier,
+		          utf8_string,
+		          utf8_string_size,
+		          &string_index,
+		          error );
 
+		if( result == 1 )
+		{
+			safe_string_size = string_index;
+		}
+	}
+	if( ( result == -1 )
+	 || ( utf8_string == NULL )
+	 || ( utf8_string_size == 0 ) )
+	{
+		result = liblnk_internal_file_get_utf8_string_size(
+		          internal_file,
+		          string_identifier,
+		          &safe_string_size,
+		          error );
+
+		if( ( result == 1 )
+		 && ( utf8_string != NULL )
+		 && ( utf8_string_size > 0 ) )
+		{
+			/* The string was not copied since utf8_string is too small
+			 * or the conversion failed
+			 */
+			if( utf8_string_size >= safe_string_size )
+			{
+				result = -1;
+			}
+			else
+			{
+				libcerror_error_free(
+				 error );
+
+				result = liblnk_internal_file_get_truncated_utf8_string(
+				          internal_file,
+				          string_identifier,
+				          safe_string_size,
+				          utf8_string,
+				          utf8_string_size,
+				          error );
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string: %d.",
+			 function,
+			 string_identifier );
+		}
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2986,21 +7032,32 @@ int liblnk_file_get_icon_index(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	if( result == 1 )
+	{
+		*required_utf8_string_size = safe_string_size;
+	}
+	else
+	{
+		*required_utf8_string_size = 0;
+	}
+	return( result );
 }
 
-/* Retrieves the show window value
- * Returns 1 if successful or -1 on error
+/* Retrieves the size of a UTF-16 encoded string by identifier
+ * The size includes the end of string character
+ * This function does not lock the file
+ * Returns 1 if successful, 0 if value is not available or -1 on error
  */
-int liblnk_file_get_show_window_value(
-     liblnk_file_t *file,
-     uint32_t *show_window_value,
+int liblnk_internal_file_get_utf16_string_size(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
-	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_show_window_value";
+	static char *function = "liblnk_internal_file_get_utf16_string_size";
+	int result            = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3011,77 +7068,176 @@ int liblnk_file_get_show_window_value(
 
 		return( -1 );
 	}
-	internal_file = (liblnk_internal_file_t *) file;
-
-	if( internal_file->file_information == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file information.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( show_window_value == NULL )
+	switch( string_identifier )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid show window value.",
-		 function );
+		case LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf16_volume_label_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          utf16_string_size,
+				          error );
+			}
+			break;
 
-		return( -1 );
-	}
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		case LIBLNK_STRING_IDENTIFIER_LOCAL_PATH:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf16_local_path_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          utf16_string_size,
+				          error );
+			}
+			break;
 
-		return( -1 );
-	}
-#endif
-	*show_window_value = internal_file->file_information->show_window;
+		case LIBLNK_STRING_IDENTIFIER_NETWORK_PATH:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf16_network_path_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          utf16_string_size,
+				          error );
+			}
+			break;
 
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+		case LIBLNK_STRING_IDENTIFIER_DESCRIPTION:
+			if( internal_file->description != NULL )
+			{
+				result = liblnk_data_string_get_utf16_string_size(
+				          internal_file->description,
+				          internal_file->io_handle->ascii_codepage,
+				          utf16_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_RELATIVE_PATH:
+			if( internal_file->relative_path != NULL )
+			{
+				result = liblnk_data_string_get_utf16_path_string_size(
+				          internal_file->relative_path,
+				          internal_file->io_handle->ascii_codepage,
+				          utf16_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_WORKING_DIRECTORY:
+			if( internal_file->working_directory != NULL )
+			{
+				result = liblnk_data_string_get_utf16_path_string_size(
+				          internal_file->working_directory,
+				          internal_file->io_handle->ascii_codepage,
+				          utf16_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_COMMAND_LINE_ARGUMENTS:
+			if( internal_file->command_line_arguments != NULL )
+			{
+				result = liblnk_data_string_get_utf16_path_string_size(
+				          internal_file->command_line_arguments,
+				          internal_file->io_handle->ascii_codepage,
+				          utf16_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_ICON_LOCATION:
+			if( internal_file->icon_location != NULL )
+			{
+				result = liblnk_data_string_get_utf16_path_string_size(
+				          internal_file->icon_location,
+				          internal_file->io_handle->ascii_codepage,
+				          utf16_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_ENVIRONMENT_VARIABLES_LOCATION:
+			if( internal_file->environment_variables_location_data_block != NULL )
+			{
+				result = liblnk_strings_data_block_get_utf16_path_string_size(
+				          internal_file->environment_variables_location_data_block,
+				          utf16_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_MACHINE_IDENTIFIER:
+			if( internal_file->distributed_link_tracking_data_block != NULL )
+			{
+				result = liblnk_distributed_link_tracking_data_block_get_utf16_machine_identifier_size(
+				          internal_file->distributed_link_tracking_data_block,
+				          utf16_string_size,
+				          error );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported string identifier: %d.",
+			 function,
+			 string_identifier );
+
+			return( -1 );
+	}
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string: %d size.",
+		 function,
+		 string_identifier );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the hot key value
- * Returns 1 if successful or -1 on error
+/* Retrieves a UTF-16 encoded string by identifier
+ * The string is copied at the string index, which is set to the index after the end of string character
+ * The volume label, environment variables location and machine identifier are
+ * converted directly into the string, the other strings are copied from the caches
+ * This function does not lock the file
+ * Returns 1 if successful, 0 if value is not available or -1 on error
  */
-int liblnk_file_get_hot_key_value(
-     liblnk_file_t *file,
-     uint16_t *hot_key_value,
+int liblnk_internal_file_get_utf16_string_with_index(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
      libcerror_error_t **error )
 {
-	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_hot_key_value";
+	liblnk_data_string_t *data_string                 = NULL;
+	liblnk_internal_data_block_t *internal_data_block = NULL;
+	static char *function                             = "liblnk_internal_file_get_utf16_string_with_index";
+	size_t safe_string_size                           = 0;
+	int result                                        = 0;
+	uint8_t is_path                                   = 1;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -3092,245 +7248,409 @@ int liblnk_file_get_hot_key_value(
 
 		return( -1 );
 	}
-	internal_file = (liblnk_internal_file_t *) file;
-
-	if( internal_file->file_information == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file information.",
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( hot_key_value == NULL )
+	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hot key value.",
+		 "%s: invalid UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( utf16_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*hot_key_value = internal_file->file_information->hot_key;
-
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( utf16_string_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
-}
-
-/* Retrieves the linked file's attribute flags
- * The file attribute flags are only set if the link refers to a file
- * Returns 1 if successful or -1 on error
- */
-int liblnk_file_get_file_attribute_flags(
-     liblnk_file_t *file,
-     uint32_t *file_attribute_flags,
-     libcerror_error_t **error )
-{
-	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_file_attribute_flags";
-
-	if( file == NULL )
+	if( *utf16_string_index >= utf16_string_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (liblnk_internal_file_t *) file;
-
-	if( internal_file->file_information == NULL )
+	switch( string_identifier )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file information.",
-		 function );
+		case LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf16_volume_label_with_index(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          utf16_string,
+				          utf16_string_size,
+				          utf16_string_index,
+				          error );
+			}
+			break;
 
-		return( -1 );
+		case LIBLNK_STRING_IDENTIFIER_LOCAL_PATH:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf16_local_path_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          &safe_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_NETWORK_PATH:
+			if( internal_file->location_information != NULL )
+			{
+				result = liblnk_location_information_get_utf16_network_path_size(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          &safe_string_size,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_DESCRIPTION:
+			data_string = internal_file->description;
+			is_path     = 0;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_RELATIVE_PATH:
+			data_string = internal_file->relative_path;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_WORKING_DIRECTORY:
+			data_string = internal_file->working_directory;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_COMMAND_LINE_ARGUMENTS:
+			data_string = internal_file->command_line_arguments;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_ICON_LOCATION:
+			data_string = internal_file->icon_location;
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_ENVIRONMENT_VARIABLES_LOCATION:
+			internal_data_block = (liblnk_internal_data_block_t *) internal_file->environment_variables_location_data_block;
+
+			if( ( internal_data_block != NULL )
+			 && ( internal_data_block->value != NULL ) )
+			{
+				result = liblnk_data_string_get_utf16_path_string_with_index(
+				          (liblnk_data_string_t *) internal_data_block->value,
+				          internal_data_block->ascii_codepage,
+				          utf16_string,
+				          utf16_string_size,
+				          utf16_string_index,
+				          error );
+			}
+			break;
+
+		case LIBLNK_STRING_IDENTIFIER_MACHINE_IDENTIFIER:
+			internal_data_block = (liblnk_internal_data_block_t *) internal_file->distributed_link_tracking_data_block;
+
+			if( ( internal_data_block != NULL )
+			 && ( internal_data_block->value != NULL ) )
+			{
+				result = liblnk_distributed_link_tracker_properties_get_utf16_machine_identifier_with_index(
+				          (liblnk_distributed_link_tracker_properties_t *) internal_data_block->value,
+				          utf16_string,
+				          utf16_string_size,
+				          utf16_string_index,
+				          internal_data_block->ascii_codepage,
+				          error );
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported string identifier: %d.",
+			 function,
+			 string_identifier );
+
+			return( -1 );
 	}
-	if( file_attribute_flags == NULL )
+	if( data_string != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file attribute flags.",
-		 function );
-
-		return( -1 );
+		if( is_path != 0 )
+		{
+			result = liblnk_data_string_get_utf16_path_string_size(
+			          data_string,
+			          internal_file->io_handle->ascii_codepage,
+			          &safe_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_data_string_get_utf16_string_size(
+			          data_string,
+			          internal_file->io_handle->ascii_codepage,
+			          &safe_string_size,
+			          error );
+		}
 	}
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	/* The cached strings are copied after their size is checked
+	 */
+	if( ( result == 1 )
+	 && ( safe_string_size > 0 ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( safe_string_size > ( utf16_string_size - *utf16_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-16 string too small.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		if( data_string == NULL )
+		{
+			if( string_identifier == LIBLNK_STRING_IDENTIFIER_LOCAL_PATH )
+			{
+				result = liblnk_location_information_get_utf16_local_path(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          &( utf16_string[ *utf16_string_index ] ),
+				          utf16_string_size - *utf16_string_index,
+				          error );
+			}
+			else
+			{
+				result = liblnk_location_information_get_utf16_network_path(
+				          internal_file->location_information,
+				          internal_file->io_handle->ascii_codepage,
+				          &( utf16_string[ *utf16_string_index ] ),
+				          utf16_string_size - *utf16_string_index,
+				          error );
+			}
+		}
+		else if( is_path != 0 )
+		{
+			result = liblnk_data_string_get_utf16_path_string(
+			          data_string,
+			          internal_file->io_handle->ascii_codepage,
+			          &( utf16_string[ *utf16_string_index ] ),
+			          utf16_string_size - *utf16_string_index,
+			          error );
+		}
+		else
+		{
+			result = liblnk_data_string_get_utf16_string(
+			          data_string,
+			          internal_file->io_handle->ascii_codepage,
+			          &( utf16_string[ *utf16_string_index ] ),
+			          utf16_string_size - *utf16_string_index,
+			          error );
+		}
+		if( result == 1 )
+		{
+			*utf16_string_index += safe_string_size;
+		}
 	}
-#endif
-	*file_attribute_flags = internal_file->file_information->file_attribute_flags;
-
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string: %d.",
+		 function,
+		 string_identifier );
 
 		return( -1 );
 	}
-#endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the drive type
- * The drive type is only set if the link refers to a file on a local volume
+/* Retrieves the truncated UTF-16 encoded string by identifier
+ * The string is truncated to fit utf16_string_size without splitting a surrogate pair
+ * and is terminated by an end of string character
+ * This function does not lock the file
  * Returns 1 if successful, 0 if value is not available or -1 on error
  */
-int liblnk_file_get_drive_type(
-     liblnk_file_t *file,
-     uint32_t *drive_type,
+int liblnk_internal_file_get_truncated_utf16_string(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     size_t string_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
      libcerror_error_t **error )
 {
-	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_drive_type";
-	int result                            = 0;
+	uint16_t *safe_string = NULL;
+	static char *function = "liblnk_internal_file_get_truncated_utf16_string";
+	size_t string_index   = 0;
+	int result            = 0;
 
-	if( file == NULL )
+	if( ( string_size == 0 )
+	 || ( string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (liblnk_internal_file_t *) file;
-
-	if( internal_file->io_handle == NULL )
+	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( drive_type == NULL )
+	if( ( utf16_string_size == 0 )
+	 || ( utf16_string_size >= string_size ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid drive type.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-16 string size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	safe_string = (uint16_t *) memory_allocate(
+	                           sizeof( uint16_t ) * string_size );
+
+	if( safe_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	if( internal_file->location_information != NULL )
-	{
-		*drive_type = internal_file->location_information->drive_type;
+	result = liblnk_internal_file_get_utf16_string_with_index(
+	          internal_file,
+	          string_identifier,
+	          safe_string,
+	          string_size,
+	          &string_index,
+	          error );
 
-		result = 1;
-	}
-#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string: %d.",
+		 function,
+		 string_identifier );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
+	else if( result != 0 )
+	{
+		/* Do not split a surrogate pair
+		 */
+		string_index = utf16_string_size - 1;
+
+		if( ( string_index > 0 )
+		 && ( safe_string[ string_index - 1 ] >= 0xd800 )
+		 && ( safe_string[ string_index - 1 ] <= 0xdbff )
+		 && ( safe_string[ string_index ] >= 0xdc00 )
+		 && ( safe_string[ string_index ] <= 0xdfff ) )
+		{
+			string_index--;
+		}
+		if( memory_copy(
+		     utf16_string,
+		     safe_string,
+		     sizeof( uint16_t ) * string_index ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			goto on_error;
+		}
+		utf16_string[ string_index ] = 0;
+	}
+	memory_free(
+	 safe_string );
+
 	return( result );
+
+on_error:
+	if( safe_string != NULL )
+	{
+		memory_free(
+		 safe_string );
+	}
+	return( -1 );
 }
 
-/* Retrieves the drive serial number
- * The drive serial number is only set if the link refers to a file on a local volume
+/* Retrieves a UTF-16 encoded string by identifier in a single call
+ * The string identifier is one of the LIBLNK_STRING_IDENTIFIER_* definitions
+ * The required utf16_string_size is set to the size of the string including
+ * the end of string character. If utf16_string is set the string is copied,
+ * if utf16_string_size is too small the string is truncated without splitting
+ * a surrogate pair and terminated by an end of string character
  * Returns 1 if successful, 0 if value is not available or -1 on error
  */
-int liblnk_file_get_drive_serial_number(
+int liblnk_file_get_utf16_string(
      liblnk_file_t *file,
-     uint32_t *drive_serial_number,
+     int string_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *required_utf16_string_size,
      libcerror_error_t **error )
 {
+	liblnk_data_block_t *data_block       = NULL;
 	liblnk_internal_file_t *internal_file = NULL;
-	static char *function                 = "liblnk_file_get_drive_serial_number";
+	static char *function                 = "liblnk_file_get_utf16_string";
+	size_t safe_string_size               = 0;
+	size_t string_index                   = 0;
 	int result                            = 0;
 
 	if( file == NULL )
@@ -3346,31 +7666,53 @@ int liblnk_file_get_drive_serial_number(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( utf16_string_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required UTF-16 string size.",
 		 function );
 
 		return( -1 );
 	}
-	if( drive_serial_number == NULL )
+	if( string_identifier == LIBLNK_STRING_IDENTIFIER_ENVIRONMENT_VARIABLES_LOCATION )
+	{
+		data_block = internal_file->environment_variables_location_data_block;
+	}
+	else if( string_identifier == LIBLNK_STRING_IDENTIFIER_MACHINE_IDENTIFIER )
+	{
+		data_block = internal_file->distributed_link_tracking_data_block;
+	}
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     data_block,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid drive serial number.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3383,15 +7725,74 @@ int liblnk_file_get_drive_serial_number(
 		return( -1 );
 	}
 #endif
-	if( internal_file->location_information != NULL )
+	/* The string is converted or copied directly into utf16_string, the size is
+	 * only retrieved separately if utf16_string is not set or too small
+	 */
+	if( ( utf16_string != NULL )
+	 && ( utf16_string_size > 0 ) )
 	{
-		*drive_serial_number = internal_file->location_information->drive_serial_number;
+		result = liblnk_internal_file_get_utf16_string_with_index(
+		          internal_file,
+		          string_identifier,
+		          utf16_string,
+		          utf16_string_size,
+		          &string_index,
+		          error );
 
-		result = 1;
+		if( result == 1 )
+		{
+			safe_string_size = string_index;
+		}
+	}
+	if( ( result == -1 )
+	 || ( utf16_string == NULL )
+	 || ( utf16_string_size == 0 ) )
+	{
+		result = liblnk_internal_file_get_utf16_string_size(
+		          internal_file,
+		          string_identifier,
+		          &safe_string_size,
+		          error );
+
+		if( ( result == 1 )
+		 && ( utf16_string != NULL )
+		 && ( utf16_string_size > 0 ) )
+		{
+			/* The string was not copied since utf16_string is too small
+			 * or the conversion failed
+			 */
+			if( utf16_string_size >= safe_string_size )
+			{
+				result = -1;
+			}
+			else
+			{
+				libcerror_error_free(
+				 error );
+
+				result = liblnk_internal_file_get_truncated_utf16_string(
+				          internal_file,
+				          string_identifier,
+				          safe_string_size,
+				          utf16_string,
+				          utf16_string_size,
+				          error );
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string: %d.",
+			 function,
+			 string_identifier );
+		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3404,11 +7805,17 @@ int liblnk_file_get_drive_serial_number(
 		return( -1 );
 	}
 #endif
+	if( result == 1 )
+	{
+		*required_utf16_string_size = safe_string_size;
+	}
+	else
+	{
+		*required_utf16_string_size = 0;
+	}
 	return( result );
 }
 
-/* TODO add raw string functions */
-
 /* Retrieves the size of the UTF-8 encoded volume label
  * The size includes the end of string character
  * The volume label is only set if the link refers to a file on a local volume
@@ -3448,8 +7855,8 @@ int liblnk_file_get_utf8_volume_label_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3483,8 +7890,8 @@ int liblnk_file_get_utf8_volume_label_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3540,8 +7947,8 @@ int liblnk_file_get_utf8_volume_label(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3576,8 +7983,8 @@ int liblnk_file_get_utf8_volume_label(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3632,8 +8039,8 @@ int liblnk_file_get_utf16_volume_label_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3667,8 +8074,8 @@ int liblnk_file_get_utf16_volume_label_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3724,8 +8131,8 @@ int liblnk_file_get_utf16_volume_label(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3760,8 +8167,8 @@ int liblnk_file_get_utf16_volume_label(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3817,8 +8224,8 @@ int liblnk_file_get_utf8_local_path_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3852,8 +8259,8 @@ int liblnk_file_get_utf8_local_path_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3910,8 +8317,8 @@ int liblnk_file_get_utf8_local_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3946,8 +8353,8 @@ int liblnk_file_get_utf8_local_path(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4003,8 +8410,8 @@ int liblnk_file_get_utf16_local_path_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4038,8 +8445,8 @@ int liblnk_file_get_utf16_local_path_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4096,8 +8503,8 @@ int liblnk_file_get_utf16_local_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4132,8 +8539,8 @@ int liblnk_file_get_utf16_local_path(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4189,8 +8596,8 @@ int liblnk_file_get_utf8_network_path_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4224,8 +8631,8 @@ int liblnk_file_get_utf8_network_path_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4282,8 +8689,8 @@ int liblnk_file_get_utf8_network_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4318,8 +8725,8 @@ int liblnk_file_get_utf8_network_path(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4375,8 +8782,8 @@ int liblnk_file_get_utf16_network_path_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4410,8 +8817,8 @@ int liblnk_file_get_utf16_network_path_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4468,8 +8875,8 @@ int liblnk_file_get_utf16_network_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4504,8 +8911,8 @@ int liblnk_file_get_utf16_network_path(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4559,8 +8966,8 @@ int liblnk_file_get_utf8_description_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4594,8 +9001,8 @@ int liblnk_file_get_utf8_description_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4650,8 +9057,8 @@ int liblnk_file_get_utf8_description(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4686,8 +9093,8 @@ int liblnk_file_get_utf8_description(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4741,8 +9148,8 @@ int liblnk_file_get_utf16_description_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4776,8 +9183,8 @@ int liblnk_file_get_utf16_description_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4832,8 +9239,8 @@ int liblnk_file_get_utf16_description(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4868,8 +9275,8 @@ int liblnk_file_get_utf16_description(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4924,8 +9331,8 @@ int liblnk_file_get_utf8_relative_path_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4959,8 +9366,8 @@ int liblnk_file_get_utf8_relative_path_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5016,8 +9423,8 @@ int liblnk_file_get_utf8_relative_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5052,8 +9459,8 @@ int liblnk_file_get_utf8_relative_path(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5108,8 +9515,8 @@ int liblnk_file_get_utf16_relative_path_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5143,8 +9550,8 @@ int liblnk_file_get_utf16_relative_path_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5200,8 +9607,8 @@ int liblnk_file_get_utf16_relative_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5236,8 +9643,8 @@ int liblnk_file_get_utf16_relative_path(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5292,8 +9699,8 @@ int liblnk_file_get_utf8_working_directory_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5327,8 +9734,8 @@ int liblnk_file_get_utf8_working_directory_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5384,8 +9791,8 @@ int liblnk_file_get_utf8_working_directory(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5420,8 +9827,8 @@ int liblnk_file_get_utf8_working_directory(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5476,8 +9883,8 @@ int liblnk_file_get_utf16_working_directory_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5511,8 +9918,8 @@ int liblnk_file_get_utf16_working_directory_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5568,8 +9975,8 @@ int liblnk_file_get_utf16_working_directory(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5604,8 +10011,8 @@ int liblnk_file_get_utf16_working_directory(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5660,8 +10067,8 @@ int liblnk_file_get_utf8_command_line_arguments_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5695,8 +10102,8 @@ int liblnk_file_get_utf8_command_line_arguments_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5752,8 +10159,8 @@ int liblnk_file_get_utf8_command_line_arguments(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5788,8 +10195,8 @@ int liblnk_file_get_utf8_command_line_arguments(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5844,8 +10251,8 @@ int liblnk_file_get_utf16_command_line_arguments_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5879,8 +10286,8 @@ int liblnk_file_get_utf16_command_line_arguments_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5936,8 +10343,8 @@ int liblnk_file_get_utf16_command_line_arguments(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5972,8 +10379,8 @@ int liblnk_file_get_utf16_command_line_arguments(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6028,8 +10435,8 @@ int liblnk_file_get_utf8_icon_location_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6063,8 +10470,8 @@ int liblnk_file_get_utf8_icon_location_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6120,8 +10527,8 @@ int liblnk_file_get_utf8_icon_location(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6156,8 +10563,8 @@ int liblnk_file_get_utf8_icon_location(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6212,8 +10619,8 @@ int liblnk_file_get_utf16_icon_location_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6247,8 +10654,8 @@ int liblnk_file_get_utf16_icon_location_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6304,8 +10711,8 @@ int liblnk_file_get_utf16_icon_location(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6340,8 +10747,8 @@ int liblnk_file_get_utf16_icon_location(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6371,22 +10778,36 @@ int liblnk_file_get_utf8_environment_variables_location_size(
 	static char *function                 = "liblnk_file_get_utf8_environment_variables_location_size";
 	int result                            = 0;
 
-	if( file == NULL )
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (liblnk_internal_file_t *) file;
+
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->environment_variables_location_data_block,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read environment variables location data block.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (liblnk_internal_file_t *) file;
-
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6419,8 +10840,8 @@ int liblnk_file_get_utf8_environment_variables_location_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6464,9 +10885,23 @@ int liblnk_file_get_utf8_environment_variables_location(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->environment_variables_location_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read environment variables location data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6500,8 +10935,8 @@ int liblnk_file_get_utf8_environment_variables_location(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6544,9 +10979,23 @@ int liblnk_file_get_utf16_environment_variables_location_size(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->environment_variables_location_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read environment variables location data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6579,8 +11028,8 @@ int liblnk_file_get_utf16_environment_variables_location_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6624,9 +11073,23 @@ int liblnk_file_get_utf16_environment_variables_location(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->environment_variables_location_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read environment variables location data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6660,8 +11123,8 @@ int liblnk_file_get_utf16_environment_variables_location(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6726,8 +11189,8 @@ int liblnk_file_get_link_target_identifier_data_size(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6747,8 +11210,8 @@ int liblnk_file_get_link_target_identifier_data_size(
 		result = 1;
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6825,8 +11288,8 @@ int liblnk_file_copy_link_target_identifier_data(
 		return( -1 );
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6870,8 +11333,8 @@ int liblnk_file_copy_link_target_identifier_data(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6915,9 +11378,23 @@ int liblnk_file_has_distributed_link_tracking_data(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->distributed_link_tracking_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distributed link tracking data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6935,8 +11412,8 @@ int liblnk_file_has_distributed_link_tracking_data(
 		result = 1;
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -6978,9 +11455,23 @@ int liblnk_file_get_utf8_machine_identifier_size(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->distributed_link_tracking_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distributed link tracking data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7013,8 +11504,8 @@ int liblnk_file_get_utf8_machine_identifier_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7057,9 +11548,23 @@ int liblnk_file_get_utf8_machine_identifier(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->distributed_link_tracking_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distributed link tracking data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7093,8 +11598,8 @@ int liblnk_file_get_utf8_machine_identifier(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7136,9 +11641,23 @@ int liblnk_file_get_utf16_machine_identifier_size(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->distributed_link_tracking_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distributed link tracking data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7171,8 +11690,8 @@ int liblnk_file_get_utf16_machine_identifier_size(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7215,9 +11734,23 @@ int liblnk_file_get_utf16_machine_identifier(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->distributed_link_tracking_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distributed link tracking data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7251,8 +11784,8 @@ int liblnk_file_get_utf16_machine_identifier(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7295,9 +11828,23 @@ int liblnk_file_get_droid_volume_identifier(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->distributed_link_tracking_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distributed link tracking data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7331,8 +11878,8 @@ int liblnk_file_get_droid_volume_identifier(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7375,9 +11922,23 @@ int liblnk_file_get_droid_file_identifier(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->distributed_link_tracking_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distributed link tracking data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7411,8 +11972,8 @@ int liblnk_file_get_droid_file_identifier(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7455,9 +12016,23 @@ int liblnk_file_get_birth_droid_volume_identifier(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->distributed_link_tracking_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distributed link tracking data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7491,8 +12066,8 @@ int liblnk_file_get_birth_droid_volume_identifier(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7535,9 +12110,23 @@ int liblnk_file_get_birth_droid_file_identifier(
 	}
 	internal_file = (liblnk_internal_file_t *) file;
 
+	if( liblnk_internal_file_read_data_block_on_demand(
+	     internal_file,
+	     internal_file->distributed_link_tracking_data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read distributed link tracking data block.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7571,8 +12160,8 @@ int liblnk_file_get_birth_droid_file_identifier(
 		}
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7618,8 +12207,8 @@ int liblnk_file_get_number_of_data_blocks(
 	internal_file = (liblnk_internal_file_t *) file;
 
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7647,8 +12236,8 @@ int liblnk_file_get_number_of_data_blocks(
 		result = -1;
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7691,8 +12280,8 @@ int liblnk_file_get_data_block_by_index(
 	internal_file = (liblnk_internal_file_t *) file;
 
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_grab_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7722,8 +12311,8 @@ int liblnk_file_get_data_block_by_index(
 		result = -1;
 	}
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( liblnk_internal_file_release_for_read(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -7736,6 +12325,26 @@ int liblnk_file_get_data_block_by_index(
 		return( -1 );
 	}
 #endif
+	if( result == 1 )
+	{
+		if( liblnk_internal_file_read_data_block_on_demand(
+		     internal_file,
+		     *data_block,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data block: %d.",
+			 function,
+			 data_block_index );
+
+			*data_block = NULL;
+
+			result = -1;
+		}
+	}
 	return( result );
 }
 
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "liblnk_arena.h"
 #include "liblnk_data_block.h"
 #include "liblnk_data_string.h"
 #include "liblnk_extern.h"
@@ -38,6 +39,7 @@
 #include "liblnk_link_target_identifier.h"
 #include "liblnk_location_information.h"
 #include "liblnk_special_folder_location.h"
+#include "liblnk_statistics.h"
 #include "liblnk_types.h"
 
 #if defined( __cplusplus )
@@ -68,6 +70,34 @@ struct liblnk_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The caller provided buffer of a file opened from memory
+	 */
+	const uint8_t *memory_buffer;
+
+	/* The caller provided buffer size
+	 */
+	size_t memory_buffer_size;
+
+	/* Value to indicate if the memory buffer was mapped inside the library
+	 */
+	uint8_t memory_buffer_mapped_in_library;
+
+	/* The maximum size of a file that is read into a single buffer on open
+	 */
+	size_t maximum_read_buffer_size;
+
+	/* Value to indicate if memory is retained on close for reuse by the next open
+	 */
+	uint8_t retain_capacity;
+
+	/* The file IO handle created inside the library that was retained on close
+	 */
+	libbfio_handle_t *retained_file_io_handle;
+
+	/* The field mask that selects the structures that are read on open
+	 */
+	uint32_t field_mask;
+
 	/* The file information
 	 */
 	liblnk_file_header_t *file_information;
@@ -121,6 +151,22 @@ struct liblnk_internal_file
 	 */
 	libcdata_array_t *data_blocks_array;
 
+	/* Value to indicate the parsed values no longer change
+	 * and can be read without grabbing the read/write lock
+	 * The value is not accessed atomically, hence the file must be
+	 * opened before it is shared with other threads
+	 */
+	uint8_t is_frozen;
+
+	/* The arena the values parsed on open are allocated from
+	 */
+	liblnk_arena_t *arena;
+
+	/* The statistics collected since the file was opened
+	 * NULL if no statistics were collected
+	 */
+	liblnk_internal_statistics_t *statistics;
+
 #if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -168,22 +214,102 @@ int liblnk_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBLNK_EXTERN \
+int liblnk_file_open_memory(
+     liblnk_file_t *file,
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBLNK_EXTERN \
 int liblnk_file_close(
      liblnk_file_t *file,
      libcerror_error_t **error );
 
+int liblnk_internal_file_set_statistics(
+     liblnk_internal_file_t *internal_file,
+     int access_flags,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_add_value_statistics(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_open_memory_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int liblnk_internal_file_open_read(
      liblnk_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int liblnk_internal_file_get_structure_size(
+     liblnk_internal_file_t *internal_file,
+     uint32_t data_flag,
+     const uint8_t *data,
+     size_t data_size,
+     size64_t *structure_size,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_skip_structure_file_io_handle(
+     liblnk_internal_file_t *internal_file,
+     uint32_t data_flag,
+     libbfio_handle_t *file_io_handle,
+     off64_t *file_offset,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_skip_extra_data_block(
+     liblnk_internal_file_t *internal_file,
+     const uint8_t *data,
+     size64_t remaining_size,
+     uint32_t *data_block_size,
+     libcerror_error_t **error );
+
 ssize_t liblnk_internal_file_read_extra_data_blocks(
          liblnk_internal_file_t *internal_file,
          libbfio_handle_t *file_io_handle,
          off64_t file_offset,
          libcerror_error_t **error );
 
+int liblnk_internal_file_append_extra_data_block(
+     liblnk_internal_file_t *internal_file,
+     liblnk_data_block_t *data_block,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_read_extra_data_block_values(
+     liblnk_internal_file_t *internal_file,
+     liblnk_data_block_t *data_block,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_read_data_block_on_demand(
+     liblnk_internal_file_t *internal_file,
+     liblnk_data_block_t *data_block,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_cache_strings(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_clear_string_caches(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+
+int liblnk_internal_file_grab_for_read(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_release_for_read(
+     liblnk_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT ) */
+
 LIBLNK_EXTERN \
 int liblnk_file_get_ascii_codepage(
      liblnk_file_t *file,
@@ -196,11 +322,53 @@ int liblnk_file_set_ascii_codepage(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBLNK_EXTERN \
+int liblnk_file_get_maximum_read_buffer_size(
+     liblnk_file_t *file,
+     size_t *maximum_read_buffer_size,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_file_set_maximum_read_buffer_size(
+     liblnk_file_t *file,
+     size_t maximum_read_buffer_size,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_file_get_retain_capacity(
+     liblnk_file_t *file,
+     uint8_t *retain_capacity,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_file_set_retain_capacity(
+     liblnk_file_t *file,
+     uint8_t retain_capacity,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_file_get_field_mask(
+     liblnk_file_t *file,
+     uint32_t *field_mask,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_file_set_field_mask(
+     liblnk_file_t *file,
+     uint32_t field_mask,
+     libcerror_error_t **error );
+
 LIBLNK_EXTERN \
 int liblnk_file_is_corrupted(
      liblnk_file_t *file,
      libcerror_error_t **error );
 
+LIBLNK_EXTERN \
+int liblnk_file_get_statistics(
+     liblnk_file_t *file,
+     liblnk_statistics_t *statistics,
+     libcerror_error_t **error );
+
 /* -------------------------------------------------------------------------
  * Link information functions
  * ------------------------------------------------------------------------- */
@@ -284,6 +452,68 @@ int liblnk_file_get_drive_serial_number(
 
 /* TODO add raw string functions ? */
 
+int liblnk_internal_file_get_utf8_string_size(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_get_utf8_string_with_index(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_get_truncated_utf8_string(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     size_t string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_get_utf16_string_size(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_get_utf16_string_with_index(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     libcerror_error_t **error );
+
+int liblnk_internal_file_get_truncated_utf16_string(
+     liblnk_internal_file_t *internal_file,
+     int string_identifier,
+     size_t string_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_file_get_utf8_string(
+     liblnk_file_t *file,
+     int string_identifier,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_file_get_utf16_string(
+     liblnk_file_t *file,
+     int string_identifier,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *required_utf16_string_size,
+     libcerror_error_t **error );
+
 LIBLNK_EXTERN \
 int liblnk_file_get_utf8_volume_label_size(
      liblnk_file_t *file,
@@ -108,6 +108,77 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a file header
+ * The file header is allocated from the arena if set, otherwise it is allocated separately
+ * Make sure the value file_header is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_file_header_initialize_with_arena(
+     liblnk_file_header_t **file_header,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_file_header_initialize_with_arena";
+
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		if( liblnk_file_header_initialize(
+		     file_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file header.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( liblnk_arena_allocate(
+	     arena,
+	     sizeof( liblnk_file_header_t ),
+	     (void **) file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file header.",
+		 function );
+
+		return( -1 );
+	}
+	( *file_header )->is_arena_allocated = 1;
+
+	return( 1 );
+}
+
 /* Frees a file header
  * Returns 1 if successful or -1 on error
  */
@@ -130,9 +201,11 @@ int liblnk_file_header_free(
 	}
 	if( *file_header != NULL )
 	{
-		memory_free(
-		 *file_header );
-
+		if( ( *file_header )->is_arena_allocated == 0 )
+		{
+			memory_free(
+			 *file_header );
+		}
 		*file_header = NULL;
 	}
 	return( 1 );
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "liblnk_arena.h"
 #include "liblnk_libbfio.h"
 #include "liblnk_libcerror.h"
 
@@ -78,12 +79,21 @@ struct liblnk_file_header
 	/* The hot key
 	 */
 	uint16_t hot_key;
+
+	/* Value to indicate the structure is allocated from an arena
+	 */
+	uint8_t is_arena_allocated;
 };
 
 int liblnk_file_header_initialize(
      liblnk_file_header_t **file_header,
      libcerror_error_t **error );
 
+int liblnk_file_header_initialize_with_arena(
+     liblnk_file_header_t **file_header,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error );
+
 int liblnk_file_header_free(
      liblnk_file_header_t **file_header,
      libcerror_error_t **error );
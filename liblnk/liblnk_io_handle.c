@@ -25,8 +25,11 @@
 #include <types.h>
 
 #include "liblnk_codepage.h"
+#include "liblnk_definitions.h"
 #include "liblnk_io_handle.h"
+#include "liblnk_libbfio.h"
 #include "liblnk_libcerror.h"
+#include "liblnk_statistics.h"
 
 const uint8_t lnk_file_class_identifier[ 16 ] = {
 	0x01, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46 };
@@ -175,3 +178,280 @@ int liblnk_io_handle_clear(
 	return( 1 );
 }
 
+/* Records a read in the statistics
+ * Returns 1 if successful or -1 on error
+ */
+static int liblnk_io_handle_add_read_statistics(
+            liblnk_io_handle_t *io_handle,
+            uint64_t start_timestamp,
+            ssize_t read_count,
+            libcerror_error_t **error )
+{
+	static char *function = "liblnk_io_handle_add_read_statistics";
+
+	if( liblnk_statistics_end_phase(
+	     io_handle->statistics,
+	     LIBLNK_STATISTICS_PHASE_READ,
+	     start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to end read phase.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_add_counter(
+	     io_handle->statistics,
+	     LIBLNK_STATISTICS_COUNTER_NUMBER_OF_READS,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count > 0 )
+	{
+		if( liblnk_statistics_add_counter(
+		     io_handle->statistics,
+		     LIBLNK_STATISTICS_COUNTER_BYTES_READ,
+		     (uint64_t) read_count,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add bytes read.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads a buffer from the file IO handle at the current offset
+ * The read is recorded in the statistics if statistics are collected
+ * and the file is not parsed from memory
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t liblnk_io_handle_read_buffer(
+         liblnk_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function    = "liblnk_io_handle_read_buffer";
+	uint64_t start_timestamp = 0;
+	ssize_t read_count       = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->statistics == NULL )
+	 || ( io_handle->data != NULL ) )
+	{
+		return( libbfio_handle_read_buffer(
+		         file_io_handle,
+		         buffer,
+		         size,
+		         error ) );
+	}
+	if( liblnk_statistics_start_phase(
+	     io_handle->statistics,
+	     &start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start read phase.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              buffer,
+	              size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		return( -1 );
+	}
+	if( liblnk_io_handle_add_read_statistics(
+	     io_handle,
+	     start_timestamp,
+	     read_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add read statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Reads a buffer from the file IO handle at a specific offset
+ * The read is recorded in the statistics if statistics are collected
+ * and the file is not parsed from memory
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t liblnk_io_handle_read_buffer_at_offset(
+         liblnk_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function    = "liblnk_io_handle_read_buffer_at_offset";
+	uint64_t start_timestamp = 0;
+	ssize_t read_count       = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->statistics == NULL )
+	 || ( io_handle->data != NULL ) )
+	{
+		return( libbfio_handle_read_buffer_at_offset(
+		         file_io_handle,
+		         buffer,
+		         size,
+		         offset,
+		         error ) );
+	}
+	if( liblnk_statistics_start_phase(
+	     io_handle->statistics,
+	     &start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to start read phase.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		return( -1 );
+	}
+	if( liblnk_io_handle_add_read_statistics(
+	     io_handle,
+	     start_timestamp,
+	     read_count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add read statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Retrieves a pointer to the file data at a specific offset
+ * Returns 1 if successful, 0 if the file is not parsed from memory or -1 on error
+ */
+int liblnk_io_handle_get_data_at_offset(
+     liblnk_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_io_handle_get_data_at_offset";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->data == NULL )
+	{
+		return( 0 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset > (size64_t) io_handle->data_size )
+	 || ( size > ( io_handle->data_size - (size_t) offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*data = &( io_handle->data[ offset ] );
+
+	return( 1 );
+}
+
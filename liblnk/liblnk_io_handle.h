@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "liblnk_libbfio.h"
 #include "liblnk_libcerror.h"
+#include "liblnk_statistics.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -56,6 +58,18 @@ struct liblnk_io_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The statistics, NULL if no statistics are collected
+	 */
+	liblnk_internal_statistics_t *statistics;
+
+	/* The file data when the file is parsed from memory, NULL otherwise
+	 */
+	const uint8_t *data;
+
+	/* The file data size
+	 */
+	size_t data_size;
 };
 
 int liblnk_io_handle_initialize(
@@ -70,6 +84,28 @@ int liblnk_io_handle_clear(
      liblnk_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+ssize_t liblnk_io_handle_read_buffer(
+         liblnk_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t liblnk_io_handle_read_buffer_at_offset(
+         liblnk_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+int liblnk_io_handle_get_data_at_offset(
+     liblnk_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
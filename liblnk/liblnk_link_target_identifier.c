@@ -105,6 +105,77 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a link target identifier
+ * The link target identifier is allocated from the arena if set, otherwise it is allocated separately
+ * Make sure the value link_target_identifier is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_link_target_identifier_initialize_with_arena(
+     liblnk_link_target_identifier_t **link_target_identifier,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_link_target_identifier_initialize_with_arena";
+
+	if( link_target_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid link target identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( *link_target_identifier != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid link target identifier value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		if( liblnk_link_target_identifier_initialize(
+		     link_target_identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create link target identifier.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( liblnk_arena_allocate(
+	     arena,
+	     sizeof( liblnk_link_target_identifier_t ),
+	     (void **) link_target_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create link target identifier.",
+		 function );
+
+		return( -1 );
+	}
+	( *link_target_identifier )->is_arena_allocated = 1;
+
+	return( 1 );
+}
+
 /* Frees a link target identifier
  * Returns 1 if successful or -1 on error
  */
@@ -127,19 +198,230 @@ int liblnk_link_target_identifier_free(
 	}
 	if( *link_target_identifier != NULL )
 	{
-		if( ( *link_target_identifier )->data != NULL )
+		if( ( ( *link_target_identifier )->data != NULL )
+		 && ( ( *link_target_identifier )->data_is_borrowed == 0 ) )
 		{
 			memory_free(
-			 ( *link_target_identifier )->data );
+			 (uint8_t *) ( *link_target_identifier )->data );
+		}
+		if( ( *link_target_identifier )->is_arena_allocated == 0 )
+		{
+			memory_free(
+			 *link_target_identifier );
 		}
-		memory_free(
-		 *link_target_identifier );
-
 		*link_target_identifier = NULL;
 	}
 	return( 1 );
 }
 
+/* Reads a link target identifier
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_link_target_identifier_read_data(
+     liblnk_link_target_identifier_t *link_target_identifier,
+     liblnk_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *identifier_data             = NULL;
+	static char *function                = "liblnk_link_target_identifier_read_data";
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	libfwsi_item_list_t *shell_item_list = NULL;
+	size_t shell_item_list_data_size     = 0;
+#endif
+
+	if( link_target_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid link target identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( link_target_identifier->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid link target identifier - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED ) != 0 )
+	{
+		link_target_identifier->data             = data;
+		link_target_identifier->data_is_borrowed = 1;
+	}
+	else
+	{
+		identifier_data = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * data_size );
+
+		if( identifier_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create link target identifier data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     identifier_data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy link target identifier data.",
+			 function );
+
+			goto on_error;
+		}
+		link_target_identifier->data = identifier_data;
+	}
+	link_target_identifier->data_size = data_size;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libfwsi_item_list_initialize(
+		     &shell_item_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shell item list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwsi_item_list_copy_from_byte_stream(
+		     shell_item_list,
+		     link_target_identifier->data,
+		     link_target_identifier->data_size,
+		     io_handle->ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream to shell item list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwsi_item_list_get_data_size(
+		     shell_item_list,
+		     &shell_item_list_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve shell item list data size.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwsi_item_list_free(
+		     &shell_item_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free shell item list.",
+			 function );
+
+			goto on_error;
+		}
+		if( shell_item_list_data_size < link_target_identifier->data_size )
+		{
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( link_target_identifier->data[ shell_item_list_data_size ] ),
+			 link_target_identifier->data_size - shell_item_list_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( shell_item_list != NULL )
+	{
+		libfwsi_item_list_free(
+		 &shell_item_list,
+		 NULL );
+	}
+#endif
+	if( identifier_data != NULL )
+	{
+		memory_free(
+		 identifier_data );
+	}
+	link_target_identifier->data             = NULL;
+	link_target_identifier->data_is_borrowed = 0;
+	link_target_identifier->data_size        = 0;
+
+	return( -1 );
+}
+
 /* Reads a link target identifier
  * Returns the number of bytes read if successful or -1 on error
  */
@@ -152,13 +434,12 @@ ssize_t liblnk_link_target_identifier_read(
 {
 	uint8_t size_data[ 2 ];
 
-	static char *function                = "liblnk_link_target_identifier_read";
-	ssize_t read_count                   = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	libfwsi_item_list_t *shell_item_list = NULL;
-	size_t shell_item_list_data_size     = 0;
-#endif
+	const uint8_t *link_target_identifier_data = NULL;
+	uint8_t *read_buffer                       = NULL;
+	static char *function                      = "liblnk_link_target_identifier_read";
+	size_t link_target_identifier_size         = 0;
+	ssize_t read_count                         = 0;
+	int result                                 = 0;
 
 	if( link_target_identifier == NULL )
 	{
@@ -203,7 +484,8 @@ ssize_t liblnk_link_target_identifier_read(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = liblnk_io_handle_read_buffer_at_offset(
+	              io_handle,
 	              file_io_handle,
 	              size_data,
 	              2,
@@ -225,11 +507,11 @@ ssize_t liblnk_link_target_identifier_read(
 	}
 	byte_stream_copy_to_uint16_little_endian(
 	 size_data,
-	 link_target_identifier->data_size )
+	 link_target_identifier_size )
 
-	if( link_target_identifier->data_size > 0 )
+	if( link_target_identifier_size > 0 )
 	{
-		if( link_target_identifier->data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		if( link_target_identifier_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 		{
 			libcerror_error_set(
 			 error,
@@ -240,130 +522,94 @@ ssize_t liblnk_link_target_identifier_read(
 
 			goto on_error;
 		}
-		link_target_identifier->data = (uint8_t *) memory_allocate(
-		                                            sizeof( uint8_t ) * link_target_identifier->data_size );
-
-
-		if( link_target_identifier->data == NULL )
+		/* When the file is parsed from memory the data is not read into a separate buffer
+		 */
+		result = liblnk_io_handle_get_data_at_offset(
+		          io_handle,
+		          file_offset + 2,
+		          link_target_identifier_size,
+		          &link_target_identifier_data,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create link target identifier data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve link target identifier data.",
 			 function );
 
 			goto on_error;
 		}
-		read_count = libbfio_handle_read_buffer(
-		              file_io_handle,
-		              link_target_identifier->data,
-		              link_target_identifier->data_size,
-		              error );
-
-		if( read_count != (ssize_t) link_target_identifier->data_size )
+		else if( result == 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read link target identifier data.",
-			 function );
+			read_buffer = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * link_target_identifier_size );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( libfwsi_item_list_initialize(
-			     &shell_item_list,
-			     error ) != 1 )
+			if( read_buffer == NULL )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create shell item list.",
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create link target identifier data.",
 				 function );
 
 				goto on_error;
 			}
-			if( libfwsi_item_list_copy_from_byte_stream(
-			     shell_item_list,
-			     link_target_identifier->data,
-			     link_target_identifier->data_size,
-			     io_handle->ascii_codepage,
-			     error ) != 1 )
+			read_count = liblnk_io_handle_read_buffer(
+			              io_handle,
+			              file_io_handle,
+			              read_buffer,
+			              link_target_identifier_size,
+			              error );
+
+			if( read_count != (ssize_t) link_target_identifier_size )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy byte stream to shell item list.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read link target identifier data.",
 				 function );
 
 				goto on_error;
 			}
-			if( libfwsi_item_list_get_data_size(
-			     shell_item_list,
-			     &shell_item_list_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve shell item list data size.",
-				 function );
+			link_target_identifier_data = read_buffer;
+		}
+		if( liblnk_link_target_identifier_read_data(
+		     link_target_identifier,
+		     io_handle,
+		     link_target_identifier_data,
+		     link_target_identifier_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read link target identifier.",
+			 function );
 
-				goto on_error;
-			}
-			if( libfwsi_item_list_free(
-			     &shell_item_list,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free shell item list.",
-				 function );
+			goto on_error;
+		}
+		if( read_buffer != NULL )
+		{
+			memory_free(
+			 read_buffer );
 
-				goto on_error;
-			}
-			if( shell_item_list_data_size < link_target_identifier->data_size )
-			{
-				libcnotify_printf(
-				 "%s: trailing data:\n",
-				 function );
-				libcnotify_print_data(
-				 &( link_target_identifier->data[ shell_item_list_data_size ] ),
-				 link_target_identifier->data_size - shell_item_list_data_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-			}
+			read_buffer = NULL;
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 	}
-	return( (ssize_t) ( link_target_identifier->data_size + 2 ) );
+	return( (ssize_t) ( link_target_identifier_size + 2 ) );
 
 on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( shell_item_list != NULL )
-	{
-		libfwsi_item_list_free(
-		 &shell_item_list,
-		 NULL );
-	}
-#endif
-	if( link_target_identifier->data != NULL )
+	if( read_buffer != NULL )
 	{
 		memory_free(
-		 link_target_identifier->data );
-
-		link_target_identifier->data = NULL;
+		 read_buffer );
 	}
-	link_target_identifier->data_size = 0;
-
 	return( -1 );
 }
 
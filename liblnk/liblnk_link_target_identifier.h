@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "liblnk_arena.h"
 #include "liblnk_io_handle.h"
 #include "liblnk_libbfio.h"
 #include "liblnk_libcerror.h"
@@ -39,21 +40,41 @@ struct liblnk_link_target_identifier
 {
 	/* The data
 	 */
-	uint8_t *data;
+	const uint8_t *data;
 
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* Value to indicate the data references a caller provided buffer
+	 */
+	uint8_t data_is_borrowed;
+
+	/* Value to indicate the structure is allocated from an arena
+	 */
+	uint8_t is_arena_allocated;
 };
 
 int liblnk_link_target_identifier_initialize(
      liblnk_link_target_identifier_t **link_target_identifier,
      libcerror_error_t **error );
 
+int liblnk_link_target_identifier_initialize_with_arena(
+     liblnk_link_target_identifier_t **link_target_identifier,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error );
+
 int liblnk_link_target_identifier_free(
      liblnk_link_target_identifier_t **link_target_identifier,
      libcerror_error_t **error );
 
+int liblnk_link_target_identifier_read_data(
+     liblnk_link_target_identifier_t *link_target_identifier,
+     liblnk_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 ssize_t liblnk_link_target_identifier_read(
          liblnk_link_target_identifier_t *link_target_identifier,
          liblnk_io_handle_t *io_handle,
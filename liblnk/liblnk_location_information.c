@@ -32,6 +32,8 @@
 #include "liblnk_libfwsi.h"
 #include "liblnk_libuna.h"
 #include "liblnk_location_information.h"
+#include "liblnk_string_size.h"
+#include "liblnk_utf8_string.h"
 
 #include "lnk_location_information.h"
 #include "lnk_network_share_information.h"
@@ -110,6 +112,77 @@ on_error:
 	return( -1 );
 }
 
+/* Creates location information
+ * The location information is allocated from the arena if set, otherwise it is allocated separately
+ * Make sure the value location_information is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_location_information_initialize_with_arena(
+     liblnk_location_information_t **location_information,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_location_information_initialize_with_arena";
+
+	if( location_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *location_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid location information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena == NULL )
+	{
+		if( liblnk_location_information_initialize(
+		     location_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create location information.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( liblnk_arena_allocate(
+	     arena,
+	     sizeof( liblnk_location_information_t ),
+	     (void **) location_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create location information.",
+		 function );
+
+		return( -1 );
+	}
+	( *location_information )->is_arena_allocated = 1;
+
+	return( 1 );
+}
+
 /* Frees location information
  * Returns 1 if successful or -1 on error
  */
@@ -118,6 +191,7 @@ int liblnk_location_information_free(
      libcerror_error_t **error )
 {
 	static char *function = "liblnk_location_information_free";
+	int result            = 1;
 
 	if( location_information == NULL )
 	{
@@ -132,36 +206,243 @@ int liblnk_location_information_free(
 	}
 	if( *location_information != NULL )
 	{
-		if( ( *location_information )->volume_label != NULL )
+		if( liblnk_location_information_clear(
+		     *location_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear location information.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *location_information )->is_arena_allocated == 0 )
+		{
+			memory_free(
+			 *location_information );
+		}
+		*location_information = NULL;
+	}
+	return( result );
+}
+
+/* Clears location information
+ * Frees the strings that are not borrowed and the cached paths
+ * this is also used for location information that is not allocated on the heap
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_location_information_clear(
+     liblnk_location_information_t *location_information,
+     libcerror_error_t **error )
+{
+	static char *function      = "liblnk_location_information_clear";
+	uint8_t is_arena_allocated = 0;
+
+	if( location_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location information.",
+		 function );
+
+		return( -1 );
+	}
+	if( location_information->cached_utf8_local_path != NULL )
+	{
+		memory_free(
+		 location_information->cached_utf8_local_path );
+	}
+	if( location_information->cached_utf8_network_path != NULL )
+	{
+		memory_free(
+		 location_information->cached_utf8_network_path );
+	}
+	if( location_information->cached_utf16_local_path != NULL )
+	{
+		memory_free(
+		 location_information->cached_utf16_local_path );
+	}
+	if( location_information->cached_utf16_network_path != NULL )
+	{
+		memory_free(
+		 location_information->cached_utf16_network_path );
+	}
+	if( location_information->data_is_borrowed == 0 )
+	{
+		if( location_information->volume_label != NULL )
 		{
 			memory_free(
-			 ( *location_information )->volume_label );
+			 (uint8_t *) location_information->volume_label );
 		}
-		if( ( *location_information )->local_path != NULL )
+		if( location_information->local_path != NULL )
 		{
 			memory_free(
-			 ( *location_information )->local_path );
+			 (uint8_t *) location_information->local_path );
 		}
-		if( ( *location_information )->network_share_name != NULL )
+		if( location_information->network_share_name != NULL )
 		{
 			memory_free(
-			 ( *location_information )->network_share_name );
+			 (uint8_t *) location_information->network_share_name );
 		}
-		if( ( *location_information )->device_name != NULL )
+		if( location_information->device_name != NULL )
 		{
 			memory_free(
-			 ( *location_information )->device_name );
+			 (uint8_t *) location_information->device_name );
 		}
-		if( ( *location_information )->common_path != NULL )
+		if( location_information->common_path != NULL )
 		{
 			memory_free(
-			 ( *location_information )->common_path );
+			 (uint8_t *) location_information->common_path );
 		}
-		memory_free(
-		 *location_information );
+	}
+	is_arena_allocated = location_information->is_arena_allocated;
 
-		*location_information = NULL;
+	if( memory_set(
+	     location_information,
+	     0,
+	     sizeof( liblnk_location_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear location information.",
+		 function );
+
+		return( -1 );
+	}
+	location_information->is_arena_allocated = is_arena_allocated;
+
+	return( 1 );
+}
+
+/* Sets a location information string
+ * The string data is referenced if the location information data is borrowed otherwise it is copied
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_location_information_set_string(
+     liblnk_location_information_t *location_information,
+     const uint8_t *string_data,
+     size_t string_data_size,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *string_copy  = NULL;
+	static char *function = "liblnk_location_information_set_string";
+
+	if( location_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location information.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( location_information->data_is_borrowed != 0 )
+	{
+		*string = string_data;
+	}
+	else
+	{
+		string_copy = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * string_data_size );
+
+		if( string_copy == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     string_copy,
+		     string_data,
+		     string_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string.",
+			 function );
+
+			memory_free(
+			 string_copy );
+
+			return( -1 );
+		}
+		*string = string_copy;
 	}
+	*string_size = string_data_size;
+
 	return( 1 );
 }
 
@@ -180,6 +461,7 @@ int liblnk_location_information_read_data(
 	const uint8_t *unicode_string_data             = NULL;
 	static char *function                          = "liblnk_location_information_read_data";
 	ssize_t read_count                             = 0;
+	size_t string_size                             = 0;
 	uint32_t common_path_offset                    = 0;
 	uint32_t device_name_offset                    = 0;
 	uint32_t local_path_offset                     = 0;
@@ -257,6 +539,13 @@ int liblnk_location_information_read_data(
 
 		return( -1 );
 	}
+	/* Reference the strings in the data instead of copying them
+	 * if the data is borrowed from a caller provided buffer
+	 */
+	if( ( io_handle->flags & LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED ) != 0 )
+	{
+		location_information->data_is_borrowed = 1;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -549,16 +838,22 @@ int liblnk_location_information_read_data(
 
 			string_data = &( location_information_value_data[ volume_label_offset ] );
 
-			for( value_size = 0;
-			     value_size < volume_label_data_size;
-			     value_size++ )
+			if( liblnk_string_size_from_byte_stream(
+			     string_data,
+			     (size_t) volume_label_data_size,
+			     &string_size,
+			     error ) == -1 )
 			{
-				if( string_data[ value_size ] == 0 )
-				{
-					value_size++;
-					break;
-				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine volume label size.",
+				 function );
+
+				goto on_error;
 			}
+			value_size = (uint32_t) string_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -594,17 +889,22 @@ int liblnk_location_information_read_data(
 
 			unicode_string_data = &( location_information_value_data[ unicode_volume_label_offset ] );
 
-			for( unicode_value_size = 0;
-			     ( unicode_value_size + 1 ) < volume_label_data_size;
-			     unicode_value_size += 2 )
+			if( liblnk_string_size_from_utf16_stream(
+			     unicode_string_data,
+			     (size_t) volume_label_data_size,
+			     &string_size,
+			     error ) == -1 )
 			{
-				if( ( unicode_string_data[ unicode_value_size ] == 0 )
-				 && ( unicode_string_data[ unicode_value_size + 1 ] == 0 ) )
-				{
-					unicode_value_size += 2;
-					break;
-				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine unicode volume label size.",
+				 function );
+
+				goto on_error;
 			}
+			unicode_value_size = (uint32_t) string_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -623,68 +923,44 @@ int liblnk_location_information_read_data(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			location_information->volume_label = (uint8_t *) memory_allocate(
-			                                                  sizeof( uint8_t ) * unicode_value_size );
-
-			if( location_information->volume_label == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create volume label.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     location_information->volume_label,
+			if( liblnk_location_information_set_string(
+			     location_information,
 			     unicode_string_data,
-			     unicode_value_size ) == NULL )
+			     (size_t) unicode_value_size,
+			     &( location_information->volume_label ),
+			     &( location_information->volume_label_size ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy volume label.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set volume label.",
 				 function );
 
 				goto on_error;
 			}
-			location_information->volume_label_size = unicode_value_size;
-			location_information->string_flags     |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_VOLUME_LABEL_IS_UNICODE;
+			location_information->string_flags |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_VOLUME_LABEL_IS_UNICODE;
 		}
 		else if( volume_label_offset > 0 )
 		{
-			location_information->volume_label = (uint8_t *) memory_allocate(
-			                                                  sizeof( uint8_t ) * value_size );
-
-			if( location_information->volume_label == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create volume label.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     location_information->volume_label,
+			if( liblnk_location_information_set_string(
+			     location_information,
 			     string_data,
-			     value_size ) == NULL )
+			     (size_t) value_size,
+			     &( location_information->volume_label ),
+			     &( location_information->volume_label_size ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy volume label.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set volume label.",
 				 function );
 
 				goto on_error;
 			}
-			location_information->volume_label_size = value_size;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -764,18 +1040,24 @@ int liblnk_location_information_read_data(
 			}
 			string_data = &( data[ local_path_offset ] );
 
-			for( value_size = 0;
-			     value_size < ( data_size - local_path_offset );
-			     value_size++ )
+			if( liblnk_string_size_from_byte_stream(
+			     string_data,
+			     (size_t) data_size - local_path_offset,
+			     &string_size,
+			     error ) == -1 )
 			{
-				if( string_data[ value_size ] == 0 )
-				{
-					value_size++;
-					break;
-				}
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine local path size.",
+				 function );
+
+				goto on_error;
+			}
+			value_size = (uint32_t) string_size;
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
 			{
 				libcnotify_printf(
 				 "%s: local path data size\t\t\t\t\t: %" PRIu32 "\n",
@@ -820,17 +1102,22 @@ int liblnk_location_information_read_data(
 			}
 			unicode_string_data = &( data[ unicode_local_path_offset ] );
 
-			for( unicode_value_size = 0;
-			     ( unicode_value_size + 1 ) < ( data_size - unicode_local_path_offset );
-			     unicode_value_size += 2 )
+			if( liblnk_string_size_from_utf16_stream(
+			     unicode_string_data,
+			     (size_t) data_size - unicode_local_path_offset,
+			     &string_size,
+			     error ) == -1 )
 			{
-				if( ( unicode_string_data[ unicode_value_size ] == 0 )
-				 && ( unicode_string_data[ unicode_value_size + 1 ] == 0 ) )
-				{
-					unicode_value_size += 2;
-					break;
-				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine unicode local path size.",
+				 function );
+
+				goto on_error;
 			}
+			unicode_value_size = (uint32_t) string_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -849,68 +1136,44 @@ int liblnk_location_information_read_data(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			location_information->local_path = (uint8_t *) memory_allocate(
-			                                                sizeof( uint8_t ) * unicode_value_size );
-
-			if( location_information->local_path == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create local path.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     location_information->local_path,
+			if( liblnk_location_information_set_string(
+			     location_information,
 			     unicode_string_data,
-			     unicode_value_size ) == NULL )
+			     (size_t) unicode_value_size,
+			     &( location_information->local_path ),
+			     &( location_information->local_path_size ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy local path.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set local path.",
 				 function );
 
 				goto on_error;
 			}
-			location_information->local_path_size = unicode_value_size;
-			location_information->string_flags   |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_LOCAL_PATH_IS_UNICODE;
+			location_information->string_flags |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_LOCAL_PATH_IS_UNICODE;
 		}
 		else if( local_path_offset > 0 )
 		{
-			location_information->local_path = (uint8_t *) memory_allocate(
-			                                                sizeof( uint8_t ) * value_size );
-
-			if( location_information->local_path == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create local path.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     location_information->local_path,
+			if( liblnk_location_information_set_string(
+			     location_information,
 			     string_data,
-			     value_size ) == NULL )
+			     (size_t) value_size,
+			     &( location_information->local_path ),
+			     &( location_information->local_path_size ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy local path.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set local path.",
 				 function );
 
 				goto on_error;
 			}
-			location_information->local_path_size = value_size;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -1141,16 +1404,22 @@ int liblnk_location_information_read_data(
 			}
 			string_data = &( location_information_value_data[ network_share_name_offset ] );
 
-			for( value_size = 0;
-			     value_size < ( location_information_value_size - network_share_name_offset );
-			     value_size++ )
+			if( liblnk_string_size_from_byte_stream(
+			     string_data,
+			     (size_t) location_information_value_size - network_share_name_offset,
+			     &string_size,
+			     error ) == -1 )
 			{
-				if( string_data[ value_size ] == 0 )
-				{
-					value_size++;
-					break;
-				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine network share name size.",
+				 function );
+
+				goto on_error;
 			}
+			value_size = (uint32_t) string_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -1184,17 +1453,22 @@ int liblnk_location_information_read_data(
 			}
 			unicode_string_data = &( location_information_value_data[ unicode_network_share_name_offset ] );
 
-			for( unicode_value_size = 0;
-			     ( unicode_value_size + 1 ) < ( location_information_value_size - unicode_network_share_name_offset );
-			     unicode_value_size += 2 )
+			if( liblnk_string_size_from_utf16_stream(
+			     unicode_string_data,
+			     (size_t) location_information_value_size - unicode_network_share_name_offset,
+			     &string_size,
+			     error ) == -1 )
 			{
-				if( ( unicode_string_data[ unicode_value_size ] == 0 )
-				 && ( unicode_string_data[ unicode_value_size + 1 ] == 0 ) )
-				{
-					unicode_value_size += 2;
-					break;
-				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine unicode network share name size.",
+				 function );
+
+				goto on_error;
 			}
+			unicode_value_size = (uint32_t) string_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -1213,68 +1487,44 @@ int liblnk_location_information_read_data(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			location_information->network_share_name = (uint8_t *) memory_allocate(
-			                                                        sizeof( uint8_t ) * unicode_value_size );
-
-			if( location_information->network_share_name == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create network share name.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     location_information->network_share_name,
+			if( liblnk_location_information_set_string(
+			     location_information,
 			     unicode_string_data,
-			     unicode_value_size ) == NULL )
+			     (size_t) unicode_value_size,
+			     &( location_information->network_share_name ),
+			     &( location_information->network_share_name_size ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy network share name.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set network share name.",
 				 function );
 
 				goto on_error;
 			}
-			location_information->network_share_name_size = unicode_value_size;
-			location_information->string_flags           |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_NETWORK_SHARE_NAME_IS_UNICODE;
+			location_information->string_flags |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_NETWORK_SHARE_NAME_IS_UNICODE;
 		}
 		else if( network_share_name_offset > 0 )
 		{
-			location_information->network_share_name = (uint8_t *) memory_allocate(
-										sizeof( uint8_t ) * value_size );
-
-			if( location_information->network_share_name == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create network share name.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     location_information->network_share_name,
+			if( liblnk_location_information_set_string(
+			     location_information,
 			     string_data,
-			     value_size ) == NULL )
+			     (size_t) value_size,
+			     &( location_information->network_share_name ),
+			     &( location_information->network_share_name_size ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy network share name.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set network share name.",
 				 function );
 
 				goto on_error;
 			}
-			location_information->network_share_name_size = value_size;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -1340,16 +1590,22 @@ int liblnk_location_information_read_data(
 			}
 			string_data = &( location_information_value_data[ device_name_offset ] );
 
-			for( value_size = 0;
-			     value_size < ( location_information_value_size - device_name_offset );
-			     value_size++ )
+			if( liblnk_string_size_from_byte_stream(
+			     string_data,
+			     (size_t) location_information_value_size - device_name_offset,
+			     &string_size,
+			     error ) == -1 )
 			{
-				if( string_data[ value_size ] == 0 )
-				{
-					value_size++;
-					break;
-				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine device name size.",
+				 function );
+
+				goto on_error;
 			}
+			value_size = (uint32_t) string_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -1383,17 +1639,22 @@ int liblnk_location_information_read_data(
 			}
 			unicode_string_data = &( location_information_value_data[ unicode_device_name_offset ] );
 
-			for( unicode_value_size = 0;
-			     ( unicode_value_size + 1 ) < ( location_information_value_size - unicode_device_name_offset );
-			     unicode_value_size += 2 )
+			if( liblnk_string_size_from_utf16_stream(
+			     unicode_string_data,
+			     (size_t) location_information_value_size - unicode_device_name_offset,
+			     &string_size,
+			     error ) == -1 )
 			{
-				if( ( unicode_string_data[ unicode_value_size ] == 0 )
-				 && ( unicode_string_data[ unicode_value_size + 1 ] == 0 ) )
-				{
-					unicode_value_size += 2;
-					break;
-				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine unicode device name size.",
+				 function );
+
+				goto on_error;
 			}
+			unicode_value_size = (uint32_t) string_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -1412,68 +1673,44 @@ int liblnk_location_information_read_data(
 			}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-			location_information->device_name = (uint8_t *) memory_allocate(
-			                                                 sizeof( uint8_t ) * unicode_value_size );
-
-			if( location_information->device_name == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create device name.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     location_information->device_name,
+			if( liblnk_location_information_set_string(
+			     location_information,
 			     unicode_string_data,
-			     unicode_value_size ) == NULL )
+			     (size_t) unicode_value_size,
+			     &( location_information->device_name ),
+			     &( location_information->device_name_size ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy device name.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set device name.",
 				 function );
 
 				goto on_error;
 			}
-			location_information->device_name_size = unicode_value_size;
-			location_information->string_flags    |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_DEVICE_NAME_IS_UNICODE;
+			location_information->string_flags |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_DEVICE_NAME_IS_UNICODE;
 		}
 		else if( device_name_offset > 0 )
 		{
-			location_information->device_name = (uint8_t *) memory_allocate(
-			                                                 sizeof( uint8_t ) * value_size );
-
-			if( location_information->device_name == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create device name.",
-				 function );
-
-				goto on_error;
-			}
-			if( memory_copy(
-			     location_information->device_name,
+			if( liblnk_location_information_set_string(
+			     location_information,
 			     string_data,
-			     value_size ) == NULL )
+			     (size_t) value_size,
+			     &( location_information->device_name ),
+			     &( location_information->device_name_size ),
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to copy device name.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set device name.",
 				 function );
 
 				goto on_error;
 			}
-			location_information->device_name_size = value_size;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -1554,16 +1791,22 @@ int liblnk_location_information_read_data(
 		}
 		string_data = &( data[ common_path_offset ] );
 
-		for( value_size = 0;
-		     value_size < ( data_size - common_path_offset );
-		     value_size++ )
+		if( liblnk_string_size_from_byte_stream(
+		     string_data,
+		     (size_t) data_size - common_path_offset,
+		     &string_size,
+		     error ) == -1 )
 		{
-			if( string_data[ value_size ] == 0 )
-			{
-				value_size++;
-				break;
-			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine common path size.",
+			 function );
+
+			goto on_error;
 		}
+		value_size = (uint32_t) string_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -1610,17 +1853,22 @@ int liblnk_location_information_read_data(
 		}
 		unicode_string_data = &( data[ unicode_common_path_offset ] );
 
-		for( unicode_value_size = 0;
-		     ( unicode_value_size + 1 ) < ( data_size - unicode_common_path_offset );
-		     unicode_value_size += 2 )
+		if( liblnk_string_size_from_utf16_stream(
+		     unicode_string_data,
+		     (size_t) data_size - unicode_common_path_offset,
+		     &string_size,
+		     error ) == -1 )
 		{
-			if( ( unicode_string_data[ unicode_value_size ] == 0 )
-			 && ( unicode_string_data[ unicode_value_size + 1 ] == 0 ) )
-			{
-				unicode_value_size += 2;
-				break;
-			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine unicode common path size.",
+			 function );
+
+			goto on_error;
 		}
+		unicode_value_size = (uint32_t) string_size;
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -1639,68 +1887,44 @@ int liblnk_location_information_read_data(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		location_information->common_path = (uint8_t *) memory_allocate(
-		                                                 sizeof( uint8_t ) * unicode_value_size );
-
-		if( location_information->common_path == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create common path.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     location_information->common_path,
+		if( liblnk_location_information_set_string(
+		     location_information,
 		     unicode_string_data,
-		     unicode_value_size ) == NULL )
+		     (size_t) unicode_value_size,
+		     &( location_information->common_path ),
+		     &( location_information->common_path_size ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy common path.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set common path.",
 			 function );
 
 			goto on_error;
 		}
-		location_information->common_path_size = unicode_value_size;
-		location_information->string_flags    |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_COMMON_PATH_IS_UNICODE;
+		location_information->string_flags |= LIBLNK_LOCATION_INFORMATION_STRING_FLAG_COMMON_PATH_IS_UNICODE;
 	}
 	else if( common_path_offset > 0 )
 	{
-		location_information->common_path = (uint8_t *) memory_allocate(
-		                                                 sizeof( uint8_t ) * value_size );
-
-		if( location_information->common_path == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create common path.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     location_information->common_path,
+		if( liblnk_location_information_set_string(
+		     location_information,
 		     string_data,
-		     value_size ) == NULL )
+		     (size_t) value_size,
+		     &( location_information->common_path ),
+		     &( location_information->common_path_size ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy common path.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set common path.",
 			 function );
 
 			goto on_error;
 		}
-		location_information->common_path_size = value_size;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1757,37 +1981,47 @@ int liblnk_location_information_read_data(
 on_error:
 	if( location_information->common_path != NULL )
 	{
-		memory_free(
-		 location_information->common_path );
-
+		if( location_information->data_is_borrowed == 0 )
+		{
+			memory_free(
+			 (uint8_t *) location_information->common_path );
+		}
 		location_information->common_path = NULL;
 	}
 	if( location_information->device_name != NULL )
 	{
-		memory_free(
-		 location_information->device_name );
-
+		if( location_information->data_is_borrowed == 0 )
+		{
+			memory_free(
+			 (uint8_t *) location_information->device_name );
+		}
 		location_information->device_name = NULL;
 	}
 	if( location_information->network_share_name != NULL )
 	{
-		memory_free(
-		 location_information->network_share_name );
-
+		if( location_information->data_is_borrowed == 0 )
+		{
+			memory_free(
+			 (uint8_t *) location_information->network_share_name );
+		}
 		location_information->network_share_name = NULL;
 	}
 	if( location_information->local_path != NULL )
 	{
-		memory_free(
-		 location_information->local_path );
-
+		if( location_information->data_is_borrowed == 0 )
+		{
+			memory_free(
+			 (uint8_t *) location_information->local_path );
+		}
 		location_information->local_path = NULL;
 	}
 	if( location_information->volume_label != NULL )
 	{
-		memory_free(
-		 location_information->volume_label );
-
+		if( location_information->data_is_borrowed == 0 )
+		{
+			memory_free(
+			 (uint8_t *) location_information->volume_label );
+		}
 		location_information->volume_label = NULL;
 	}
 	return( -1 );
@@ -1805,10 +2039,12 @@ ssize_t liblnk_location_information_read(
 {
 	uint8_t location_information_size_data[ 4 ];
 
-	uint8_t *location_information_data = NULL;
-	static char *function              = "liblnk_location_information_read";
-	size_t location_information_size   = 0;
-	ssize_t read_count                 = 0;
+	const uint8_t *location_information_data = NULL;
+	uint8_t *read_buffer                     = NULL;
+	static char *function                    = "liblnk_location_information_read";
+	size_t location_information_size         = 0;
+	ssize_t read_count                       = 0;
+	int result                               = 0;
 
 	if( location_information == NULL )
 	{
@@ -1831,7 +2067,8 @@ ssize_t liblnk_location_information_read(
 		 location_information_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = liblnk_io_handle_read_buffer_at_offset(
+	              io_handle,
 	              file_io_handle,
 	              location_information_size_data,
 	              4,
@@ -1869,94 +2106,554 @@ ssize_t liblnk_location_information_read(
 #if defined( HAVE_VERBOSE_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
-			libcnotify_printf(
-			 "%s: empty location information.\n",
-			 function );
+			libcnotify_printf(
+			 "%s: empty location information.\n",
+			 function );
+		}
+#endif
+		return( read_count );
+	}
+	if( location_information_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: location information size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	location_information_size -= 4;
+
+	/* When the file is parsed from memory the data is not read into a separate buffer
+	 */
+	result = liblnk_io_handle_get_data_at_offset(
+	          io_handle,
+	          location_information_offset + 4,
+	          location_information_size,
+	          &location_information_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve location information data.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		read_buffer = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * location_information_size );
+
+		if( read_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create location information data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = liblnk_io_handle_read_buffer(
+		              io_handle,
+		              file_io_handle,
+		              read_buffer,
+		              location_information_size,
+		              error );
+
+		if( read_count != (ssize_t) location_information_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read location information data.",
+			 function );
+
+			goto on_error;
+		}
+		location_information_data = read_buffer;
+	}
+	if( liblnk_location_information_read_data(
+	     location_information,
+	     io_handle,
+	     location_information_data,
+	     location_information_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read location information.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+
+		read_buffer = NULL;
+	}
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( (ssize_t) ( location_information_size + 4 ) );
+
+on_error:
+	if( read_buffer != NULL )
+	{
+		memory_free(
+		 read_buffer );
+	}
+	return( -1 );
+}
+
+/* Determines if the location information has a cached path for the specified conversion
+ * Returns 1 if cached or 0 if not
+ */
+int liblnk_location_information_has_cached_path(
+     liblnk_location_information_t *location_information,
+     int ascii_codepage,
+     int path_type,
+     int string_format )
+{
+	void *cached_path   = NULL;
+	int cached_codepage = 0;
+
+	if( location_information == NULL )
+	{
+		return( 0 );
+	}
+	if( path_type == LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL )
+	{
+		if( string_format == LIBLNK_DATA_STRING_FORMAT_UTF8 )
+		{
+			cached_path     = (void *) location_information->cached_utf8_local_path;
+			cached_codepage = location_information->cached_utf8_local_path_codepage;
+		}
+		else if( string_format == LIBLNK_DATA_STRING_FORMAT_UTF16 )
+		{
+			cached_path     = (void *) location_information->cached_utf16_local_path;
+			cached_codepage = location_information->cached_utf16_local_path_codepage;
+		}
+	}
+	else if( path_type == LIBLNK_LOCATION_INFORMATION_PATH_TYPE_NETWORK )
+	{
+		if( string_format == LIBLNK_DATA_STRING_FORMAT_UTF8 )
+		{
+			cached_path     = (void *) location_information->cached_utf8_network_path;
+			cached_codepage = location_information->cached_utf8_network_path_codepage;
+		}
+		else if( string_format == LIBLNK_DATA_STRING_FORMAT_UTF16 )
+		{
+			cached_path     = (void *) location_information->cached_utf16_network_path;
+			cached_codepage = location_information->cached_utf16_network_path_codepage;
+		}
+	}
+	if( cached_path == NULL )
+	{
+		return( 0 );
+	}
+	if( cached_codepage != ascii_codepage )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Composes the path from its parts and caches the result for the specified conversion
+ * A previously cached path of the same type and format is replaced
+ * Returns 1 if successful, 0 if the path is not available or -1 on error
+ */
+int liblnk_location_information_cache_path(
+     liblnk_location_information_t *location_information,
+     int ascii_codepage,
+     int path_type,
+     int string_format,
+     libcerror_error_t **error )
+{
+	uint8_t *utf8_string     = NULL;
+	uint16_t *utf16_string   = NULL;
+	static char *function    = "liblnk_location_information_cache_path";
+	size_t utf8_string_size  = 0;
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	if( location_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_type != LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL )
+	 && ( path_type != LIBLNK_LOCATION_INFORMATION_PATH_TYPE_NETWORK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported path type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_format != LIBLNK_DATA_STRING_FORMAT_UTF8 )
+	 && ( string_format != LIBLNK_DATA_STRING_FORMAT_UTF16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string format.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_location_information_has_cached_path(
+	     location_information,
+	     ascii_codepage,
+	     path_type,
+	     string_format ) != 0 )
+	{
+		return( 1 );
+	}
+	if( string_format == LIBLNK_DATA_STRING_FORMAT_UTF8 )
+	{
+		if( path_type == LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL )
+		{
+			result = liblnk_location_information_get_utf8_local_path_size(
+			          location_information,
+			          ascii_codepage,
+			          &utf8_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_location_information_get_utf8_network_path_size(
+			          location_information,
+			          ascii_codepage,
+			          &utf8_string_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 path string size.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( ( utf8_string_size == 0 )
+		 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 path string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf8_string = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * utf8_string_size );
+
+		if( utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 path string.",
+			 function );
+
+			goto on_error;
+		}
+		if( path_type == LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL )
+		{
+			result = liblnk_location_information_get_utf8_local_path(
+			          location_information,
+			          ascii_codepage,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_location_information_get_utf8_network_path(
+			          location_information,
+			          ascii_codepage,
+			          utf8_string,
+			          utf8_string_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 path string.",
+			 function );
+
+			goto on_error;
+		}
+		if( path_type == LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL )
+		{
+			if( location_information->cached_utf8_local_path != NULL )
+			{
+				memory_free(
+				 location_information->cached_utf8_local_path );
+
+				location_information->cached_utf8_local_path = NULL;
+			}
+			location_information->cached_utf8_local_path_size     = utf8_string_size;
+			location_information->cached_utf8_local_path_codepage = ascii_codepage;
+
+			/* The path is set last so that it is completely filled in
+			 * before it is used to determine the path is cached
+			 */
+			location_information->cached_utf8_local_path = utf8_string;
+		}
+		else
+		{
+			if( location_information->cached_utf8_network_path != NULL )
+			{
+				memory_free(
+				 location_information->cached_utf8_network_path );
+
+				location_information->cached_utf8_network_path = NULL;
+			}
+			location_information->cached_utf8_network_path_size     = utf8_string_size;
+			location_information->cached_utf8_network_path_codepage = ascii_codepage;
+
+			/* The path is set last so that it is completely filled in
+			 * before it is used to determine the path is cached
+			 */
+			location_information->cached_utf8_network_path = utf8_string;
+		}
+	}
+	else
+	{
+		if( path_type == LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL )
+		{
+			result = liblnk_location_information_get_utf16_local_path_size(
+			          location_information,
+			          ascii_codepage,
+			          &utf16_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_location_information_get_utf16_network_path_size(
+			          location_information,
+			          ascii_codepage,
+			          &utf16_string_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 path string size.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( ( utf16_string_size == 0 )
+		 || ( utf16_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-16 path string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		utf16_string = (uint16_t *) memory_allocate(
+		                             sizeof( uint16_t ) * utf16_string_size );
+
+		if( utf16_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 path string.",
+			 function );
+
+			goto on_error;
+		}
+		if( path_type == LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL )
+		{
+			result = liblnk_location_information_get_utf16_local_path(
+			          location_information,
+			          ascii_codepage,
+			          utf16_string,
+			          utf16_string_size,
+			          error );
+		}
+		else
+		{
+			result = liblnk_location_information_get_utf16_network_path(
+			          location_information,
+			          ascii_codepage,
+			          utf16_string,
+			          utf16_string_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 path string.",
+			 function );
+
+			goto on_error;
+		}
+		if( path_type == LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL )
+		{
+			if( location_information->cached_utf16_local_path != NULL )
+			{
+				memory_free(
+				 location_information->cached_utf16_local_path );
+
+				location_information->cached_utf16_local_path = NULL;
+			}
+			location_information->cached_utf16_local_path_size     = utf16_string_size;
+			location_information->cached_utf16_local_path_codepage = ascii_codepage;
+
+			/* The path is set last so that it is completely filled in
+			 * before it is used to determine the path is cached
+			 */
+			location_information->cached_utf16_local_path = utf16_string;
+		}
+		else
+		{
+			if( location_information->cached_utf16_network_path != NULL )
+			{
+				memory_free(
+				 location_information->cached_utf16_network_path );
+
+				location_information->cached_utf16_network_path = NULL;
+			}
+			location_information->cached_utf16_network_path_size     = utf16_string_size;
+			location_information->cached_utf16_network_path_codepage = ascii_codepage;
+
+			/* The path is set last so that it is completely filled in
+			 * before it is used to determine the path is cached
+			 */
+			location_information->cached_utf16_network_path = utf16_string;
 		}
-#endif
-		return( read_count );
 	}
-	if( location_information_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: location information size value exceeds maximum.",
-		 function );
+	return( 1 );
 
-		goto on_error;
+on_error:
+	if( utf16_string != NULL )
+	{
+		memory_free(
+		 utf16_string );
 	}
-	location_information_size -= 4;
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+}
 
-	location_information_data = (uint8_t *) memory_allocate(
-	                                         sizeof( uint8_t ) * location_information_size );
+/* Clears the cached paths
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_location_information_clear_cache(
+     liblnk_location_information_t *location_information,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_location_information_clear_cache";
 
-	if( location_information_data == NULL )
+	if( location_information == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create location information data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location information.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              location_information_data,
-	              location_information_size,
-	              error );
-
-	if( read_count != (ssize_t) location_information_size )
+	if( location_information->cached_utf8_local_path != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read location information data.",
-		 function );
+		memory_free(
+		 location_information->cached_utf8_local_path );
 
-		goto on_error;
+		location_information->cached_utf8_local_path = NULL;
 	}
-	if( liblnk_location_information_read_data(
-	     location_information,
-	     io_handle,
-	     location_information_data,
-	     location_information_size,
-	     error ) != 1 )
+	if( location_information->cached_utf8_network_path != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read location information.",
-		 function );
+		memory_free(
+		 location_information->cached_utf8_network_path );
 
-		goto on_error;
+		location_information->cached_utf8_network_path = NULL;
 	}
-	memory_free(
-	 location_information_data );
-
-	location_information_data = NULL;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( location_information->cached_utf16_local_path != NULL )
 	{
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	return( read_count + 4 );
+		memory_free(
+		 location_information->cached_utf16_local_path );
 
-on_error:
-	if( location_information_data != NULL )
+		location_information->cached_utf16_local_path = NULL;
+	}
+	if( location_information->cached_utf16_network_path != NULL )
 	{
 		memory_free(
-		 location_information_data );
+		 location_information->cached_utf16_network_path );
+
+		location_information->cached_utf16_network_path = NULL;
 	}
-	return( -1 );
+	location_information->cached_utf8_local_path_size    = 0;
+	location_information->cached_utf8_network_path_size  = 0;
+	location_information->cached_utf16_local_path_size   = 0;
+	location_information->cached_utf16_network_path_size = 0;
+
+	return( 1 );
 }
 
 /* Retrieves the size of the UTF-8 encoded volume label
@@ -2001,7 +2698,7 @@ int liblnk_location_information_get_utf8_volume_label_size(
 	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_VOLUME_LABEL_IS_UNICODE ) != 0 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = liblnk_utf8_string_size_from_utf16_stream(
 			  location_information->volume_label,
 			  location_information->volume_label_size,
 			  LIBUNA_ENDIAN_LITTLE,
@@ -2047,6 +2744,45 @@ int liblnk_location_information_get_utf8_volume_label(
 	size_t string_index   = 0;
 	int result            = 0;
 
+	result = liblnk_location_information_get_utf8_volume_label_with_index(
+	          location_information,
+	          ascii_codepage,
+	          utf8_string,
+	          utf8_string_size,
+	          &string_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 volume label string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded volume label
+ * The size should include the end of string character
+ * The string is copied at the string index, which is set to the index after the end of string character
+ * The volume label is only set if the link refers to a file on a local volume
+ * Returns 1 if successful, 0 if value is not available or -1 on error
+ */
+int liblnk_location_information_get_utf8_volume_label_with_index(
+     liblnk_location_information_t *location_information,
+     int ascii_codepage,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_location_information_get_utf8_volume_label_with_index";
+	int result            = 0;
+
 	if( location_information == NULL )
 	{
 		libcerror_error_set(
@@ -2081,16 +2817,27 @@ int liblnk_location_information_get_utf8_volume_label(
 
 		return( -1 );
 	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( location_information->flags & LIBLNK_LOCATION_FLAG_HAS_VOLUME_INFORMATION ) == 0 )
 	{
 		return( 0 );
 	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_VOLUME_LABEL_IS_UNICODE ) != 0 )
 	{
-		result = libuna_utf8_string_with_index_copy_from_utf16_stream(
+		result = liblnk_utf8_string_with_index_copy_from_utf16_stream(
 			  utf8_string,
 			  utf8_string_size,
-			  &string_index,
+			  utf8_string_index,
 			  location_information->volume_label,
 			  location_information->volume_label_size,
 			  LIBUNA_ENDIAN_LITTLE,
@@ -2101,7 +2848,7 @@ int liblnk_location_information_get_utf8_volume_label(
 		result = libuna_utf8_string_with_index_copy_from_byte_stream(
 			  utf8_string,
 			  utf8_string_size,
-			  &string_index,
+			  utf8_string_index,
 			  location_information->volume_label,
 			  location_information->volume_label_size,
 			  ascii_codepage,
@@ -2209,6 +2956,45 @@ int liblnk_location_information_get_utf16_volume_label(
 	size_t string_index   = 0;
 	int result            = 0;
 
+	result = liblnk_location_information_get_utf16_volume_label_with_index(
+	          location_information,
+	          ascii_codepage,
+	          utf16_string,
+	          utf16_string_size,
+	          &string_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 volume label string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-16 encoded volume label
+ * The size should include the end of string character
+ * The string is copied at the string index, which is set to the index after the end of string character
+ * The volume label is only set if the link refers to a file on a local volume
+ * Returns 1 if successful, 0 if value is not available or -1 on error
+ */
+int liblnk_location_information_get_utf16_volume_label_with_index(
+     liblnk_location_information_t *location_information,
+     int ascii_codepage,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_location_information_get_utf16_volume_label_with_index";
+	int result            = 0;
+
 	if( location_information == NULL )
 	{
 		libcerror_error_set(
@@ -2243,6 +3029,17 @@ int liblnk_location_information_get_utf16_volume_label(
 
 		return( -1 );
 	}
+	if( utf16_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string index.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( location_information->flags & LIBLNK_LOCATION_FLAG_HAS_VOLUME_INFORMATION ) == 0 )
 	{
 		return( 0 );
@@ -2252,7 +3049,7 @@ int liblnk_location_information_get_utf16_volume_label(
 		result = libuna_utf16_string_with_index_copy_from_utf16_stream(
 			  utf16_string,
 			  utf16_string_size,
-			  &string_index,
+			  utf16_string_index,
 			  location_information->volume_label,
 			  location_information->volume_label_size,
 			  LIBUNA_ENDIAN_LITTLE,
@@ -2263,7 +3060,7 @@ int liblnk_location_information_get_utf16_volume_label(
 		result = libuna_utf16_string_with_index_copy_from_byte_stream(
 			  utf16_string,
 			  utf16_string_size,
-			  &string_index,
+			  utf16_string_index,
 			  location_information->volume_label,
 			  location_information->volume_label_size,
 			  ascii_codepage,
@@ -2326,9 +3123,19 @@ int liblnk_location_information_get_utf8_local_path_size(
 	{
 		return( 0 );
 	}
+	if( liblnk_location_information_has_cached_path(
+	     location_information,
+	     ascii_codepage,
+	     LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	     LIBLNK_DATA_STRING_FORMAT_UTF8 ) != 0 )
+	{
+		*utf8_string_size = location_information->cached_utf8_local_path_size;
+
+		return( 1 );
+	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_LOCAL_PATH_IS_UNICODE ) != 0 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = liblnk_utf8_string_size_from_utf16_stream(
 			  location_information->local_path,
 			  location_information->local_path_size,
 			  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
@@ -2412,7 +3219,7 @@ int liblnk_location_information_get_utf8_local_path_size(
 	{
 		if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_COMMON_PATH_IS_UNICODE ) != 0 )
 		{
-			result = libuna_utf8_string_size_from_utf16_stream(
+			result = liblnk_utf8_string_size_from_utf16_stream(
 				  location_information->common_path,
 				  location_information->common_path_size,
 				  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
@@ -2500,9 +3307,42 @@ int liblnk_location_information_get_utf8_local_path(
 	{
 		return( 0 );
 	}
+	if( liblnk_location_information_has_cached_path(
+	     location_information,
+	     ascii_codepage,
+	     LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	     LIBLNK_DATA_STRING_FORMAT_UTF8 ) != 0 )
+	{
+		if( utf8_string_size < location_information->cached_utf8_local_path_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     location_information->cached_utf8_local_path,
+		     sizeof( uint8_t ) * location_information->cached_utf8_local_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-8 local path.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_LOCAL_PATH_IS_UNICODE ) != 0 )
 	{
-		result = libuna_utf8_string_with_index_copy_from_utf16_stream(
+		result = liblnk_utf8_string_with_index_copy_from_utf16_stream(
 			  utf8_string,
 			  utf8_string_size,
 			  &string_index,
@@ -2603,7 +3443,7 @@ int liblnk_location_information_get_utf8_local_path(
 	{
 		if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_COMMON_PATH_IS_UNICODE ) != 0 )
 		{
-			result = libuna_utf8_string_with_index_copy_from_utf16_stream(
+			result = liblnk_utf8_string_with_index_copy_from_utf16_stream(
 				  utf8_string,
 				  utf8_string_size,
 				  &string_index,
@@ -2681,6 +3521,16 @@ int liblnk_location_information_get_utf16_local_path_size(
 	{
 		return( 0 );
 	}
+	if( liblnk_location_information_has_cached_path(
+	     location_information,
+	     ascii_codepage,
+	     LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	     LIBLNK_DATA_STRING_FORMAT_UTF16 ) != 0 )
+	{
+		*utf16_string_size = location_information->cached_utf16_local_path_size;
+
+		return( 1 );
+	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_LOCAL_PATH_IS_UNICODE ) != 0 )
 	{
 		result = libuna_utf16_string_size_from_utf16_stream(
@@ -2855,6 +3705,39 @@ int liblnk_location_information_get_utf16_local_path(
 	{
 		return( 0 );
 	}
+	if( liblnk_location_information_has_cached_path(
+	     location_information,
+	     ascii_codepage,
+	     LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	     LIBLNK_DATA_STRING_FORMAT_UTF16 ) != 0 )
+	{
+		if( utf16_string_size < location_information->cached_utf16_local_path_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-16 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf16_string,
+		     location_information->cached_utf16_local_path,
+		     sizeof( uint16_t ) * location_information->cached_utf16_local_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-16 local path.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_LOCAL_PATH_IS_UNICODE ) != 0 )
 	{
 		result = libuna_utf16_string_with_index_copy_from_utf16_stream(
@@ -3036,9 +3919,19 @@ int liblnk_location_information_get_utf8_network_path_size(
 	{
 		return( 0 );
 	}
+	if( liblnk_location_information_has_cached_path(
+	     location_information,
+	     ascii_codepage,
+	     LIBLNK_LOCATION_INFORMATION_PATH_TYPE_NETWORK,
+	     LIBLNK_DATA_STRING_FORMAT_UTF8 ) != 0 )
+	{
+		*utf8_string_size = location_information->cached_utf8_network_path_size;
+
+		return( 1 );
+	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_NETWORK_SHARE_NAME_IS_UNICODE ) != 0 )
 	{
-		result = libuna_utf8_string_size_from_utf16_stream(
+		result = liblnk_utf8_string_size_from_utf16_stream(
 			  location_information->network_share_name,
 			  location_information->network_share_name_size,
 			  LIBUNA_ENDIAN_LITTLE,
@@ -3122,7 +4015,7 @@ int liblnk_location_information_get_utf8_network_path_size(
 	{
 		if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_COMMON_PATH_IS_UNICODE ) != 0 )
 		{
-			result = libuna_utf8_string_size_from_utf16_stream(
+			result = liblnk_utf8_string_size_from_utf16_stream(
 				  location_information->common_path,
 				  location_information->common_path_size,
 				  LIBUNA_ENDIAN_LITTLE | LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE,
@@ -3210,9 +4103,42 @@ int liblnk_location_information_get_utf8_network_path(
 	{
 		return( 0 );
 	}
+	if( liblnk_location_information_has_cached_path(
+	     location_information,
+	     ascii_codepage,
+	     LIBLNK_LOCATION_INFORMATION_PATH_TYPE_NETWORK,
+	     LIBLNK_DATA_STRING_FORMAT_UTF8 ) != 0 )
+	{
+		if( utf8_string_size < location_information->cached_utf8_network_path_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-8 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf8_string,
+		     location_information->cached_utf8_network_path,
+		     sizeof( uint8_t ) * location_information->cached_utf8_network_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-8 network path.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_NETWORK_SHARE_NAME_IS_UNICODE ) != 0 )
 	{
-		result = libuna_utf8_string_with_index_copy_from_utf16_stream(
+		result = liblnk_utf8_string_with_index_copy_from_utf16_stream(
 			  utf8_string,
 			  utf8_string_size,
 			  &string_index,
@@ -3313,7 +4239,7 @@ int liblnk_location_information_get_utf8_network_path(
 	{
 		if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_COMMON_PATH_IS_UNICODE ) != 0 )
 		{
-			result = libuna_utf8_string_with_index_copy_from_utf16_stream(
+			result = liblnk_utf8_string_with_index_copy_from_utf16_stream(
 				  utf8_string,
 				  utf8_string_size,
 			          &string_index,
@@ -3391,6 +4317,16 @@ int liblnk_location_information_get_utf16_network_path_size(
 	{
 		return( 0 );
 	}
+	if( liblnk_location_information_has_cached_path(
+	     location_information,
+	     ascii_codepage,
+	     LIBLNK_LOCATION_INFORMATION_PATH_TYPE_NETWORK,
+	     LIBLNK_DATA_STRING_FORMAT_UTF16 ) != 0 )
+	{
+		*utf16_string_size = location_information->cached_utf16_network_path_size;
+
+		return( 1 );
+	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_NETWORK_SHARE_NAME_IS_UNICODE ) != 0 )
 	{
 		result = libuna_utf16_string_size_from_utf16_stream(
@@ -3565,6 +4501,39 @@ int liblnk_location_information_get_utf16_network_path(
 	{
 		return( 0 );
 	}
+	if( liblnk_location_information_has_cached_path(
+	     location_information,
+	     ascii_codepage,
+	     LIBLNK_LOCATION_INFORMATION_PATH_TYPE_NETWORK,
+	     LIBLNK_DATA_STRING_FORMAT_UTF16 ) != 0 )
+	{
+		if( utf16_string_size < location_information->cached_utf16_network_path_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid UTF-16 string size value too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     utf16_string,
+		     location_information->cached_utf16_network_path,
+		     sizeof( uint16_t ) * location_information->cached_utf16_network_path_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy cached UTF-16 network path.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
 	if( ( location_information->string_flags & LIBLNK_LOCATION_INFORMATION_STRING_FLAG_NETWORK_SHARE_NAME_IS_UNICODE ) != 0 )
 	{
 		result = libuna_utf16_string_with_index_copy_from_utf16_stream(
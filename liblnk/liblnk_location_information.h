@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "liblnk_arena.h"
 #include "liblnk_io_handle.h"
 #include "liblnk_libbfio.h"
 #include "liblnk_libcerror.h"
@@ -55,7 +56,7 @@ struct liblnk_location_information
 
 	/* The volume label
 	 */
-	uint8_t *volume_label;
+	const uint8_t *volume_label;
 
 	/* The volume label size
 	 */
@@ -63,7 +64,7 @@ struct liblnk_location_information
 
 	/* The local path
 	 */
-	uint8_t *local_path;
+	const uint8_t *local_path;
 
 	/* The local path size
 	 */
@@ -71,7 +72,7 @@ struct liblnk_location_information
 
 	/* The network share name
 	 */
-	uint8_t *network_share_name;
+	const uint8_t *network_share_name;
 
 	/* The network share name size
 	 */
@@ -79,7 +80,7 @@ struct liblnk_location_information
 
 	/* The device name
 	 */
-	uint8_t *device_name;
+	const uint8_t *device_name;
 
 	/* The device name size
 	 */
@@ -91,21 +92,94 @@ struct liblnk_location_information
 
 	/* The common path
 	 */
-	uint8_t *common_path;
+	const uint8_t *common_path;
 
 	/* The common path size
 	 */
 	size_t common_path_size;
+
+	/* Value to indicate the strings reference a caller provided buffer
+	 */
+	uint8_t data_is_borrowed;
+
+	/* The cached UTF-8 local path
+	 */
+	uint8_t *cached_utf8_local_path;
+
+	/* The cached UTF-8 local path size
+	 */
+	size_t cached_utf8_local_path_size;
+
+	/* The codepage of the cached UTF-8 local path
+	 */
+	int cached_utf8_local_path_codepage;
+
+	/* The cached UTF-8 network path
+	 */
+	uint8_t *cached_utf8_network_path;
+
+	/* The cached UTF-8 network path size
+	 */
+	size_t cached_utf8_network_path_size;
+
+	/* The codepage of the cached UTF-8 network path
+	 */
+	int cached_utf8_network_path_codepage;
+
+	/* The cached UTF-16 local path
+	 */
+	uint16_t *cached_utf16_local_path;
+
+	/* The cached UTF-16 local path size
+	 */
+	size_t cached_utf16_local_path_size;
+
+	/* The codepage of the cached UTF-16 local path
+	 */
+	int cached_utf16_local_path_codepage;
+
+	/* The cached UTF-16 network path
+	 */
+	uint16_t *cached_utf16_network_path;
+
+	/* The cached UTF-16 network path size
+	 */
+	size_t cached_utf16_network_path_size;
+
+	/* The codepage of the cached UTF-16 network path
+	 */
+	int cached_utf16_network_path_codepage;
+
+	/* Value to indicate the structure is allocated from an arena
+	 */
+	uint8_t is_arena_allocated;
 };
 
 int liblnk_location_information_initialize(
      liblnk_location_information_t **location_information,
      libcerror_error_t **error );
 
+int liblnk_location_information_initialize_with_arena(
+     liblnk_location_information_t **location_information,
+     liblnk_arena_t *arena,
+     libcerror_error_t **error );
+
 int liblnk_location_information_free(
      liblnk_location_information_t **location_information,
      libcerror_error_t **error );
 
+int liblnk_location_information_clear(
+     liblnk_location_information_t *location_information,
+     libcerror_error_t **error );
+
+int liblnk_location_information_set_string(
+     liblnk_location_information_t *location_information,
+     const uint8_t *string_data,
+     size_t string_data_size,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
 int liblnk_location_information_read_data(
      liblnk_location_information_t *location_information,
      liblnk_io_handle_t *io_handle,
@@ -120,6 +194,23 @@ ssize_t liblnk_location_information_read(
          off64_t location_information_offset,
          libcerror_error_t **error );
 
+int liblnk_location_information_has_cached_path(
+     liblnk_location_information_t *location_information,
+     int ascii_codepage,
+     int path_type,
+     int string_format );
+
+int liblnk_location_information_cache_path(
+     liblnk_location_information_t *location_information,
+     int ascii_codepage,
+     int path_type,
+     int string_format,
+     libcerror_error_t **error );
+
+int liblnk_location_information_clear_cache(
+     liblnk_location_information_t *location_information,
+     libcerror_error_t **error );
+
 int liblnk_location_information_get_utf8_volume_label_size(
      liblnk_location_information_t *location_information,
      int ascii_codepage,
@@ -133,6 +224,14 @@ int liblnk_location_information_get_utf8_volume_label(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int liblnk_location_information_get_utf8_volume_label_with_index(
+     liblnk_location_information_t *location_information,
+     int ascii_codepage,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
 int liblnk_location_information_get_utf16_volume_label_size(
      liblnk_location_information_t *location_information,
      int ascii_codepage,
@@ -146,6 +245,14 @@ int liblnk_location_information_get_utf16_volume_label(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int liblnk_location_information_get_utf16_volume_label_with_index(
+     liblnk_location_information_t *location_information,
+     int ascii_codepage,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *utf16_string_index,
+     libcerror_error_t **error );
+
 int liblnk_location_information_get_utf8_local_path_size(
      liblnk_location_information_t *location_information,
      int ascii_codepage,
@@ -0,0 +1,424 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H ) && !defined( WINAPI )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H ) && !defined( WINAPI )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#include <unistd.h>
+#endif
+
+#include "liblnk_libcerror.h"
+#include "liblnk_memory_map.h"
+#include "liblnk_unused.h"
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+#define LIBLNK_HAVE_MEMORY_MAP_FILE		1
+
+#elif defined( HAVE_MMAP ) && defined( HAVE_MUNMAP ) && defined( HAVE_SYS_MMAN_H ) && defined( HAVE_SYS_STAT_H ) && defined( HAVE_FCNTL_H ) && defined( HAVE_UNISTD_H )
+#define LIBLNK_HAVE_MEMORY_MAP_FILE		1
+
+#if !defined( O_CLOEXEC )
+#define O_CLOEXEC				0
+#endif
+
+#endif
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+
+/* Maps a file into memory using a Windows file handle
+ * Returns 1 if successful, 0 if the file cannot be memory mapped or -1 on error
+ */
+int liblnk_memory_map_file_handle(
+     HANDLE file_handle,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error LIBLNK_ATTRIBUTE_UNUSED )
+{
+	LARGE_INTEGER large_integer_size;
+
+	HANDLE mapping_handle = NULL;
+	LPVOID mapped_data    = NULL;
+
+	LIBLNK_UNREFERENCED_PARAMETER( error )
+
+	if( file_handle == INVALID_HANDLE_VALUE )
+	{
+		return( 0 );
+	}
+	if( GetFileType(
+	     file_handle ) != FILE_TYPE_DISK )
+	{
+		CloseHandle(
+		 file_handle );
+
+		return( 0 );
+	}
+	if( GetFileSizeEx(
+	     file_handle,
+	     &large_integer_size ) == 0 )
+	{
+		CloseHandle(
+		 file_handle );
+
+		return( 0 );
+	}
+	if( ( large_integer_size.QuadPart <= 0 )
+	 || ( (size64_t) large_integer_size.QuadPart > (size64_t) SSIZE_MAX ) )
+	{
+		CloseHandle(
+		 file_handle );
+
+		return( 0 );
+	}
+	mapping_handle = CreateFileMapping(
+	                  file_handle,
+	                  NULL,
+	                  PAGE_READONLY,
+	                  0,
+	                  0,
+	                  NULL );
+
+	CloseHandle(
+	 file_handle );
+
+	if( mapping_handle == NULL )
+	{
+		return( 0 );
+	}
+	mapped_data = MapViewOfFile(
+	               mapping_handle,
+	               FILE_MAP_READ,
+	               0,
+	               0,
+	               0 );
+
+	/* The view keeps a reference to the mapping
+	 */
+	CloseHandle(
+	 mapping_handle );
+
+	if( mapped_data == NULL )
+	{
+		return( 0 );
+	}
+	*data      = (uint8_t *) mapped_data;
+	*data_size = (size_t) large_integer_size.QuadPart;
+
+	return( 1 );
+}
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+/* Maps a file into memory for reading
+ * The file is not memory mapped if it is empty, not a regular file or when memory mapping
+ * is not supported on the system, in which case it should be read using the file IO handle
+ * Returns 1 if successful, 0 if the file was not memory mapped or -1 on error
+ */
+int liblnk_memory_map_file(
+     const char *filename,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+#if !defined( WINAPI ) && defined( LIBLNK_HAVE_MEMORY_MAP_FILE )
+	struct stat file_statistics;
+
+	void *mapped_data   = NULL;
+	int file_descriptor = -1;
+#endif
+	static char *function = "liblnk_memory_map_file";
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	return( liblnk_memory_map_file_handle(
+	         CreateFileA(
+	          (LPCSTR) filename,
+	          GENERIC_READ,
+	          FILE_SHARE_READ,
+	          NULL,
+	          OPEN_EXISTING,
+	          FILE_ATTRIBUTE_NORMAL,
+	          NULL ),
+	         data,
+	         data_size,
+	         error ) );
+
+#elif defined( LIBLNK_HAVE_MEMORY_MAP_FILE )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY | O_CLOEXEC );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	if( ( S_ISREG( file_statistics.st_mode ) == 0 )
+	 || ( file_statistics.st_size <= 0 )
+	 || ( (size64_t) file_statistics.st_size > (size64_t) SSIZE_MAX ) )
+	{
+		close(
+		 file_descriptor );
+
+		return( 0 );
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_statistics.st_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		return( 0 );
+	}
+	*data      = (uint8_t *) mapped_data;
+	*data_size = (size_t) file_statistics.st_size;
+
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Maps a file into memory for reading
+ * The file is not memory mapped if it is empty, not a regular file or when memory mapping
+ * is not supported on the system, in which case it should be read using the file IO handle
+ * Returns 1 if successful, 0 if the file was not memory mapped or -1 on error
+ */
+int liblnk_memory_map_file_wide(
+     const wchar_t *filename,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_memory_map_file_wide";
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	return( liblnk_memory_map_file_handle(
+	         CreateFileW(
+	          (LPCWSTR) filename,
+	          GENERIC_READ,
+	          FILE_SHARE_READ,
+	          NULL,
+	          OPEN_EXISTING,
+	          FILE_ATTRIBUTE_NORMAL,
+	          NULL ),
+	         data,
+	         data_size,
+	         error ) );
+#else
+	/* Wide character filenames are only memory mapped on Windows
+	 */
+	return( 0 );
+#endif
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Unmaps a file previously mapped into memory
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_memory_unmap_file(
+     uint8_t **data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_memory_unmap_file";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data == NULL )
+	{
+		return( 1 );
+	}
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+	LIBLNK_UNREFERENCED_PARAMETER( data_size )
+
+	if( UnmapViewOfFile(
+	     (LPCVOID) *data ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to unmap view of file.",
+		 function );
+
+		return( -1 );
+	}
+#elif defined( LIBLNK_HAVE_MEMORY_MAP_FILE )
+	if( munmap(
+	     (void *) *data,
+	     data_size ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to unmap file.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	LIBLNK_UNREFERENCED_PARAMETER( data_size )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped files are not supported.",
+	 function );
+
+	return( -1 );
+#endif
+	*data = NULL;
+
+	return( 1 );
+}
+
@@ -0,0 +1,70 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBLNK_MEMORY_MAP_H )
+#define _LIBLNK_MEMORY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "liblnk_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( WINAPI ) && ( WINVER >= 0x0500 )
+
+int liblnk_memory_map_file_handle(
+     HANDLE file_handle,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( WINAPI ) && ( WINVER >= 0x0500 ) */
+
+int liblnk_memory_map_file(
+     const char *filename,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+int liblnk_memory_map_file_wide(
+     const wchar_t *filename,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+int liblnk_memory_unmap_file(
+     uint8_t **data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBLNK_MEMORY_MAP_H ) */
+
@@ -0,0 +1,1358 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_TIME_H )
+#include <time.h>
+#endif
+
+#include "liblnk_definitions.h"
+#include "liblnk_libcerror.h"
+#include "liblnk_libcthreads.h"
+#include "liblnk_statistics.h"
+#include "liblnk_types.h"
+#include "liblnk_unused.h"
+
+/* The statistics the per file statistics are merged into on close
+ */
+static liblnk_internal_statistics_t *liblnk_statistics_global = NULL;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+
+/* The mutex that guards the global statistics, it is created when the global
+ * statistics are first set and remains valid until the process exits
+ */
+static libcthreads_mutex_t *liblnk_statistics_global_mutex = NULL;
+
+#endif
+
+/* Creates statistics
+ * Make sure the value statistics is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_initialize(
+     liblnk_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	liblnk_internal_statistics_t *internal_statistics = NULL;
+	static char *function                             = "liblnk_statistics_initialize";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = memory_allocate_structure(
+	                       liblnk_internal_statistics_t );
+
+	if( internal_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_statistics,
+	     0,
+	     sizeof( liblnk_internal_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear statistics.",
+		 function );
+
+		memory_free(
+		 internal_statistics );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( internal_statistics->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*statistics = (liblnk_statistics_t *) internal_statistics;
+
+	return( 1 );
+
+on_error:
+	if( internal_statistics != NULL )
+	{
+		memory_free(
+		 internal_statistics );
+	}
+	return( -1 );
+}
+
+/* Frees statistics
+ * Statistics that are set as the global statistics must be unset before they are freed
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_free(
+     liblnk_statistics_t **statistics,
+     libcerror_error_t **error )
+{
+	liblnk_internal_statistics_t *internal_statistics = NULL;
+	static char *function                             = "liblnk_statistics_free";
+	int result                                        = 1;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *statistics != NULL )
+	{
+		internal_statistics = (liblnk_internal_statistics_t *) *statistics;
+
+		result = liblnk_statistics_is_global(
+		          internal_statistics,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if statistics are the global statistics.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid statistics - set as global statistics.",
+			 function );
+
+			return( -1 );
+		}
+		*statistics = NULL;
+		result      = 1;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( internal_statistics->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_statistics );
+	}
+	return( result );
+}
+
+/* Grabs the statistics mutex
+ * Returns 1 if successful or -1 on error
+ */
+static int liblnk_statistics_grab(
+            liblnk_internal_statistics_t *internal_statistics,
+            libcerror_error_t **error )
+{
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	static char *function = "liblnk_statistics_grab";
+
+	if( libcthreads_mutex_grab(
+	     internal_statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	LIBLNK_UNREFERENCED_PARAMETER( internal_statistics )
+	LIBLNK_UNREFERENCED_PARAMETER( error )
+#endif
+	return( 1 );
+}
+
+/* Releases the statistics mutex
+ * Returns 1 if successful or -1 on error
+ */
+static int liblnk_statistics_release(
+            liblnk_internal_statistics_t *internal_statistics,
+            libcerror_error_t **error )
+{
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	static char *function = "liblnk_statistics_release";
+
+	if( libcthreads_mutex_release(
+	     internal_statistics->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	LIBLNK_UNREFERENCED_PARAMETER( internal_statistics )
+	LIBLNK_UNREFERENCED_PARAMETER( error )
+#endif
+	return( 1 );
+}
+
+/* Clears statistics
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_clear(
+     liblnk_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	liblnk_internal_statistics_t *internal_statistics = NULL;
+	static char *function                             = "liblnk_statistics_clear";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (liblnk_internal_statistics_t *) statistics;
+
+	if( liblnk_statistics_grab(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics.",
+		 function );
+
+		return( -1 );
+	}
+	memory_set(
+	 internal_statistics->phase_times,
+	 0,
+	 sizeof( uint64_t ) * LIBLNK_STATISTICS_NUMBER_OF_PHASES );
+
+	memory_set(
+	 internal_statistics->phase_counts,
+	 0,
+	 sizeof( uint64_t ) * LIBLNK_STATISTICS_NUMBER_OF_PHASES );
+
+	memory_set(
+	 internal_statistics->counters,
+	 0,
+	 sizeof( uint64_t ) * LIBLNK_STATISTICS_NUMBER_OF_COUNTERS );
+
+	memory_set(
+	 internal_statistics->data_block_counts,
+	 0,
+	 sizeof( uint64_t ) * ( LIBLNK_STATISTICS_NUMBER_OF_DATA_BLOCK_SIGNATURES + 1 ) );
+
+	if( liblnk_statistics_release(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a value of the statistics
+ * Returns 1 if successful or -1 on error
+ */
+static int liblnk_statistics_get_value(
+            liblnk_internal_statistics_t *internal_statistics,
+            const uint64_t *values,
+            uint64_t *value,
+            libcerror_error_t **error )
+{
+	static char *function = "liblnk_statistics_get_value";
+
+	if( liblnk_statistics_grab(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics.",
+		 function );
+
+		return( -1 );
+	}
+	*value = *values;
+
+	if( liblnk_statistics_release(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the elapsed time of a specific phase
+ * The elapsed time is in nano seconds
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_get_phase_time(
+     liblnk_statistics_t *statistics,
+     int phase,
+     uint64_t *elapsed_time,
+     libcerror_error_t **error )
+{
+	liblnk_internal_statistics_t *internal_statistics = NULL;
+	static char *function                             = "liblnk_statistics_get_phase_time";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (liblnk_internal_statistics_t *) statistics;
+
+	if( ( phase < 0 )
+	 || ( phase >= LIBLNK_STATISTICS_NUMBER_OF_PHASES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid phase value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( elapsed_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid elapsed time.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_get_value(
+	     internal_statistics,
+	     &( internal_statistics->phase_times[ phase ] ),
+	     elapsed_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve phase time.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of times a specific phase was entered
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_get_phase_count(
+     liblnk_statistics_t *statistics,
+     int phase,
+     uint64_t *count,
+     libcerror_error_t **error )
+{
+	liblnk_internal_statistics_t *internal_statistics = NULL;
+	static char *function                             = "liblnk_statistics_get_phase_count";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (liblnk_internal_statistics_t *) statistics;
+
+	if( ( phase < 0 )
+	 || ( phase >= LIBLNK_STATISTICS_NUMBER_OF_PHASES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid phase value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( count == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid count.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_get_value(
+	     internal_statistics,
+	     &( internal_statistics->phase_counts[ phase ] ),
+	     count,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve phase count.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value of a specific counter
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_get_counter(
+     liblnk_statistics_t *statistics,
+     int counter,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	liblnk_internal_statistics_t *internal_statistics = NULL;
+	static char *function                             = "liblnk_statistics_get_counter";
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (liblnk_internal_statistics_t *) statistics;
+
+	if( ( counter < 0 )
+	 || ( counter >= LIBLNK_STATISTICS_NUMBER_OF_COUNTERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid counter value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_get_value(
+	     internal_statistics,
+	     &( internal_statistics->counters[ counter ] ),
+	     value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve counter.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of data blocks with a specific signature
+ * The signatures 0xa0000000 - 0xa000000f are counted individually,
+ * any other signature returns the number of data blocks with a signature
+ * outside this range
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_get_number_of_data_blocks_by_signature(
+     liblnk_statistics_t *statistics,
+     uint32_t signature,
+     uint64_t *number_of_data_blocks,
+     libcerror_error_t **error )
+{
+	liblnk_internal_statistics_t *internal_statistics = NULL;
+	static char *function                             = "liblnk_statistics_get_number_of_data_blocks_by_signature";
+	uint32_t signature_index                          = 0;
+
+	if( statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics = (liblnk_internal_statistics_t *) statistics;
+
+	if( number_of_data_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	signature_index = signature - 0xa0000000UL;
+
+	if( ( signature < 0xa0000000UL )
+	 || ( signature_index >= LIBLNK_STATISTICS_NUMBER_OF_DATA_BLOCK_SIGNATURES ) )
+	{
+		signature_index = LIBLNK_STATISTICS_NUMBER_OF_DATA_BLOCK_SIGNATURES;
+	}
+	if( liblnk_statistics_get_value(
+	     internal_statistics,
+	     &( internal_statistics->data_block_counts[ signature_index ] ),
+	     number_of_data_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the global statistics
+ * The statistics of every file opened with LIBLNK_ACCESS_FLAG_COLLECT_STATISTICS
+ * are added to the global statistics when the file is closed
+ * The statistics are owned by the caller and must be unset, by passing NULL,
+ * before they are freed. Unsetting waits until the statistics of a file that
+ * is being closed are added. The global statistics must first be set before
+ * any file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_set_global(
+     liblnk_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	static char *function = "liblnk_statistics_set_global";
+
+	if( liblnk_statistics_global_mutex == NULL )
+	{
+		if( statistics == NULL )
+		{
+			return( 1 );
+		}
+		if( libcthreads_mutex_initialize(
+		     &liblnk_statistics_global_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize global mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_grab(
+	     liblnk_statistics_global_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab global mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	liblnk_statistics_global = (liblnk_internal_statistics_t *) statistics;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     liblnk_statistics_global_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release global mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	LIBLNK_UNREFERENCED_PARAMETER( error )
+#endif
+	return( 1 );
+}
+
+/* Determines if the statistics are the global statistics
+ * Returns 1 if the statistics are the global statistics, 0 if not or -1 on error
+ */
+int liblnk_statistics_is_global(
+     liblnk_internal_statistics_t *internal_statistics,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	static char *function = "liblnk_statistics_is_global";
+#endif
+	int result            = 0;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_statistics_global_mutex == NULL )
+	{
+		return( 0 );
+	}
+	if( libcthreads_mutex_grab(
+	     liblnk_statistics_global_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab global mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_statistics != NULL )
+	 && ( internal_statistics == liblnk_statistics_global ) )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     liblnk_statistics_global_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release global mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	LIBLNK_UNREFERENCED_PARAMETER( error )
+#endif
+	return( result );
+}
+
+/* Retrieves a monotonic timestamp
+ * The timestamp is in nano seconds and 0 if no monotonic clock is available
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_get_timestamp(
+     uint64_t *timestamp,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_value;
+
+#endif
+	static char *function = "liblnk_statistics_get_timestamp";
+
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 )
+	 || ( frequency.QuadPart <= 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve performance counter.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = ( (uint64_t) ( counter.QuadPart / frequency.QuadPart ) * 1000000000UL )
+	           + ( ( (uint64_t) ( counter.QuadPart % frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve monotonic clock.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+#else
+	*timestamp = 0;
+#endif
+	return( 1 );
+}
+
+/* Starts a phase
+ * Does nothing if no statistics are collected
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_start_phase(
+     liblnk_internal_statistics_t *internal_statistics,
+     uint64_t *start_timestamp,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_statistics_start_phase";
+
+	if( internal_statistics == NULL )
+	{
+		return( 1 );
+	}
+	if( liblnk_statistics_get_timestamp(
+	     start_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve start timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Ends a phase and adds its elapsed time to the statistics
+ * Does nothing if no statistics are collected
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_end_phase(
+     liblnk_internal_statistics_t *internal_statistics,
+     int phase,
+     uint64_t start_timestamp,
+     libcerror_error_t **error )
+{
+	static char *function  = "liblnk_statistics_end_phase";
+	uint64_t end_timestamp = 0;
+
+	if( internal_statistics == NULL )
+	{
+		return( 1 );
+	}
+	if( ( phase < 0 )
+	 || ( phase >= LIBLNK_STATISTICS_NUMBER_OF_PHASES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid phase value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_get_timestamp(
+	     &end_timestamp,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve end timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_grab(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_timestamp > start_timestamp )
+	{
+		internal_statistics->phase_times[ phase ] += end_timestamp - start_timestamp;
+	}
+	internal_statistics->phase_counts[ phase ] += 1;
+
+	if( liblnk_statistics_release(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds a value to a counter
+ * Does nothing if no statistics are collected
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_add_counter(
+     liblnk_internal_statistics_t *internal_statistics,
+     int counter,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_statistics_add_counter";
+
+	if( internal_statistics == NULL )
+	{
+		return( 1 );
+	}
+	if( ( counter < 0 )
+	 || ( counter >= LIBLNK_STATISTICS_NUMBER_OF_COUNTERS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid counter value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_grab(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics->counters[ counter ] += value;
+
+	if( liblnk_statistics_release(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds a data block to the statistics
+ * Does nothing if no statistics are collected
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_add_data_block(
+     liblnk_internal_statistics_t *internal_statistics,
+     uint32_t signature,
+     libcerror_error_t **error )
+{
+	static char *function    = "liblnk_statistics_add_data_block";
+	uint32_t signature_index = 0;
+
+	if( internal_statistics == NULL )
+	{
+		return( 1 );
+	}
+	signature_index = signature - 0xa0000000UL;
+
+	if( ( signature < 0xa0000000UL )
+	 || ( signature_index >= LIBLNK_STATISTICS_NUMBER_OF_DATA_BLOCK_SIGNATURES ) )
+	{
+		signature_index = LIBLNK_STATISTICS_NUMBER_OF_DATA_BLOCK_SIGNATURES;
+	}
+	if( liblnk_statistics_grab(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_statistics->data_block_counts[ signature_index ] += 1;
+	internal_statistics->counters[ LIBLNK_STATISTICS_COUNTER_NUMBER_OF_DATA_BLOCKS ] += 1;
+
+	if( liblnk_statistics_release(
+	     internal_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies or merges the values of the source statistics into the destination statistics
+ * The source values are read under the source mutex and written under the
+ * destination mutex, so the mutexes are never held at the same time
+ * Returns 1 if successful or -1 on error
+ */
+static int liblnk_statistics_transfer(
+            liblnk_internal_statistics_t *destination_statistics,
+            liblnk_internal_statistics_t *source_statistics,
+            uint8_t merge,
+            libcerror_error_t **error )
+{
+	uint64_t counters[ LIBLNK_STATISTICS_NUMBER_OF_COUNTERS ];
+	uint64_t data_block_counts[ LIBLNK_STATISTICS_NUMBER_OF_DATA_BLOCK_SIGNATURES + 1 ];
+	uint64_t phase_counts[ LIBLNK_STATISTICS_NUMBER_OF_PHASES ];
+	uint64_t phase_times[ LIBLNK_STATISTICS_NUMBER_OF_PHASES ];
+
+	static char *function = "liblnk_statistics_transfer";
+	int value_index       = 0;
+
+	if( destination_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_statistics == source_statistics )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination statistics value same as source statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_grab(
+	     source_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab source statistics.",
+		 function );
+
+		return( -1 );
+	}
+	memory_copy(
+	 phase_times,
+	 source_statistics->phase_times,
+	 sizeof( uint64_t ) * LIBLNK_STATISTICS_NUMBER_OF_PHASES );
+
+	memory_copy(
+	 phase_counts,
+	 source_statistics->phase_counts,
+	 sizeof( uint64_t ) * LIBLNK_STATISTICS_NUMBER_OF_PHASES );
+
+	memory_copy(
+	 counters,
+	 source_statistics->counters,
+	 sizeof( uint64_t ) * LIBLNK_STATISTICS_NUMBER_OF_COUNTERS );
+
+	memory_copy(
+	 data_block_counts,
+	 source_statistics->data_block_counts,
+	 sizeof( uint64_t ) * ( LIBLNK_STATISTICS_NUMBER_OF_DATA_BLOCK_SIGNATURES + 1 ) );
+
+	if( liblnk_statistics_release(
+	     source_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release source statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_grab(
+	     destination_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab destination statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < LIBLNK_STATISTICS_NUMBER_OF_PHASES;
+	     value_index++ )
+	{
+		if( merge == 0 )
+		{
+			destination_statistics->phase_times[ value_index ]  = 0;
+			destination_statistics->phase_counts[ value_index ] = 0;
+		}
+		destination_statistics->phase_times[ value_index ]  += phase_times[ value_index ];
+		destination_statistics->phase_counts[ value_index ] += phase_counts[ value_index ];
+	}
+	for( value_index = 0;
+	     value_index < LIBLNK_STATISTICS_NUMBER_OF_COUNTERS;
+	     value_index++ )
+	{
+		if( merge == 0 )
+		{
+			destination_statistics->counters[ value_index ] = 0;
+		}
+		destination_statistics->counters[ value_index ] += counters[ value_index ];
+	}
+	for( value_index = 0;
+	     value_index <= LIBLNK_STATISTICS_NUMBER_OF_DATA_BLOCK_SIGNATURES;
+	     value_index++ )
+	{
+		if( merge == 0 )
+		{
+			destination_statistics->data_block_counts[ value_index ] = 0;
+		}
+		destination_statistics->data_block_counts[ value_index ] += data_block_counts[ value_index ];
+	}
+	if( liblnk_statistics_release(
+	     destination_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release destination statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies the source statistics to the destination statistics
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_copy(
+     liblnk_internal_statistics_t *destination_statistics,
+     liblnk_internal_statistics_t *source_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_statistics_copy";
+
+	if( liblnk_statistics_transfer(
+	     destination_statistics,
+	     source_statistics,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds the source statistics to the destination statistics
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_merge(
+     liblnk_internal_statistics_t *destination_statistics,
+     liblnk_internal_statistics_t *source_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_statistics_merge";
+
+	if( liblnk_statistics_transfer(
+	     destination_statistics,
+	     source_statistics,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to merge statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Adds the statistics to the global statistics
+ * Does nothing if no global statistics are set
+ * The global mutex is held while merging so that the global statistics
+ * cannot be unset and freed in the meantime
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_statistics_merge_global(
+     liblnk_internal_statistics_t *internal_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_statistics_merge_global";
+	int result            = 1;
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( liblnk_statistics_global_mutex == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     liblnk_statistics_global_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab global mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( liblnk_statistics_global != NULL )
+	 && ( liblnk_statistics_global != internal_statistics ) )
+	{
+		if( liblnk_statistics_merge(
+		     liblnk_statistics_global,
+		     internal_statistics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to merge statistics into global statistics.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     liblnk_statistics_global_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release global mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,163 @@
+/*
+ * Statistics functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBLNK_STATISTICS_H )
+#define _LIBLNK_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "liblnk_definitions.h"
+#include "liblnk_extern.h"
+#include "liblnk_libcerror.h"
+#include "liblnk_libcthreads.h"
+#include "liblnk_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct liblnk_internal_statistics liblnk_internal_statistics_t;
+
+struct liblnk_internal_statistics
+{
+	/* The elapsed time per phase in nano seconds
+	 */
+	uint64_t phase_times[ LIBLNK_STATISTICS_NUMBER_OF_PHASES ];
+
+	/* The number of times each phase was entered
+	 */
+	uint64_t phase_counts[ LIBLNK_STATISTICS_NUMBER_OF_PHASES ];
+
+	/* The counters
+	 */
+	uint64_t counters[ LIBLNK_STATISTICS_NUMBER_OF_COUNTERS ];
+
+	/* The number of data blocks per signature
+	 * The last entry contains the number of data blocks with other signatures
+	 */
+	uint64_t data_block_counts[ LIBLNK_STATISTICS_NUMBER_OF_DATA_BLOCK_SIGNATURES + 1 ];
+
+#if defined( HAVE_LIBLNK_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+LIBLNK_EXTERN \
+int liblnk_statistics_initialize(
+     liblnk_statistics_t **statistics,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_statistics_free(
+     liblnk_statistics_t **statistics,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_statistics_clear(
+     liblnk_statistics_t *statistics,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_statistics_get_phase_time(
+     liblnk_statistics_t *statistics,
+     int phase,
+     uint64_t *elapsed_time,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_statistics_get_phase_count(
+     liblnk_statistics_t *statistics,
+     int phase,
+     uint64_t *count,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_statistics_get_counter(
+     liblnk_statistics_t *statistics,
+     int counter,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_statistics_get_number_of_data_blocks_by_signature(
+     liblnk_statistics_t *statistics,
+     uint32_t signature,
+     uint64_t *number_of_data_blocks,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_statistics_set_global(
+     liblnk_statistics_t *statistics,
+     libcerror_error_t **error );
+
+int liblnk_statistics_is_global(
+     liblnk_internal_statistics_t *internal_statistics,
+     libcerror_error_t **error );
+
+int liblnk_statistics_get_timestamp(
+     uint64_t *timestamp,
+     libcerror_error_t **error );
+
+int liblnk_statistics_start_phase(
+     liblnk_internal_statistics_t *internal_statistics,
+     uint64_t *start_timestamp,
+     libcerror_error_t **error );
+
+int liblnk_statistics_end_phase(
+     liblnk_internal_statistics_t *internal_statistics,
+     int phase,
+     uint64_t start_timestamp,
+     libcerror_error_t **error );
+
+int liblnk_statistics_add_counter(
+     liblnk_internal_statistics_t *internal_statistics,
+     int counter,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int liblnk_statistics_add_data_block(
+     liblnk_internal_statistics_t *internal_statistics,
+     uint32_t signature,
+     libcerror_error_t **error );
+
+int liblnk_statistics_copy(
+     liblnk_internal_statistics_t *destination_statistics,
+     liblnk_internal_statistics_t *source_statistics,
+     libcerror_error_t **error );
+
+int liblnk_statistics_merge(
+     liblnk_internal_statistics_t *destination_statistics,
+     liblnk_internal_statistics_t *source_statistics,
+     libcerror_error_t **error );
+
+int liblnk_statistics_merge_global(
+     liblnk_internal_statistics_t *internal_statistics,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBLNK_STATISTICS_H ) */
+
@@ -0,0 +1,678 @@
+/*
+ * Stream parse functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "liblnk_codepage.h"
+#include "liblnk_data_block.h"
+#include "liblnk_data_string.h"
+#include "liblnk_definitions.h"
+#include "liblnk_file_header.h"
+#include "liblnk_io_handle.h"
+#include "liblnk_libbfio.h"
+#include "liblnk_libcerror.h"
+#include "liblnk_libuna.h"
+#include "liblnk_link_target_identifier.h"
+#include "liblnk_location_information.h"
+#include "liblnk_stream.h"
+
+#include "lnk_file_header.h"
+
+/* The data flags of the data strings in the order they are stored
+ */
+static uint32_t liblnk_stream_data_string_data_flags[ 5 ] = {
+	LIBLNK_DATA_FLAG_HAS_DESCRIPTION_STRING,
+	LIBLNK_DATA_FLAG_HAS_RELATIVE_PATH_STRING,
+	LIBLNK_DATA_FLAG_HAS_WORKING_DIRECTORY_STRING,
+	LIBLNK_DATA_FLAG_HAS_COMMAND_LINE_ARGUMENTS_STRING,
+	LIBLNK_DATA_FLAG_HAS_ICON_LOCATION_STRING };
+
+/* The structure types of the data strings in the order they are stored
+ */
+static int liblnk_stream_data_string_structure_types[ 5 ] = {
+	LIBLNK_STREAM_STRUCTURE_TYPE_DESCRIPTION,
+	LIBLNK_STREAM_STRUCTURE_TYPE_RELATIVE_PATH,
+	LIBLNK_STREAM_STRUCTURE_TYPE_WORKING_DIRECTORY,
+	LIBLNK_STREAM_STRUCTURE_TYPE_COMMAND_LINE_ARGUMENTS,
+	LIBLNK_STREAM_STRUCTURE_TYPE_ICON_LOCATION };
+
+/* Parses a LNK file from a buffer without creating a file
+ * The structures are read in the order they are stored and passed to the callback function
+ * with the data of the structure without its size value. The data references the buffer
+ * and is only valid while the buffer is. The callback function must return 1 to continue
+ * or any other value to abort parsing
+ * Returns 1 if successful, 0 if aborted by the callback function or -1 on error
+ */
+int liblnk_stream_parse_memory(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int (*callback_function)(
+            int structure_type,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_function_arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error )
+{
+	liblnk_data_string_t data_string;
+	liblnk_file_header_t file_header;
+	liblnk_internal_data_block_t data_block;
+	liblnk_io_handle_t io_handle;
+	liblnk_link_target_identifier_t link_target_identifier;
+	liblnk_location_information_t location_information;
+
+	static char *function                = "liblnk_stream_parse_memory";
+	size_t data_offset                   = 0;
+	uint32_t encoding_flags              = 0;
+	uint32_t location_information_size   = 0;
+	uint16_t link_target_identifier_size = 0;
+	int data_string_index                = 0;
+	int result                           = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data is borrowed so that the structures reference the buffer
+	 * and the decoders do not allocate memory
+	 */
+	if( memory_set(
+	     &io_handle,
+	     0,
+	     sizeof( liblnk_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle.file_size      = (size64_t) buffer_size;
+	io_handle.flags          = LIBLNK_IO_HANDLE_FLAG_DATA_IS_BORROWED;
+	io_handle.ascii_codepage = LIBLNK_CODEPAGE_WINDOWS_1252;
+
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( liblnk_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_file_header_read_data(
+	     &file_header,
+	     buffer,
+	     buffer_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function(
+	     LIBLNK_STREAM_STRUCTURE_TYPE_FILE_HEADER,
+	     buffer,
+	     sizeof( lnk_file_header_t ),
+	     callback_function_arguments ) != 1 )
+	{
+		return( 0 );
+	}
+	data_offset = sizeof( lnk_file_header_t );
+
+	if( ( file_header.data_flags & LIBLNK_DATA_FLAG_IS_UNICODE ) != 0 )
+	{
+		io_handle.is_unicode = 1;
+	}
+	if( ( file_header.data_flags & LIBLNK_DATA_FLAG_HAS_LINK_TARGET_IDENTIFIER ) != 0 )
+	{
+		if( ( buffer_size - data_offset ) < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer size value too small for link target identifier size.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( buffer[ data_offset ] ),
+		 link_target_identifier_size );
+
+		data_offset += 2;
+
+		if( link_target_identifier_size > 0 )
+		{
+			if( (size_t) link_target_identifier_size > ( buffer_size - data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid link target identifier size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_set(
+			     &link_target_identifier,
+			     0,
+			     sizeof( liblnk_link_target_identifier_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear link target identifier.",
+				 function );
+
+				return( -1 );
+			}
+			if( liblnk_link_target_identifier_read_data(
+			     &link_target_identifier,
+			     &io_handle,
+			     &( buffer[ data_offset ] ),
+			     (size_t) link_target_identifier_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read link target identifier.",
+				 function );
+
+				return( -1 );
+			}
+			if( callback_function(
+			     LIBLNK_STREAM_STRUCTURE_TYPE_LINK_TARGET_IDENTIFIER,
+			     link_target_identifier.data,
+			     link_target_identifier.data_size,
+			     callback_function_arguments ) != 1 )
+			{
+				return( 0 );
+			}
+			data_offset += link_target_identifier_size;
+		}
+	}
+	if( ( file_header.data_flags & LIBLNK_DATA_FLAG_HAS_LOCATION_INFORMATION ) != 0 )
+	{
+		if( ( buffer_size - data_offset ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid buffer size value too small for location information size.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ data_offset ] ),
+		 location_information_size );
+
+		if( location_information_size > 4 )
+		{
+			if( (size_t) location_information_size > ( buffer_size - data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid location information size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_set(
+			     &location_information,
+			     0,
+			     sizeof( liblnk_location_information_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+				 "%s: unable to clear location information.",
+				 function );
+
+				return( -1 );
+			}
+			if( liblnk_location_information_read_data(
+			     &location_information,
+			     &io_handle,
+			     &( buffer[ data_offset + 4 ] ),
+			     (size_t) location_information_size - 4,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read location information.",
+				 function );
+
+				return( -1 );
+			}
+			result = callback_function(
+			          LIBLNK_STREAM_STRUCTURE_TYPE_LOCATION_INFORMATION,
+			          &( buffer[ data_offset + 4 ] ),
+			          (size_t) location_information_size - 4,
+			          callback_function_arguments );
+
+			/* Frees the strings that were copied instead of borrowed and the cached paths
+			 */
+			if( liblnk_location_information_clear(
+			     &location_information,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to clear location information.",
+				 function );
+
+				return( -1 );
+			}
+			if( result != 1 )
+			{
+				return( 0 );
+			}
+			data_offset += location_information_size;
+		}
+		else
+		{
+			data_offset += 4;
+		}
+	}
+	for( data_string_index = 0;
+	     data_string_index < 5;
+	     data_string_index++ )
+	{
+		if( ( file_header.data_flags & liblnk_stream_data_string_data_flags[ data_string_index ] ) == 0 )
+		{
+			continue;
+		}
+		if( data_offset >= buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data string: %d data offset value out of bounds.",
+			 function,
+			 data_string_index );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     &data_string,
+		     0,
+		     sizeof( liblnk_data_string_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data string.",
+			 function );
+
+			return( -1 );
+		}
+		/* The description is read without allowing unpaired surrogates
+		 */
+		if( data_string_index == 0 )
+		{
+			encoding_flags = 0;
+		}
+		else
+		{
+			encoding_flags = LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE;
+		}
+		if( liblnk_data_string_read_data(
+		     &data_string,
+		     &io_handle,
+		     &( buffer[ data_offset ] ),
+		     buffer_size - data_offset,
+		     encoding_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data string: %d.",
+			 function,
+			 data_string_index );
+
+			return( -1 );
+		}
+		result = callback_function(
+		          liblnk_stream_data_string_structure_types[ data_string_index ],
+		          data_string.data,
+		          data_string.data_size,
+		          callback_function_arguments );
+
+		data_offset += 2 + data_string.data_size;
+
+		if( liblnk_data_string_clear(
+		     &data_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear data string: %d.",
+			 function,
+			 data_string_index );
+
+			return( -1 );
+		}
+		if( result != 1 )
+		{
+			return( 0 );
+		}
+	}
+	while( data_offset < buffer_size )
+	{
+		if( memory_set(
+		     &data_block,
+		     0,
+		     sizeof( liblnk_internal_data_block_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data block.",
+			 function );
+
+			return( -1 );
+		}
+		/* Like on open, a data block that cannot be read ends the extra data blocks
+		 */
+		if( liblnk_data_block_read_buffer(
+		     (liblnk_data_block_t *) &data_block,
+		     &io_handle,
+		     &( buffer[ data_offset ] ),
+		     buffer_size - data_offset,
+		     NULL ) != 1 )
+		{
+			break;
+		}
+		if( data_block.size == 0 )
+		{
+			break;
+		}
+		if( callback_function(
+		     LIBLNK_STREAM_STRUCTURE_TYPE_EXTRA_DATA_BLOCK,
+		     data_block.data,
+		     data_block.data_size,
+		     callback_function_arguments ) != 1 )
+		{
+			return( 0 );
+		}
+		data_offset += data_block.size;
+	}
+	return( 1 );
+}
+
+/* Parses a LNK file using a Basic File IO (bfio) handle without creating a file
+ * The file data is read into a single buffer that is parsed as in liblnk_stream_parse_memory,
+ * the data passed to the callback function is only valid during the callback
+ * The file size is limited to MEMORY_MAXIMUM_ALLOCATION_SIZE (128 MiB)
+ * Returns 1 if successful, 0 if aborted by the callback function or -1 on error
+ */
+int liblnk_stream_parse(
+     libbfio_handle_t *file_io_handle,
+     int (*callback_function)(
+            int structure_type,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_function_arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer            = NULL;
+	static char *function      = "liblnk_stream_parse";
+	size64_t file_size         = 0;
+	ssize_t read_count         = 0;
+	int file_io_handle_is_open = 0;
+	int result                 = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) sizeof( lnk_file_header_t ) )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * (size_t) file_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              (size_t) file_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	result = liblnk_stream_parse_memory(
+	          buffer,
+	          (size_t) file_size,
+	          callback_function,
+	          callback_function_arguments,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to parse file data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,65 @@
+/*
+ * Stream parse functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBLNK_STREAM_H )
+#define _LIBLNK_STREAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "liblnk_extern.h"
+#include "liblnk_libbfio.h"
+#include "liblnk_libcerror.h"
+#include "liblnk_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+LIBLNK_EXTERN \
+int liblnk_stream_parse_memory(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     int (*callback_function)(
+            int structure_type,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_function_arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_stream_parse(
+     libbfio_handle_t *file_io_handle,
+     int (*callback_function)(
+            int structure_type,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_function_arguments ),
+     void *callback_function_arguments,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBLNK_STREAM_H ) */
+
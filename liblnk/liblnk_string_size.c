@@ -0,0 +1,271 @@
+/*
+ * String size functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#if defined( __AVX2__ )
+#define LIBLNK_STRING_SIZE_HAVE_AVX2
+
+#include <immintrin.h>
+#endif
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBLNK_STRING_SIZE_HAVE_SSE2
+
+#include <emmintrin.h>
+#endif
+
+#include "liblnk_libcerror.h"
+#include "liblnk_string_size.h"
+
+/* Masks to test 8 bytes or 4 UTF-16 code units at a time for a 0 value
+ * A lane that contains 0 always sets its high bit, lanes that follow
+ * a lane that contains 0 could set it as well
+ */
+#define LIBLNK_STRING_SIZE_BYTE_LOW_BITS	0x0101010101010101ULL
+#define LIBLNK_STRING_SIZE_BYTE_HIGH_BITS	0x8080808080808080ULL
+#define LIBLNK_STRING_SIZE_UTF16_LOW_BITS	0x0001000100010001ULL
+#define LIBLNK_STRING_SIZE_UTF16_HIGH_BITS	0x8000800080008000ULL
+
+/* Determines the size of a string in a byte stream
+ * The blocks that cannot contain the end of string character are skipped
+ * with SSE2 or AVX2 when available and 8 bytes at a time otherwise
+ * The size includes the end of string character if found otherwise
+ * it is the size of the byte stream
+ * Returns 1 if the end of string character was found, 0 if not or -1 on error
+ */
+int liblnk_string_size_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+#if defined( LIBLNK_STRING_SIZE_HAVE_AVX2 )
+	__m256i avx2_zero         = _mm256_setzero_si256();
+#endif
+#if defined( LIBLNK_STRING_SIZE_HAVE_SSE2 )
+	__m128i sse2_zero         = _mm_setzero_si128();
+#endif
+	static char *function     = "liblnk_string_size_from_byte_stream";
+	size_t byte_stream_index  = 0;
+	uint64_t value_64bit      = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBLNK_STRING_SIZE_HAVE_AVX2 )
+	while( ( byte_stream_size - byte_stream_index ) >= 32 )
+	{
+		if( _mm256_movemask_epi8(
+		     _mm256_cmpeq_epi8(
+		      _mm256_loadu_si256( (const __m256i *) &( byte_stream[ byte_stream_index ] ) ),
+		      avx2_zero ) ) != 0 )
+		{
+			break;
+		}
+		byte_stream_index += 32;
+	}
+#endif
+#if defined( LIBLNK_STRING_SIZE_HAVE_SSE2 )
+	while( ( byte_stream_size - byte_stream_index ) >= 16 )
+	{
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi8(
+		      _mm_loadu_si128( (const __m128i *) &( byte_stream[ byte_stream_index ] ) ),
+		      sse2_zero ) ) != 0 )
+		{
+			break;
+		}
+		byte_stream_index += 16;
+	}
+#endif
+	while( ( byte_stream_size - byte_stream_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( byte_stream[ byte_stream_index ] ),
+		 value_64bit );
+
+		if( ( ( value_64bit - LIBLNK_STRING_SIZE_BYTE_LOW_BITS ) & ~value_64bit & LIBLNK_STRING_SIZE_BYTE_HIGH_BITS ) != 0 )
+		{
+			break;
+		}
+		byte_stream_index += 8;
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		if( byte_stream[ byte_stream_index++ ] == 0 )
+		{
+			*string_size = byte_stream_index;
+
+			return( 1 );
+		}
+	}
+	*string_size = byte_stream_size;
+
+	return( 0 );
+}
+
+/* Determines the size of a string in an UTF-16 stream
+ * The blocks that cannot contain the end of string character are skipped
+ * with SSE2 or AVX2 when available and 8 bytes at a time otherwise
+ * The size includes the end of string character if found otherwise
+ * it is the size of the UTF-16 stream rounded down to a multitude of 2
+ * Returns 1 if the end of string character was found, 0 if not or -1 on error
+ */
+int liblnk_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+#if defined( LIBLNK_STRING_SIZE_HAVE_AVX2 )
+	__m256i avx2_zero         = _mm256_setzero_si256();
+#endif
+#if defined( LIBLNK_STRING_SIZE_HAVE_SSE2 )
+	__m128i sse2_zero         = _mm_setzero_si128();
+#endif
+	static char *function     = "liblnk_string_size_from_utf16_stream";
+	size_t utf16_stream_index = 0;
+	uint64_t value_64bit      = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore a trailing byte that is not part of an UTF-16 code unit
+	 */
+	utf16_stream_size &= ~( (size_t) 1 );
+
+#if defined( LIBLNK_STRING_SIZE_HAVE_AVX2 )
+	while( ( utf16_stream_size - utf16_stream_index ) >= 32 )
+	{
+		if( _mm256_movemask_epi8(
+		     _mm256_cmpeq_epi16(
+		      _mm256_loadu_si256( (const __m256i *) &( utf16_stream[ utf16_stream_index ] ) ),
+		      avx2_zero ) ) != 0 )
+		{
+			break;
+		}
+		utf16_stream_index += 32;
+	}
+#endif
+#if defined( LIBLNK_STRING_SIZE_HAVE_SSE2 )
+	while( ( utf16_stream_size - utf16_stream_index ) >= 16 )
+	{
+		if( _mm_movemask_epi8(
+		     _mm_cmpeq_epi16(
+		      _mm_loadu_si128( (const __m128i *) &( utf16_stream[ utf16_stream_index ] ) ),
+		      sse2_zero ) ) != 0 )
+		{
+			break;
+		}
+		utf16_stream_index += 16;
+	}
+#endif
+	while( ( utf16_stream_size - utf16_stream_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_64bit );
+
+		if( ( ( value_64bit - LIBLNK_STRING_SIZE_UTF16_LOW_BITS ) & ~value_64bit & LIBLNK_STRING_SIZE_UTF16_HIGH_BITS ) != 0 )
+		{
+			break;
+		}
+		utf16_stream_index += 8;
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		if( ( utf16_stream[ utf16_stream_index ] == 0 )
+		 && ( utf16_stream[ utf16_stream_index + 1 ] == 0 ) )
+		{
+			*string_size = utf16_stream_index + 2;
+
+			return( 1 );
+		}
+		utf16_stream_index += 2;
+	}
+	*string_size = utf16_stream_size;
+
+	return( 0 );
+}
+
@@ -30,6 +30,7 @@
 #include "liblnk_libcerror.h"
 #include "liblnk_libcnotify.h"
 #include "liblnk_libuna.h"
+#include "liblnk_string_size.h"
 
 #include "lnk_data_blocks.h"
 
@@ -44,9 +45,11 @@ int liblnk_strings_data_block_read(
 	liblnk_internal_data_block_t *internal_data_block = NULL;
 	const uint8_t *string_data                        = NULL;
 	const uint8_t *unicode_string_data                = NULL;
+	uint8_t *data_string_data                         = NULL;
 	static char *function                             = "liblnk_data_block_strings_read";
 	size_t string_size                                = 0;
 	size_t unicode_string_size                        = 0;
+	int result                                        = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint32_t encoding_flags                           = 0;
@@ -111,19 +114,26 @@ int liblnk_strings_data_block_read(
 
 		goto on_error;
 	}
-	string_data = ( (lnk_data_block_strings_t *) internal_data_block->data )->string;
+	string_data = ( (const lnk_data_block_strings_t *) internal_data_block->data )->string;
 
-	for( string_size = 0;
-	     string_size < 260;
-	     string_size++ )
+	result = liblnk_string_size_from_byte_stream(
+	          string_data,
+	          260,
+	          &string_size,
+	          error );
+
+	if( result == -1 )
 	{
-		if( string_data[ string_size ] == 0 )
-		{
-			break;
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine string size.",
+		 function );
+
+		goto on_error;
 	}
-	if( ( string_size == 260 )
-	 || ( string_data[ string_size ] != 0 ) )
+	else if( result == 0 )
 	{
 #if defined( HAVE_VERBOSE_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -134,10 +144,6 @@ int liblnk_strings_data_block_read(
 #endif
 		string_size = 0;
 	}
-	else
-	{
-		string_size += 1;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -169,21 +175,26 @@ int liblnk_strings_data_block_read(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	unicode_string_data = ( (lnk_data_block_strings_t *) internal_data_block->data )->unicode_string;
+	unicode_string_data = ( (const lnk_data_block_strings_t *) internal_data_block->data )->unicode_string;
+
+	result = liblnk_string_size_from_utf16_stream(
+	          unicode_string_data,
+	          520,
+	          &unicode_string_size,
+	          error );
 
-	for( unicode_string_size = 0;
-	     unicode_string_size < 520;
-	     unicode_string_size += 2 )
+	if( result == -1 )
 	{
-		if( ( unicode_string_data[ unicode_string_size ] == 0 )
-		 && ( unicode_string_data[ unicode_string_size + 1 ] == 0 ) )
-		{
-			break;
-		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine Unicode string size.",
+		 function );
+
+		goto on_error;
 	}
-	if( ( unicode_string_size == 520 )
-	 || ( unicode_string_data[ unicode_string_size ] != 0 )
-	 || ( unicode_string_data[ unicode_string_size + 1 ] != 0 ) )
+	else if( result == 0 )
 	{
 #if defined( HAVE_VERBOSE_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -194,10 +205,6 @@ int liblnk_strings_data_block_read(
 #endif
 		unicode_string_size = 0;
 	}
-	else
-	{
-		unicode_string_size += 2;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -240,10 +247,10 @@ int liblnk_strings_data_block_read(
 	{
 		data_string->data_size = unicode_string_size;
 
-		data_string->data = (uint8_t *) memory_allocate(
-		                                 sizeof( uint8_t ) * data_string->data_size );
+		data_string_data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * data_string->data_size );
 
-		if( data_string->data == NULL )
+		if( data_string_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -254,8 +261,10 @@ int liblnk_strings_data_block_read(
 
 			goto on_error;
 		}
+		data_string->data = data_string_data;
+
 		if( memory_copy(
-		     data_string->data,
+		     data_string_data,
 		     unicode_string_data,
 		     data_string->data_size ) == NULL )
 		{
@@ -274,10 +283,10 @@ int liblnk_strings_data_block_read(
 	{
 		data_string->data_size = string_size;
 
-		data_string->data = (uint8_t *) memory_allocate(
-		                                 sizeof( uint8_t ) * data_string->data_size );
+		data_string_data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * data_string->data_size );
 
-		if( data_string->data == NULL )
+		if( data_string_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -288,8 +297,10 @@ int liblnk_strings_data_block_read(
 
 			goto on_error;
 		}
+		data_string->data = data_string_data;
+
 		if( memory_copy(
-		     data_string->data,
+		     data_string_data,
 		     unicode_string_data,
 		     data_string->data_size ) == NULL )
 		{
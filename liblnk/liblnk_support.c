@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
@@ -28,12 +29,15 @@
 
 #include "liblnk_codepage.h"
 #include "liblnk_definitions.h"
+#include "liblnk_file_header.h"
 #include "liblnk_io_handle.h"
 #include "liblnk_libbfio.h"
 #include "liblnk_libcerror.h"
 #include "liblnk_libclocale.h"
 #include "liblnk_support.h"
 
+#include "lnk_file_header.h"
+
 #if !defined( HAVE_LOCAL_LIBLNK )
 
 /* Returns the library version
@@ -429,3 +433,247 @@ on_error:
 	return( -1 );
 }
 
+/* Probes the file header in a buffer
+ * The header values are retrieved without creating a file
+ * Returns 1 if the buffer contains a LNK file header, 0 if not or -1 on error
+ */
+int liblnk_file_header_probe(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     liblnk_file_header_values_t *file_header_values,
+     libcerror_error_t **error )
+{
+	liblnk_file_header_t file_header;
+
+	static char *function = "liblnk_file_header_probe";
+	uint32_t header_size  = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header values.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size < sizeof( lnk_file_header_t ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (lnk_file_header_t *) buffer )->header_size,
+	 header_size );
+
+	if( header_size != 76 )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     ( (lnk_file_header_t *) buffer )->class_identifier,
+	     lnk_file_class_identifier,
+	     16 ) != 0 )
+	{
+		return( 0 );
+	}
+	if( memory_set(
+	     &file_header,
+	     0,
+	     sizeof( liblnk_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_file_header_read_data(
+	     &file_header,
+	     buffer,
+	     sizeof( lnk_file_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		return( -1 );
+	}
+	file_header_values->data_flags           = file_header.data_flags;
+	file_header_values->file_attribute_flags = file_header.file_attribute_flags;
+	file_header_values->creation_time        = file_header.creation_time;
+	file_header_values->access_time          = file_header.access_time;
+	file_header_values->modification_time    = file_header.modification_time;
+	file_header_values->file_size            = file_header.file_size;
+	file_header_values->icon_index           = file_header.icon_index;
+	file_header_values->show_window          = file_header.show_window;
+	file_header_values->hot_key              = file_header.hot_key;
+
+	return( 1 );
+}
+
+/* Probes the file header using a Basic File IO (bfio) handle
+ * The header values are retrieved without creating a file
+ * Returns 1 if the file contains a LNK file header, 0 if not or -1 on error
+ */
+int liblnk_file_header_probe_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     liblnk_file_header_values_t *file_header_values,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ sizeof( lnk_file_header_t ) ];
+
+	static char *function      = "liblnk_file_header_probe_file_io_handle";
+	ssize_t read_count         = 0;
+	int file_io_handle_is_open = 0;
+	int result                 = 0;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file io handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header values.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              file_header_data,
+	              sizeof( lnk_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	/* A file that is smaller than the file header is not a LNK file
+	 */
+	result = liblnk_file_header_probe(
+	          file_header_data,
+	          (size_t) read_count,
+	          file_header_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to probe file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_is_open == 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -28,6 +28,7 @@
 #include "liblnk_extern.h"
 #include "liblnk_libbfio.h"
 #include "liblnk_libcerror.h"
+#include "liblnk_types.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -74,6 +75,19 @@ int liblnk_check_file_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBLNK_EXTERN \
+int liblnk_file_header_probe(
+     const uint8_t *buffer,
+     size_t buffer_size,
+     liblnk_file_header_values_t *file_header_values,
+     libcerror_error_t **error );
+
+LIBLNK_EXTERN \
+int liblnk_file_header_probe_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     liblnk_file_header_values_t *file_header_values,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -34,15 +34,65 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct liblnk_batch {}		liblnk_batch_t;
 typedef struct liblnk_data_block {}	liblnk_data_block_t;
 typedef struct liblnk_file {}		liblnk_file_t;
+typedef struct liblnk_statistics {}	liblnk_statistics_t;
 
 #else
+typedef intptr_t liblnk_batch_t;
 typedef intptr_t liblnk_data_block_t;
 typedef intptr_t liblnk_file_t;
+typedef intptr_t liblnk_statistics_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
+/* The file header values as retrieved by liblnk_file_header_probe
+ */
+typedef struct liblnk_file_header_values liblnk_file_header_values_t;
+
+struct liblnk_file_header_values
+{
+	/* The data flags
+	 */
+	uint32_t data_flags;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The creation date and time
+	 * Contains a 64-bit filetime value
+	 */
+	uint64_t creation_time;
+
+	/* The last access date and time
+	 * Contains a 64-bit filetime value
+	 */
+	uint64_t access_time;
+
+	/* The last modification date and time
+	 * Contains a 64-bit filetime value
+	 */
+	uint64_t modification_time;
+
+	/* The file size
+	 */
+	uint32_t file_size;
+
+	/* The icon index
+	 */
+	uint32_t icon_index;
+
+	/* The show window
+	 */
+	uint32_t show_window;
+
+	/* The hot key
+	 */
+	uint16_t hot_key;
+};
+
 #endif /* defined( HAVE_LOCAL_LIBLNK ) */
 
 #endif /* !defined( _LIBLNK_INTERNAL_TYPES_H ) */
@@ -0,0 +1,674 @@
+/*
+ * UTF-8 string functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#if defined( __AVX2__ )
+#define LIBLNK_UTF8_STRING_HAVE_AVX2
+
+#include <immintrin.h>
+#endif
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBLNK_UTF8_STRING_HAVE_SSE2
+
+#include <emmintrin.h>
+#endif
+
+#include "liblnk_libcerror.h"
+#include "liblnk_libuna.h"
+#include "liblnk_utf8_string.h"
+
+/* Masks to test 4 UTF-16 little-endian code units at a time
+ */
+#define LIBLNK_UTF8_STRING_NON_ASCII_MASK	0xff80ff80ff80ff80ULL
+#define LIBLNK_UTF8_STRING_LOW_BITS		0x0001000100010001ULL
+#define LIBLNK_UTF8_STRING_HIGH_BITS		0x8000800080008000ULL
+
+/* Determines the size of the blocks at the start of an UTF-16 little-endian stream
+ * that only contain ASCII characters other than the end of string character
+ * The stream is tested with SSE2 or AVX2 when available and 8 bytes at a time
+ * otherwise. The remainder of the stream is left to the caller
+ * Returns the size of the blocks in bytes
+ */
+size_t liblnk_utf8_string_get_ascii_blocks_size(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size )
+{
+#if defined( LIBLNK_UTF8_STRING_HAVE_AVX2 )
+	__m256i avx2_block            = _mm256_setzero_si256();
+	__m256i avx2_is_ascii         = _mm256_setzero_si256();
+	__m256i avx2_is_zero          = _mm256_setzero_si256();
+	__m256i avx2_non_ascii_mask   = _mm256_set1_epi16( (short) 0xff80 );
+	__m256i avx2_zero             = _mm256_setzero_si256();
+#endif
+#if defined( LIBLNK_UTF8_STRING_HAVE_SSE2 )
+	__m128i sse2_block            = _mm_setzero_si128();
+	__m128i sse2_is_ascii         = _mm_setzero_si128();
+	__m128i sse2_is_zero          = _mm_setzero_si128();
+	__m128i sse2_non_ascii_mask   = _mm_set1_epi16( (short) 0xff80 );
+	__m128i sse2_zero             = _mm_setzero_si128();
+#endif
+	size_t utf16_stream_index     = 0;
+	uint64_t value_64bit          = 0;
+
+	if( utf16_stream == NULL )
+	{
+		return( 0 );
+	}
+#if defined( LIBLNK_UTF8_STRING_HAVE_AVX2 )
+	while( ( utf16_stream_size - utf16_stream_index ) >= 32 )
+	{
+		avx2_block    = _mm256_loadu_si256( (const __m256i *) &( utf16_stream[ utf16_stream_index ] ) );
+		avx2_is_ascii = _mm256_cmpeq_epi16( _mm256_and_si256( avx2_block, avx2_non_ascii_mask ), avx2_zero );
+		avx2_is_zero  = _mm256_cmpeq_epi16( avx2_block, avx2_zero );
+
+		if( _mm256_movemask_epi8( _mm256_andnot_si256( avx2_is_zero, avx2_is_ascii ) ) != -1 )
+		{
+			break;
+		}
+		utf16_stream_index += 32;
+	}
+#endif
+#if defined( LIBLNK_UTF8_STRING_HAVE_SSE2 )
+	while( ( utf16_stream_size - utf16_stream_index ) >= 16 )
+	{
+		sse2_block    = _mm_loadu_si128( (const __m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+		sse2_is_ascii = _mm_cmpeq_epi16( _mm_and_si128( sse2_block, sse2_non_ascii_mask ), sse2_zero );
+		sse2_is_zero  = _mm_cmpeq_epi16( sse2_block, sse2_zero );
+
+		if( _mm_movemask_epi8( _mm_andnot_si128( sse2_is_zero, sse2_is_ascii ) ) != 0xffff )
+		{
+			break;
+		}
+		utf16_stream_index += 16;
+	}
+#endif
+	while( ( utf16_stream_size - utf16_stream_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_64bit );
+
+		if( ( value_64bit & LIBLNK_UTF8_STRING_NON_ASCII_MASK ) != 0 )
+		{
+			break;
+		}
+		/* Since all code units are ASCII only a 0 code unit sets its high bit
+		 */
+		if( ( ( value_64bit - LIBLNK_UTF8_STRING_LOW_BITS ) & LIBLNK_UTF8_STRING_HIGH_BITS ) != 0 )
+		{
+			break;
+		}
+		utf16_stream_index += 8;
+	}
+	return( utf16_stream_index );
+}
+
+/* Copies the blocks at the start of an UTF-16 little-endian stream that only
+ * contain ASCII characters other than the end of string character to an UTF-8 string
+ * The UTF-8 string must be large enough to contain half the UTF-16 stream size
+ * Returns the size of the blocks in bytes
+ */
+size_t liblnk_utf8_string_copy_ascii_blocks(
+        uint8_t *utf8_string,
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size )
+{
+#if defined( LIBLNK_UTF8_STRING_HAVE_AVX2 )
+	__m256i avx2_block            = _mm256_setzero_si256();
+	__m256i avx2_is_ascii         = _mm256_setzero_si256();
+	__m256i avx2_is_zero          = _mm256_setzero_si256();
+	__m256i avx2_non_ascii_mask   = _mm256_set1_epi16( (short) 0xff80 );
+	__m256i avx2_zero             = _mm256_setzero_si256();
+#endif
+#if defined( LIBLNK_UTF8_STRING_HAVE_SSE2 )
+	__m128i sse2_block            = _mm_setzero_si128();
+	__m128i sse2_is_ascii         = _mm_setzero_si128();
+	__m128i sse2_is_zero          = _mm_setzero_si128();
+	__m128i sse2_non_ascii_mask   = _mm_set1_epi16( (short) 0xff80 );
+	__m128i sse2_zero             = _mm_setzero_si128();
+#endif
+	size_t utf16_stream_index     = 0;
+	size_t utf8_string_index      = 0;
+	uint64_t value_64bit          = 0;
+
+	if( ( utf8_string == NULL )
+	 || ( utf16_stream == NULL ) )
+	{
+		return( 0 );
+	}
+#if defined( LIBLNK_UTF8_STRING_HAVE_AVX2 )
+	while( ( utf16_stream_size - utf16_stream_index ) >= 32 )
+	{
+		avx2_block    = _mm256_loadu_si256( (const __m256i *) &( utf16_stream[ utf16_stream_index ] ) );
+		avx2_is_ascii = _mm256_cmpeq_epi16( _mm256_and_si256( avx2_block, avx2_non_ascii_mask ), avx2_zero );
+		avx2_is_zero  = _mm256_cmpeq_epi16( avx2_block, avx2_zero );
+
+		if( _mm256_movemask_epi8( _mm256_andnot_si256( avx2_is_zero, avx2_is_ascii ) ) != -1 )
+		{
+			break;
+		}
+		/* The pack is done per 128-bit lane, hence the lower 64-bit of each lane are combined
+		 */
+		avx2_block = _mm256_permute4x64_epi64(
+		              _mm256_packus_epi16( avx2_block, avx2_block ),
+		              0xd8 );
+
+		_mm_storeu_si128(
+		 (__m128i *) &( utf8_string[ utf8_string_index ] ),
+		 _mm256_castsi256_si128( avx2_block ) );
+
+		utf16_stream_index += 32;
+		utf8_string_index  += 16;
+	}
+#endif
+#if defined( LIBLNK_UTF8_STRING_HAVE_SSE2 )
+	while( ( utf16_stream_size - utf16_stream_index ) >= 16 )
+	{
+		sse2_block    = _mm_loadu_si128( (const __m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+		sse2_is_ascii = _mm_cmpeq_epi16( _mm_and_si128( sse2_block, sse2_non_ascii_mask ), sse2_zero );
+		sse2_is_zero  = _mm_cmpeq_epi16( sse2_block, sse2_zero );
+
+		if( _mm_movemask_epi8( _mm_andnot_si128( sse2_is_zero, sse2_is_ascii ) ) != 0xffff )
+		{
+			break;
+		}
+		_mm_storel_epi64(
+		 (__m128i *) &( utf8_string[ utf8_string_index ] ),
+		 _mm_packus_epi16( sse2_block, sse2_block ) );
+
+		utf16_stream_index += 16;
+		utf8_string_index  += 8;
+	}
+#endif
+	while( ( utf16_stream_size - utf16_stream_index ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_64bit );
+
+		if( ( value_64bit & LIBLNK_UTF8_STRING_NON_ASCII_MASK ) != 0 )
+		{
+			break;
+		}
+		if( ( ( value_64bit - LIBLNK_UTF8_STRING_LOW_BITS ) & LIBLNK_UTF8_STRING_HIGH_BITS ) != 0 )
+		{
+			break;
+		}
+		utf8_string[ utf8_string_index++ ] = (uint8_t) ( value_64bit & 0x7f );
+		utf8_string[ utf8_string_index++ ] = (uint8_t) ( ( value_64bit >> 16 ) & 0x7f );
+		utf8_string[ utf8_string_index++ ] = (uint8_t) ( ( value_64bit >> 32 ) & 0x7f );
+		utf8_string[ utf8_string_index++ ] = (uint8_t) ( ( value_64bit >> 48 ) & 0x7f );
+
+		utf16_stream_index += 8;
+	}
+	return( utf16_stream_index );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-16 little-endian stream
+ * that does not contain surrogates or a byte order mark
+ * The size includes the end of string character
+ * Returns 1 if successful, 0 if the stream is not supported or -1 on error
+ */
+int liblnk_utf8_string_size_from_utf16_stream_without_surrogates(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "liblnk_utf8_string_size_from_utf16_stream_without_surrogates";
+	size_t safe_string_size   = 0;
+	size_t utf16_stream_index = 0;
+	size_t ascii_blocks_size  = 0;
+	uint16_t value_16bit      = 0;
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Streams that are empty, of an odd size or start with a byte order mark
+	 * are left to libuna
+	 */
+	if( ( utf16_stream_size < 2 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( ( utf16_stream[ 0 ] == 0xff ) && ( utf16_stream[ 1 ] == 0xfe ) )
+	 || ( ( utf16_stream[ 0 ] == 0xfe ) && ( utf16_stream[ 1 ] == 0xff ) ) )
+	{
+		return( 0 );
+	}
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		ascii_blocks_size = liblnk_utf8_string_get_ascii_blocks_size(
+		                     &( utf16_stream[ utf16_stream_index ] ),
+		                     utf16_stream_size - utf16_stream_index );
+
+		utf16_stream_index += ascii_blocks_size;
+		safe_string_size   += ascii_blocks_size / 2;
+
+		if( utf16_stream_index >= utf16_stream_size )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_16bit );
+
+		utf16_stream_index += 2;
+
+		if( value_16bit == 0 )
+		{
+			break;
+		}
+		if( value_16bit < 0x0080 )
+		{
+			safe_string_size += 1;
+		}
+		else if( value_16bit < 0x0800 )
+		{
+			safe_string_size += 2;
+		}
+		else if( ( value_16bit >= 0xd800 )
+		      && ( value_16bit <= 0xdfff ) )
+		{
+			return( 0 );
+		}
+		else
+		{
+			safe_string_size += 3;
+		}
+	}
+	/* Add the end of string character
+	 */
+	*utf8_string_size = safe_string_size + 1;
+
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from an UTF-16 little-endian stream
+ * that does not contain surrogates or a byte order mark
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if the stream is not supported or -1 on error
+ */
+int liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates";
+	size_t ascii_blocks_size  = 0;
+	size_t character_size     = 0;
+	size_t maximum_size       = 0;
+	size_t safe_string_index  = 0;
+	size_t utf16_stream_index = 0;
+	uint16_t value_16bit      = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *utf8_string_index > utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size < 2 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( ( ( utf16_stream[ 0 ] == 0xff ) && ( utf16_stream[ 1 ] == 0xfe ) )
+	 || ( ( utf16_stream[ 0 ] == 0xfe ) && ( utf16_stream[ 1 ] == 0xff ) ) )
+	{
+		return( 0 );
+	}
+	/* The UTF-8 string index is only updated on success so that the caller
+	 * can fall back to libuna when the stream is not supported
+	 */
+	safe_string_index = *utf8_string_index;
+
+	while( utf16_stream_index < utf16_stream_size )
+	{
+		/* Limit the ASCII blocks to the remaining UTF-8 string size
+		 */
+		maximum_size = utf16_stream_size - utf16_stream_index;
+
+		if( maximum_size > ( 2 * ( utf8_string_size - safe_string_index ) ) )
+		{
+			maximum_size = 2 * ( utf8_string_size - safe_string_index );
+		}
+		ascii_blocks_size = liblnk_utf8_string_copy_ascii_blocks(
+		                     &( utf8_string[ safe_string_index ] ),
+		                     &( utf16_stream[ utf16_stream_index ] ),
+		                     maximum_size );
+
+		utf16_stream_index += ascii_blocks_size;
+		safe_string_index  += ascii_blocks_size / 2;
+
+		if( utf16_stream_index >= utf16_stream_size )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ utf16_stream_index ] ),
+		 value_16bit );
+
+		utf16_stream_index += 2;
+
+		if( value_16bit == 0 )
+		{
+			break;
+		}
+		if( ( value_16bit >= 0xd800 )
+		 && ( value_16bit <= 0xdfff ) )
+		{
+			return( 0 );
+		}
+		if( value_16bit < 0x0080 )
+		{
+			character_size = 1;
+		}
+		else if( value_16bit < 0x0800 )
+		{
+			character_size = 2;
+		}
+		else
+		{
+			character_size = 3;
+		}
+		if( character_size > ( utf8_string_size - safe_string_index ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( character_size == 1 )
+		{
+			utf8_string[ safe_string_index++ ] = (uint8_t) value_16bit;
+		}
+		else if( character_size == 2 )
+		{
+			utf8_string[ safe_string_index++ ] = (uint8_t) ( 0xc0 | ( value_16bit >> 6 ) );
+			utf8_string[ safe_string_index++ ] = (uint8_t) ( 0x80 | ( value_16bit & 0x3f ) );
+		}
+		else
+		{
+			utf8_string[ safe_string_index++ ] = (uint8_t) ( 0xe0 | ( value_16bit >> 12 ) );
+			utf8_string[ safe_string_index++ ] = (uint8_t) ( 0x80 | ( ( value_16bit >> 6 ) & 0x3f ) );
+			utf8_string[ safe_string_index++ ] = (uint8_t) ( 0x80 | ( value_16bit & 0x3f ) );
+		}
+	}
+	/* Add the end of string character
+	 */
+	if( safe_string_index >= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ safe_string_index++ ] = 0;
+
+	*utf8_string_index = safe_string_index;
+
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string from an UTF-16 stream
+ * Little-endian streams without surrogates are converted by liblnk,
+ * other streams by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_utf8_string_size_from_utf16_stream";
+	int result            = 0;
+
+	if( ( byte_order & 0x000000ffL ) == LIBUNA_ENDIAN_LITTLE )
+	{
+		result = liblnk_utf8_string_size_from_utf16_stream_without_surrogates(
+		          utf16_stream,
+		          utf16_stream_size,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		result = libuna_utf8_string_size_from_utf16_stream(
+		          utf16_stream,
+		          utf16_stream_size,
+		          byte_order,
+		          utf8_string_size,
+		          error );
+	}
+	return( result );
+}
+
+/* Copies an UTF-8 string from an UTF-16 stream
+ * Little-endian streams without surrogates are converted by liblnk,
+ * other streams by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_utf8_string_copy_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function    = "liblnk_utf8_string_copy_from_utf16_stream";
+	size_t utf8_string_index = 0;
+
+	if( liblnk_utf8_string_with_index_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     utf16_stream,
+	     utf16_stream_size,
+	     byte_order,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from an UTF-16 stream
+ * Little-endian streams without surrogates are converted by liblnk,
+ * other streams by libuna
+ * Returns 1 if successful or -1 on error
+ */
+int liblnk_utf8_string_with_index_copy_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function = "liblnk_utf8_string_with_index_copy_from_utf16_stream";
+	int result            = 0;
+
+	if( ( byte_order & 0x000000ffL ) == LIBUNA_ENDIAN_LITTLE )
+	{
+		result = liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+		          utf8_string,
+		          utf8_string_size,
+		          utf8_string_index,
+		          utf16_stream,
+		          utf16_stream_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result == 0 )
+	{
+		result = libuna_utf8_string_with_index_copy_from_utf16_stream(
+		          utf8_string,
+		          utf8_string_size,
+		          utf8_string_index,
+		          utf16_stream,
+		          utf16_stream_size,
+		          byte_order,
+		          error );
+	}
+	return( result );
+}
+
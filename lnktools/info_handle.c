@@ -382,6 +382,7 @@ int info_handle_open_input(
      libcerror_error_t **error )
 {
 	static char *function = "info_handle_open_input";
+	int access_flags      = LIBLNK_OPEN_READ;
 
 	if( info_handle == NULL )
 	{
@@ -408,17 +409,21 @@ int info_handle_open_input(
 
 		return( -1 );
 	}
+	if( info_handle->collect_statistics != 0 )
+	{
+		access_flags |= LIBLNK_ACCESS_FLAG_COLLECT_STATISTICS;
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	if( liblnk_file_open_wide(
 	     info_handle->input_file,
 	     filename,
-	     LIBLNK_OPEN_READ,
+	     access_flags,
 	     error ) != 1 )
 #else
 	if( liblnk_file_open(
 	     info_handle->input_file,
 	     filename,
-	     LIBLNK_OPEN_READ,
+	     access_flags,
 	     error ) != 1 )
 #endif
 	{
@@ -3359,3 +3364,224 @@ on_error:
 	return( -1 );
 }
 
+/* Prints the parse statistics
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	const char *counter_names[ 4 ] = {
+		"Bytes read",
+		"Number of reads",
+		"Number of values",
+		"Number of data blocks" };
+
+	const char *phase_names[ 8 ] = {
+		"Open",
+		"Read",
+		"File header",
+		"Link target identifier",
+		"Location information",
+		"Data strings",
+		"Extra data blocks",
+		"String conversion" };
+
+	liblnk_statistics_t *statistics = NULL;
+	static char *function           = "info_handle_statistics_fprint";
+	uint64_t count                  = 0;
+	uint64_t elapsed_time           = 0;
+	uint32_t signature              = 0;
+	int index                       = 0;
+	int result                      = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_statistics_initialize(
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create statistics.",
+		 function );
+
+		goto on_error;
+	}
+	result = liblnk_file_get_statistics(
+	          info_handle->input_file,
+	          statistics,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve statistics.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Parse statistics:\n" );
+
+	if( result == 0 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "\tNot available\n" );
+	}
+	else
+	{
+		for( index = 0;
+		     index < 8;
+		     index++ )
+		{
+			if( liblnk_statistics_get_phase_time(
+			     statistics,
+			     index,
+			     &elapsed_time,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve phase: %d time.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+			if( liblnk_statistics_get_phase_count(
+			     statistics,
+			     index,
+			     &count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve phase: %d count.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t%-24s: %" PRIu64 " ns (%" PRIu64 " times)\n",
+			 phase_names[ index ],
+			 elapsed_time,
+			 count );
+		}
+		for( index = 0;
+		     index < 4;
+		     index++ )
+		{
+			if( liblnk_statistics_get_counter(
+			     statistics,
+			     index,
+			     &count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve counter: %d.",
+				 function,
+				 index );
+
+				goto on_error;
+			}
+			fprintf(
+			 info_handle->notify_stream,
+			 "\t%-24s: %" PRIu64 "\n",
+			 counter_names[ index ],
+			 count );
+		}
+		for( signature = 0xa0000000UL;
+		     signature <= 0xa0000010UL;
+		     signature++ )
+		{
+			if( liblnk_statistics_get_number_of_data_blocks_by_signature(
+			     statistics,
+			     signature,
+			     &count,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of data blocks with signature: 0x%08" PRIx32 ".",
+				 function,
+				 signature );
+
+				goto on_error;
+			}
+			if( count == 0 )
+			{
+				continue;
+			}
+			if( signature == 0xa0000010UL )
+			{
+				fprintf(
+				 info_handle->notify_stream,
+				 "\tData blocks (other)      : %" PRIu64 "\n",
+				 count );
+			}
+			else
+			{
+				fprintf(
+				 info_handle->notify_stream,
+				 "\tData blocks (0x%08" PRIx32 ") : %" PRIu64 "\n",
+				 signature,
+				 count );
+			}
+		}
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\n" );
+
+	if( liblnk_statistics_free(
+	     &statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free statistics.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( statistics != NULL )
+	{
+		liblnk_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( -1 );
+}
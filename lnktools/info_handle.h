@@ -45,6 +45,10 @@ struct info_handle
 	 */
 	int ascii_codepage;
 
+	/* Value to indicate if parse statistics should be collected
+	 */
+	int collect_statistics;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -139,6 +143,10 @@ int info_handle_data_block_fprint(
      liblnk_data_block_t *data_block,
      libcerror_error_t **error );
 
+int info_handle_statistics_fprint(
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
 int info_handle_distributed_link_tracking_data_block_fprint(
      info_handle_t *info_handle,
      liblnk_data_block_t *data_block,
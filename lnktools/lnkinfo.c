@@ -49,8 +49,10 @@
 #include "lnktools_output.h"
 #include "lnktools_signal.h"
 #include "lnktools_unused.h"
+#include "scan_handle.h"
 
 info_handle_t *lnkinfo_info_handle = NULL;
+scan_handle_t *lnkinfo_scan_handle = NULL;
 int lnkinfo_abort                  = 0;
 
 /* Signal handler for lnkinfo
@@ -81,6 +83,22 @@ void lnkinfo_signal_handler(
 			 &error );
 		}
 	}
+	if( lnkinfo_scan_handle != NULL )
+	{
+		if( scan_handle_signal_abort(
+		     lnkinfo_scan_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal scan handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	/* Force stdin to close otherwise any function reading it will remain blocked
 	 */
 #if defined( WINAPI ) && !defined( __CYGWIN__ )
@@ -97,6 +115,168 @@ void lnkinfo_signal_handler(
 	}
 }
 
+/* Scans the sources and prints a record per Windows Shortcut File
+ * Returns 1 if successful, 0 if aborted or one or more files could not be processed or -1 on error
+ */
+int lnkinfo_scan_sources(
+     int number_of_sources,
+     system_character_t * const sources[],
+     const system_character_t *file_list,
+     const system_character_t *jobs,
+     libcerror_error_t **error )
+{
+	int process_result          = 0;
+	int result                  = 0;
+	int signal_handler_attached = 0;
+	int source_index            = 0;
+
+	if( scan_handle_initialize(
+	     &lnkinfo_scan_handle,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize scan handle.\n" );
+
+		goto on_error;
+	}
+	if( jobs != NULL )
+	{
+		result = scan_handle_set_number_of_threads(
+		          lnkinfo_scan_handle,
+		          jobs,
+		          error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs (threads).\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs (threads) defaulting to: %d.\n",
+			 SCAN_HANDLE_DEFAULT_NUMBER_OF_THREADS );
+		}
+	}
+	if( lnktools_signal_attach(
+	     lnkinfo_signal_handler,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		goto on_error;
+	}
+	signal_handler_attached = 1;
+
+	if( file_list != NULL )
+	{
+		if( scan_handle_append_file_list(
+		     lnkinfo_scan_handle,
+		     file_list,
+		     error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read file list.\n" );
+
+			goto on_error;
+		}
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( scan_handle_append_path(
+		     lnkinfo_scan_handle,
+		     sources[ source_index ],
+		     error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to scan source: %" PRIs_SYSTEM ".\n",
+			 sources[ source_index ] );
+
+			goto on_error;
+		}
+	}
+	process_result = scan_handle_process(
+	                  lnkinfo_scan_handle,
+	                  lnkinfo_info_handle,
+	                  error );
+
+	if( process_result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to process sources.\n" );
+
+		goto on_error;
+	}
+	signal_handler_attached = 0;
+
+	if( lnktools_signal_detach(
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		goto on_error;
+	}
+	result = 1;
+
+	if( ( process_result == 0 )
+	 || ( lnkinfo_abort != 0 ) )
+	{
+		fprintf(
+		 stdout,
+		 "lnkinfo: ABORTED\n" );
+
+		result = 0;
+	}
+	else if( lnkinfo_scan_handle->number_of_failed_files > 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to process: %d file(s).\n",
+		 lnkinfo_scan_handle->number_of_failed_files );
+
+		result = 0;
+	}
+	if( scan_handle_free(
+	     &lnkinfo_scan_handle,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free scan handle.\n" );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( signal_handler_attached != 0 )
+	{
+		lnktools_signal_detach(
+		 NULL );
+	}
+	if( lnkinfo_scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &lnkinfo_scan_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -106,25 +286,36 @@ int main( int argc, char * const argv[] )
 #endif
 {
 	const char *description = \
-		"Use lnkinfo to determine information about a Windows Shortcut File (LNK).";
+		"Use lnkinfo to determine information about a Windows Shortcut File (LNK).\n"
+		"\n"
+		"If more than one source, a directory or a file list is provided a record is\n"
+		"printed per Windows Shortcut File, directories are scanned recursively for\n"
+		"files with the .lnk extension.";
 
 	lnktools_option_t options[ ] = {
 		{ 'c', "codepage", "codepage of ASCII strings, options: ascii, windows-874, windows-932, windows-936, windows-949, windows-950, windows-1250, windows-1251, windows-1252 (default), windows-1253, windows-1254, windows-1255, windows-1256, windows-1257 or windows-1258" },
 		{ 'h', NULL, "shows this help" },
+		{ 'j', "jobs", "number of concurrent processing jobs (threads) used to scan more than one source, where 0 represents none, default: 4" },
+		{ 'l', "file_list", "file containing the sources to scan, one per line, use - to read the sources from stdin" },
+		{ 'S', NULL, "print parse statistics after the file information" },
 		{ 'v', NULL, "verbose output to stderr" },
 		{ 'V', NULL, "print version" },
-		{ 0, "source", "the source file" },
+		{ 0, "source", "the source file or directory, more than one source can be provided" },
 	};
 	system_character_t options_string[ 32 ];
 
-	int result                          = 0;
-	liblnk_error_t *error               = NULL;
-	system_character_t *option_codepage = NULL;
-	system_character_t *source          = NULL;
-	char *program                       = "lnkinfo";
-	system_integer_t option             = 0;
-	int number_of_options               = (int) ( sizeof( options ) / sizeof( lnktools_option_t ) );
-	int verbose                         = 0;
+	int result                           = 0;
+	liblnk_error_t *error                = NULL;
+	system_character_t *option_codepage  = NULL;
+	system_character_t *option_file_list = NULL;
+	system_character_t *option_jobs      = NULL;
+	system_character_t *source           = NULL;
+	char *program                        = "lnkinfo";
+	system_integer_t option              = 0;
+	int number_of_options                = (int) ( sizeof( options ) / sizeof( lnktools_option_t ) );
+	int print_statistics                 = 0;
+	int scan_sources                     = 0;
+	int verbose                          = 0;
 
 #if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
 	_setmode( _fileno( stdout ), _O_BINARY );
@@ -211,6 +402,21 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+
+			case (system_integer_t) 'l':
+				option_file_list = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				print_statistics = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -223,7 +429,8 @@ int main( int argc, char * const argv[] )
 				return( EXIT_SUCCESS );
 		}
 	}
-	if( optind == argc )
+	if( ( optind == argc )
+	 && ( option_file_list == NULL ) )
 	{
 		fprintf(
 		 stderr,
@@ -238,8 +445,26 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
+	if( ( option_file_list != NULL )
+	 || ( ( argc - optind ) > 1 ) )
+	{
+		scan_sources = 1;
+	}
+	else
+	{
+		source = argv[ optind ];
 
+		/* A source that cannot be accessed is reported when it is opened
+		 */
+		scan_sources = scan_handle_path_is_directory(
+		                source,
+		                NULL );
+
+		if( scan_sources == -1 )
+		{
+			scan_sources = 0;
+		}
+	}
 	libcnotify_verbose_set(
 	 verbose );
 	liblnk_notify_set_stream(
@@ -258,6 +483,8 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	lnkinfo_info_handle->collect_statistics = print_statistics;
+
 	if( option_codepage != NULL )
 	{
 		result = info_handle_set_ascii_codepage(
@@ -280,6 +507,35 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( scan_sources != 0 )
+	{
+		result = lnkinfo_scan_sources(
+		          argc - optind,
+		          &( argv[ optind ] ),
+		          option_file_list,
+		          option_jobs,
+		          &error );
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		if( info_handle_free(
+		     &lnkinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free info handle.\n" );
+
+			goto on_error;
+		}
+		if( result == 0 )
+		{
+			return( EXIT_FAILURE );
+		}
+		return( EXIT_SUCCESS );
+	}
 	if( info_handle_open_input(
 	     lnkinfo_info_handle,
 	     source,
@@ -301,6 +557,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	if( print_statistics != 0 )
+	{
+		if( info_handle_statistics_fprint(
+		     lnkinfo_info_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print parse statistics.\n" );
+
+			goto on_error;
+		}
+	}
 	if( info_handle_close_input(
 	     lnkinfo_info_handle,
 	     &error ) != 0 )
@@ -0,0 +1,1691 @@
+/*
+ * Scan handle
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_DIRENT_H )
+#include <dirent.h>
+#endif
+
+#include "info_handle.h"
+#include "lnktools_libcdata.h"
+#include "lnktools_libcerror.h"
+#include "lnktools_libcnotify.h"
+#include "lnktools_liblnk.h"
+#include "lnktools_unused.h"
+#include "scan_handle.h"
+
+/* Creates a scan handle
+ * Make sure the value scan_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_initialize(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_initialize";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_handle = memory_allocate_structure(
+	                scan_handle_t );
+
+	if( *scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_handle,
+	     0,
+	     sizeof( scan_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan handle.",
+		 function );
+
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+
+		return( -1 );
+	}
+	if( liblnk_batch_initialize(
+	     &( ( *scan_handle )->batch ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_batch_set_number_of_threads(
+	     ( *scan_handle )->batch,
+	     SCAN_HANDLE_DEFAULT_NUMBER_OF_THREADS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *scan_handle )->paths_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create paths array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *scan_handle != NULL )
+	{
+		if( ( *scan_handle )->batch != NULL )
+		{
+			liblnk_batch_free(
+			 &( ( *scan_handle )->batch ),
+			 NULL );
+		}
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan handle
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_free(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_free";
+	int result            = 1;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_handle != NULL )
+	{
+		if( liblnk_batch_free(
+		     &( ( *scan_handle )->batch ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free batch.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( ( *scan_handle )->paths_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &scan_handle_path_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free paths array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *scan_handle );
+
+		*scan_handle = NULL;
+	}
+	return( result );
+}
+
+/* Frees a path
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_path_free(
+     system_character_t **path,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_path_free";
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		memory_free(
+		 *path );
+
+		*path = NULL;
+	}
+	return( 1 );
+}
+
+/* Signals the scan handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_signal_abort(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_signal_abort";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	scan_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the number of concurrent processing jobs (threads)
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int scan_handle_set_number_of_threads(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_set_number_of_threads";
+	size_t string_index   = 0;
+	size_t string_length  = 0;
+	int number_of_threads = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( number_of_threads > SCAN_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	if( liblnk_batch_set_number_of_threads(
+	     scan_handle->batch,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if a path refers to a directory
+ * Returns 1 if the path refers to a directory, 0 if not or -1 on error
+ */
+int scan_handle_path_is_directory(
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+#if defined( WINAPI )
+	DWORD file_attributes = 0;
+
+#elif defined( HAVE_STAT )
+	struct stat file_statistics;
+
+#endif
+
+	static char *function = "scan_handle_path_is_directory";
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	file_attributes = GetFileAttributesW(
+	                   (LPCWSTR) path );
+#else
+	file_attributes = GetFileAttributesA(
+	                   (LPCSTR) path );
+#endif
+	if( file_attributes == INVALID_FILE_ATTRIBUTES )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 GetLastError(),
+		 "%s: unable to retrieve file attributes of: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	if( ( file_attributes & FILE_ATTRIBUTE_DIRECTORY ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+
+#elif defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( stat(
+	     path,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 errno,
+		 "%s: unable to retrieve file statistics of: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	if( S_ISDIR( file_statistics.st_mode ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+/* Determines if a path has the Windows Shortcut file extension (.lnk)
+ * Returns 1 if the path has the .lnk extension or 0 if not
+ */
+int scan_handle_path_is_shortcut(
+     const system_character_t *path,
+     size_t path_length )
+{
+	const system_character_t *extension = NULL;
+
+	if( path == NULL )
+	{
+		return( 0 );
+	}
+	if( path_length < 4 )
+	{
+		return( 0 );
+	}
+	extension = &( path[ path_length - 4 ] );
+
+	if( extension[ 0 ] != (system_character_t) '.' )
+	{
+		return( 0 );
+	}
+	if( ( extension[ 1 ] != (system_character_t) 'l' )
+	 && ( extension[ 1 ] != (system_character_t) 'L' ) )
+	{
+		return( 0 );
+	}
+	if( ( extension[ 2 ] != (system_character_t) 'n' )
+	 && ( extension[ 2 ] != (system_character_t) 'N' ) )
+	{
+		return( 0 );
+	}
+	if( ( extension[ 3 ] != (system_character_t) 'k' )
+	 && ( extension[ 3 ] != (system_character_t) 'K' ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Joins a directory path and an entry name
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_join_path(
+     const system_character_t *directory_path,
+     const system_character_t *entry_name,
+     system_character_t **path,
+     libcerror_error_t **error )
+{
+	static char *function      = "scan_handle_join_path";
+	size_t directory_path_size = 0;
+	size_t entry_name_size     = 0;
+	size_t path_size           = 0;
+
+	if( directory_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory path.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path value already set.",
+		 function );
+
+		return( -1 );
+	}
+	directory_path_size = system_string_length(
+	                       directory_path );
+
+	/* Do not add a path separator if the directory path already ends with one
+	 */
+	if( ( directory_path_size > 0 )
+	 && ( directory_path[ directory_path_size - 1 ] == (system_character_t) SCAN_HANDLE_PATH_SEPARATOR ) )
+	{
+		directory_path_size -= 1;
+	}
+	entry_name_size = system_string_length(
+	                   entry_name ) + 1;
+
+	path_size = directory_path_size + 1 + entry_name_size;
+
+	if( path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*path = system_string_allocate(
+	         path_size );
+
+	if( *path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_copy(
+	     *path,
+	     directory_path,
+	     directory_path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy directory path.",
+		 function );
+
+		goto on_error;
+	}
+	( *path )[ directory_path_size ] = (system_character_t) SCAN_HANDLE_PATH_SEPARATOR;
+
+	if( system_string_copy(
+	     &( ( *path )[ directory_path_size + 1 ] ),
+	     entry_name,
+	     entry_name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy entry name.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *path != NULL )
+	{
+		memory_free(
+		 *path );
+
+		*path = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of paths
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_get_number_of_paths(
+     scan_handle_t *scan_handle,
+     int *number_of_paths,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_get_number_of_paths";
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     scan_handle->paths_array,
+	     number_of_paths,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from paths array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a file to be processed
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_append_file(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	system_character_t *path_copy = NULL;
+	static char *function         = "scan_handle_append_file";
+	size_t path_size              = 0;
+	int entry_index               = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_size = system_string_length(
+	             path ) + 1;
+
+	if( path_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	path_copy = system_string_allocate(
+	             path_size );
+
+	if( path_copy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path copy.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     path_copy,
+	     path,
+	     path_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	/* The batch entries and the paths are appended in the same order
+	 * so that the entry index of the batch refers to the corresponding path
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( liblnk_batch_append_filename_wide(
+	     scan_handle->batch,
+	     path_copy,
+	     error ) != 1 )
+#else
+	if( liblnk_batch_append_filename(
+	     scan_handle->batch,
+	     path_copy,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append file to batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     scan_handle->paths_array,
+	     &entry_index,
+	     (intptr_t *) path_copy,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path to array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( path_copy != NULL )
+	{
+		memory_free(
+		 path_copy );
+	}
+	return( -1 );
+}
+
+/* Appends an entry of a directory to be processed
+ * Sub directories are scanned recursively, only files with the .lnk extension are appended
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_append_directory_entry(
+     scan_handle_t *scan_handle,
+     const system_character_t *entry_path,
+     const system_character_t *entry_name,
+     int entry_type,
+     libcerror_error_t **error )
+{
+	static char *function    = "scan_handle_append_directory_entry";
+	size_t entry_name_length = 0;
+	int result               = 1;
+
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_type == SCAN_HANDLE_ENTRY_TYPE_DIRECTORY )
+	{
+		result = scan_handle_append_directory(
+		          scan_handle,
+		          entry_path,
+		          error );
+	}
+	else if( entry_type == SCAN_HANDLE_ENTRY_TYPE_FILE )
+	{
+		entry_name_length = system_string_length(
+		                     entry_name );
+
+		if( scan_handle_path_is_shortcut(
+		     entry_name,
+		     entry_name_length ) != 0 )
+		{
+			result = scan_handle_append_file(
+			          scan_handle,
+			          entry_path,
+			          error );
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append entry: %" PRIs_SYSTEM ".",
+		 function,
+		 entry_name );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( WINAPI )
+
+/* Appends the Windows Shortcut files in a directory and its sub directories to be processed
+ * Reparse points, like junctions and symbolic links, to directories are not followed
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_append_directory(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	WIN32_FIND_DATAW find_data;
+#else
+	WIN32_FIND_DATAA find_data;
+#endif
+
+	const system_character_t *entry_name = NULL;
+	system_character_t *entry_path       = NULL;
+	system_character_t *search_path      = NULL;
+	static char *function                = "scan_handle_append_directory";
+	HANDLE find_handle                   = INVALID_HANDLE_VALUE;
+	DWORD error_code                     = 0;
+	int entry_type                       = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_handle_join_path(
+	     path,
+	     _SYSTEM_STRING( "*" ),
+	     &search_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create search path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	find_handle = FindFirstFileW(
+	               (LPCWSTR) search_path,
+	               &find_data );
+#else
+	find_handle = FindFirstFileA(
+	               (LPCSTR) search_path,
+	               &find_data );
+#endif
+	if( find_handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		if( error_code != ERROR_FILE_NOT_FOUND )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 error_code,
+			 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+			 function,
+			 path );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		do
+		{
+			if( scan_handle->abort != 0 )
+			{
+				break;
+			}
+			entry_name = (system_character_t *) find_data.cFileName;
+
+			if( ( entry_name[ 0 ] == (system_character_t) '.' )
+			 && ( ( entry_name[ 1 ] == 0 )
+			  || ( ( entry_name[ 1 ] == (system_character_t) '.' )
+			   && ( entry_name[ 2 ] == 0 ) ) ) )
+			{
+				continue;
+			}
+			if( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY ) == 0 )
+			{
+				entry_type = SCAN_HANDLE_ENTRY_TYPE_FILE;
+			}
+			else if( ( find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT ) == 0 )
+			{
+				entry_type = SCAN_HANDLE_ENTRY_TYPE_DIRECTORY;
+			}
+			else
+			{
+				continue;
+			}
+			if( scan_handle_join_path(
+			     path,
+			     entry_name,
+			     &entry_path,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create entry path.",
+				 function );
+
+				goto on_error;
+			}
+			if( scan_handle_append_directory_entry(
+			     scan_handle,
+			     entry_path,
+			     entry_name,
+			     entry_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append directory entry.",
+				 function );
+
+				goto on_error;
+			}
+			memory_free(
+			 entry_path );
+
+			entry_path = NULL;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		while( FindNextFileW(
+		        find_handle,
+		        &find_data ) != 0 );
+#else
+		while( FindNextFileA(
+		        find_handle,
+		        &find_data ) != 0 );
+#endif
+
+		error_code = GetLastError();
+
+		if( ( scan_handle->abort == 0 )
+		 && ( error_code != ERROR_NO_MORE_FILES ) )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 error_code,
+			 "%s: unable to read directory: %" PRIs_SYSTEM ".",
+			 function,
+			 path );
+
+			goto on_error;
+		}
+		if( FindClose(
+		     find_handle ) == 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 GetLastError(),
+			 "%s: unable to close directory: %" PRIs_SYSTEM ".",
+			 function,
+			 path );
+
+			find_handle = INVALID_HANDLE_VALUE;
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 search_path );
+
+	return( 1 );
+
+on_error:
+	if( find_handle != INVALID_HANDLE_VALUE )
+	{
+		FindClose(
+		 find_handle );
+	}
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+	if( search_path != NULL )
+	{
+		memory_free(
+		 search_path );
+	}
+	return( -1 );
+}
+
+#elif defined( HAVE_OPENDIR ) && defined( HAVE_READDIR ) && defined( HAVE_CLOSEDIR ) && defined( HAVE_LSTAT ) && defined( HAVE_STAT )
+
+/* Appends the Windows Shortcut files in a directory and its sub directories to be processed
+ * Symbolic links to files are followed, symbolic links to directories are not
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_append_directory(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	struct stat file_statistics;
+
+	struct dirent *directory_entry       = NULL;
+	const system_character_t *entry_name = NULL;
+	system_character_t *entry_path       = NULL;
+	DIR *directory                       = NULL;
+	static char *function                = "scan_handle_append_directory";
+	int entry_type                       = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	directory = opendir(
+	             path );
+
+	if( directory == NULL )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		goto on_error;
+	}
+	while( scan_handle->abort == 0 )
+	{
+		errno = 0;
+
+		directory_entry = readdir(
+		                   directory );
+
+		if( directory_entry == NULL )
+		{
+			if( errno != 0 )
+			{
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 errno,
+				 "%s: unable to read directory: %" PRIs_SYSTEM ".",
+				 function,
+				 path );
+
+				goto on_error;
+			}
+			break;
+		}
+		entry_name = directory_entry->d_name;
+
+		if( ( entry_name[ 0 ] == '.' )
+		 && ( ( entry_name[ 1 ] == 0 )
+		  || ( ( entry_name[ 1 ] == '.' )
+		   && ( entry_name[ 2 ] == 0 ) ) ) )
+		{
+			continue;
+		}
+		if( scan_handle_join_path(
+		     path,
+		     entry_name,
+		     &entry_path,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create entry path.",
+			 function );
+
+			goto on_error;
+		}
+		entry_type = 0;
+
+		if( lstat(
+		     entry_path,
+		     &file_statistics ) == 0 )
+		{
+			if( S_ISDIR( file_statistics.st_mode ) )
+			{
+				entry_type = SCAN_HANDLE_ENTRY_TYPE_DIRECTORY;
+			}
+			else if( S_ISREG( file_statistics.st_mode ) )
+			{
+				entry_type = SCAN_HANDLE_ENTRY_TYPE_FILE;
+			}
+			else if( S_ISLNK( file_statistics.st_mode ) )
+			{
+				if( ( stat(
+				       entry_path,
+				       &file_statistics ) == 0 )
+				 && S_ISREG( file_statistics.st_mode ) )
+				{
+					entry_type = SCAN_HANDLE_ENTRY_TYPE_FILE;
+				}
+			}
+		}
+		if( scan_handle_append_directory_entry(
+		     scan_handle,
+		     entry_path,
+		     entry_name,
+		     entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 entry_path );
+
+		entry_path = NULL;
+	}
+	if( closedir(
+	     directory ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		directory = NULL;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( directory != NULL )
+	{
+		closedir(
+		 directory );
+	}
+	if( entry_path != NULL )
+	{
+		memory_free(
+		 entry_path );
+	}
+	return( -1 );
+}
+
+#else
+
+/* Appends the Windows Shortcut files in a directory and its sub directories to be processed
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_append_directory(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_append_directory";
+
+	LNKTOOLS_UNREFERENCED_PARAMETER( scan_handle )
+
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: scanning directory: %" PRIs_SYSTEM " is not supported.",
+	 function,
+	 path );
+
+	return( -1 );
+}
+
+#endif /* defined( WINAPI ) */
+
+/* Appends a path to be processed
+ * A directory is scanned recursively for Windows Shortcut files, other paths are appended as a file
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_append_path(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *directory_error = NULL;
+	static char *function              = "scan_handle_append_path";
+	int result                         = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* A path that cannot be accessed is appended as a file
+	 * so that the failure is reported in its record
+	 */
+	result = scan_handle_path_is_directory(
+	          path,
+	          &directory_error );
+
+	if( result == -1 )
+	{
+		libcerror_error_free(
+		 &directory_error );
+	}
+	if( result == 1 )
+	{
+		result = scan_handle_append_directory(
+		          scan_handle,
+		          path,
+		          error );
+	}
+	else
+	{
+		result = scan_handle_append_file(
+		          scan_handle,
+		          path,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append path.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the paths in a file list to be processed
+ * The file list contains one path per line, empty lines are ignored
+ * A filename of "-" reads the file list from stdin
+ * Returns 1 if successful or -1 on error
+ */
+int scan_handle_append_file_list(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t *line = NULL;
+	FILE *file_stream        = NULL;
+	static char *function    = "scan_handle_append_file_list";
+	size_t line_length       = 0;
+	int line_number          = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	line = system_string_allocate(
+	        SCAN_HANDLE_MAXIMUM_PATH_SIZE );
+
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create line.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( filename[ 0 ] == (system_character_t) '-' )
+	 && ( filename[ 1 ] == 0 ) )
+	{
+		file_stream = stdin;
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		file_stream = file_stream_open_wide(
+		               filename,
+		               _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+		file_stream = file_stream_open(
+		               filename,
+		               FILE_STREAM_OPEN_READ );
+#endif
+		if( file_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file list: %" PRIs_SYSTEM ".",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+	}
+	while( scan_handle->abort == 0 )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( file_stream_get_string_wide(
+		     file_stream,
+		     line,
+		     SCAN_HANDLE_MAXIMUM_PATH_SIZE ) == NULL )
+#else
+		if( file_stream_get_string(
+		     file_stream,
+		     line,
+		     SCAN_HANDLE_MAXIMUM_PATH_SIZE ) == NULL )
+#endif
+		{
+			break;
+		}
+		line_number++;
+
+		line_length = system_string_length(
+		               line );
+
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\n' ) )
+		{
+			line_length--;
+		}
+		else if( line_length == ( SCAN_HANDLE_MAXIMUM_PATH_SIZE - 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid path on line: %d length value exceeds maximum.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+		if( ( line_length > 0 )
+		 && ( line[ line_length - 1 ] == (system_character_t) '\r' ) )
+		{
+			line_length--;
+		}
+		if( line_length == 0 )
+		{
+			continue;
+		}
+		line[ line_length ] = 0;
+
+		if( scan_handle_append_path(
+		     scan_handle,
+		     line,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append path on line: %d.",
+			 function,
+			 line_number );
+
+			goto on_error;
+		}
+	}
+	if( file_stream != stdin )
+	{
+		if( file_stream_close(
+		     file_stream ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file list.",
+			 function );
+
+			file_stream = NULL;
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 line );
+
+	return( 1 );
+
+on_error:
+	if( ( file_stream != NULL )
+	 && ( file_stream != stdin ) )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	if( line != NULL )
+	{
+		memory_free(
+		 line );
+	}
+	return( -1 );
+}
+
+/* Prints the record of a processed file
+ * This function is called by the batch, in the order the files were appended
+ * A file that cannot be opened or printed is reported in its record and does not stop the scan
+ * Returns 1 if successful or -1 to stop processing
+ */
+int scan_handle_process_file(
+     int entry_index,
+     liblnk_file_t *file,
+     libcerror_error_t *open_error,
+     scan_handle_t *scan_handle )
+{
+	libcerror_error_t *error   = NULL;
+	info_handle_t *info_handle = NULL;
+	liblnk_file_t *input_file  = NULL;
+	system_character_t *path   = NULL;
+	int result                 = 1;
+
+	if( scan_handle == NULL )
+	{
+		return( -1 );
+	}
+	info_handle = scan_handle->info_handle;
+
+	if( info_handle == NULL )
+	{
+		return( -1 );
+	}
+	if( scan_handle->abort != 0 )
+	{
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     scan_handle->paths_array,
+	     entry_index,
+	     (intptr_t **) &path,
+	     &error ) != 1 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "Source file: %" PRIs_SYSTEM "\n\n",
+	 path );
+
+	if( file == NULL )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Unable to open source file.\n\n" );
+
+		libcnotify_print_error_backtrace(
+		 open_error );
+
+		scan_handle->number_of_failed_files += 1;
+
+		return( 1 );
+	}
+	/* The ASCII codepage is applied before any string is converted
+	 */
+	result = liblnk_file_set_ascii_codepage(
+	          file,
+	          info_handle->ascii_codepage,
+	          &error );
+
+	if( result == 1 )
+	{
+		input_file              = info_handle->input_file;
+		info_handle->input_file = file;
+
+		result = info_handle_file_fprint(
+		          info_handle,
+		          &error );
+
+		if( ( result == 1 )
+		 && ( info_handle->collect_statistics != 0 ) )
+		{
+			result = info_handle_statistics_fprint(
+			          info_handle,
+			          &error );
+		}
+		info_handle->input_file = input_file;
+	}
+	if( result != 1 )
+	{
+		fprintf(
+		 info_handle->notify_stream,
+		 "Unable to print file information.\n\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+
+		scan_handle->number_of_failed_files += 1;
+	}
+	return( 1 );
+}
+
+/* Opens the appended files on the worker threads and prints a record per file
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int scan_handle_process(
+     scan_handle_t *scan_handle,
+     info_handle_t *info_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "scan_handle_process";
+	int access_flags      = LIBLNK_OPEN_READ;
+	int result            = 0;
+
+	if( scan_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( info_handle->collect_statistics != 0 )
+	{
+		access_flags |= LIBLNK_ACCESS_FLAG_COLLECT_STATISTICS;
+	}
+	scan_handle->info_handle = info_handle;
+
+	result = liblnk_batch_process(
+	          scan_handle->batch,
+	          access_flags,
+	          LIBLNK_BATCH_RESULT_ORDER_INPUT,
+	          (int (*)(int, liblnk_file_t *, libcerror_error_t *, void *)) &scan_handle_process_file,
+	          (void *) scan_handle,
+	          error );
+
+	scan_handle->info_handle = NULL;
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process batch.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,172 @@
+/*
+ * Scan handle
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _SCAN_HANDLE_H )
+#define _SCAN_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "info_handle.h"
+#include "lnktools_libcdata.h"
+#include "lnktools_libcerror.h"
+#include "lnktools_liblnk.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of concurrent processing jobs (threads)
+ */
+#define SCAN_HANDLE_DEFAULT_NUMBER_OF_THREADS	4
+
+/* The maximum number of concurrent processing jobs (threads)
+ */
+#define SCAN_HANDLE_MAXIMUM_NUMBER_OF_THREADS	64
+
+/* The maximum size of a path in a file list, including the end-of-string character
+ */
+#define SCAN_HANDLE_MAXIMUM_PATH_SIZE		32768
+
+#if defined( WINAPI )
+#define SCAN_HANDLE_PATH_SEPARATOR		'\\'
+#else
+#define SCAN_HANDLE_PATH_SEPARATOR		'/'
+#endif
+
+enum SCAN_HANDLE_ENTRY_TYPES
+{
+	SCAN_HANDLE_ENTRY_TYPE_DIRECTORY	= 1,
+	SCAN_HANDLE_ENTRY_TYPE_FILE		= 2
+};
+
+typedef struct scan_handle scan_handle_t;
+
+struct scan_handle
+{
+	/* The batch
+	 */
+	liblnk_batch_t *batch;
+
+	/* The paths array
+	 * Contains the path of every batch entry at the index of the entry
+	 */
+	libcdata_array_t *paths_array;
+
+	/* The info handle used to print the records
+	 * The info handle is only set while the batch is being processed
+	 */
+	info_handle_t *info_handle;
+
+	/* The number of files that could not be opened or printed
+	 */
+	int number_of_failed_files;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int scan_handle_initialize(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_free(
+     scan_handle_t **scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_path_free(
+     system_character_t **path,
+     libcerror_error_t **error );
+
+int scan_handle_signal_abort(
+     scan_handle_t *scan_handle,
+     libcerror_error_t **error );
+
+int scan_handle_set_number_of_threads(
+     scan_handle_t *scan_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int scan_handle_path_is_directory(
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int scan_handle_path_is_shortcut(
+     const system_character_t *path,
+     size_t path_length );
+
+int scan_handle_join_path(
+     const system_character_t *directory_path,
+     const system_character_t *entry_name,
+     system_character_t **path,
+     libcerror_error_t **error );
+
+int scan_handle_get_number_of_paths(
+     scan_handle_t *scan_handle,
+     int *number_of_paths,
+     libcerror_error_t **error );
+
+int scan_handle_append_file(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int scan_handle_append_directory_entry(
+     scan_handle_t *scan_handle,
+     const system_character_t *entry_path,
+     const system_character_t *entry_name,
+     int entry_type,
+     libcerror_error_t **error );
+
+int scan_handle_append_directory(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int scan_handle_append_path(
+     scan_handle_t *scan_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int scan_handle_append_file_list(
+     scan_handle_t *scan_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int scan_handle_process_file(
+     int entry_index,
+     liblnk_file_t *file,
+     libcerror_error_t *open_error,
+     scan_handle_t *scan_handle );
+
+int scan_handle_process(
+     scan_handle_t *scan_handle,
+     info_handle_t *info_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _SCAN_HANDLE_H ) */
+
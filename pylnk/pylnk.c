@@ -40,6 +40,7 @@
 #include "pylnk_libbfio.h"
 #include "pylnk_libcerror.h"
 #include "pylnk_liblnk.h"
+#include "pylnk_parse.h"
 #include "pylnk_python.h"
 #include "pylnk_strings_data_block.h"
 #include "pylnk_unused.h"
@@ -91,6 +92,27 @@ PyMethodDef pylnk_module_methods[] = {
 	  "\n"
 	  "Opens a file using a file-like object." },
 
+	{ "open_bytes",
+	  (PyCFunction) pylnk_open_new_file_with_bytes,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_bytes(buffer, mode='r') -> Object\n"
+	  "\n"
+	  "Opens a file using an object that supports the buffer protocol, such as bytes.\n"
+	  "The data is parsed in place and must not be modified while the file is open." },
+
+	{ "parse_many",
+	  (PyCFunction) pylnk_parse_many,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "parse_many(paths, workers=1) -> List\n"
+	  "\n"
+	  "Parses files and retrieves their values.\n"
+	  "Returns a list with a dictionary per path, as returned by file.to_dict(),\n"
+	  "or None if the file could not be opened or read. The list is in the order\n"
+	  "of the paths and is returned after all the files were parsed.\n"
+	  "The files are parsed by the number of workers (native threads) with the GIL released.\n"
+	  "If liblnk was built without multi-thread support the files are parsed\n"
+	  "sequentially by the calling thread regardless of the number of workers." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -536,6 +558,57 @@ on_error:
 	return( NULL );
 }
 
+/* Creates a new file object and opens it using an object that supports the buffer protocol
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pylnk_open_new_file_with_bytes(
+           PyObject *self PYLNK_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	pylnk_file_t *pylnk_file = NULL;
+	static char *function    = "pylnk_open_new_file_with_bytes";
+
+	PYLNK_UNREFERENCED_PARAMETER( self )
+
+	/* PyObject_New does not invoke tp_init
+	 */
+	pylnk_file = PyObject_New(
+	              struct pylnk_file,
+	              &pylnk_file_type_object );
+
+	if( pylnk_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( pylnk_file_init(
+	     pylnk_file ) != 0 )
+	{
+		goto on_error;
+	}
+	if( pylnk_file_open_bytes(
+	     pylnk_file,
+	     arguments,
+	     keywords ) == NULL )
+	{
+		goto on_error;
+	}
+	return( (PyObject *) pylnk_file );
+
+on_error:
+	if( pylnk_file != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pylnk_file );
+	}
+	return( NULL );
+}
+
 #if PY_MAJOR_VERSION >= 3
 
 /* The pylnk module definition
@@ -55,6 +55,11 @@ PyObject *pylnk_open_new_file_with_file_object(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pylnk_open_new_file_with_bytes(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if PY_MAJOR_VERSION >= 3
 PyMODINIT_FUNC PyInit_pylnk(
                 void );
@@ -29,6 +29,7 @@
 #include "pylnk_data_block.h"
 #include "pylnk_distributed_link_tracking_data_block.h"
 #include "pylnk_error.h"
+#include "pylnk_file.h"
 #include "pylnk_libcerror.h"
 #include "pylnk_liblnk.h"
 #include "pylnk_python.h"
@@ -64,15 +65,23 @@ PyGetSetDef pylnk_data_block_object_get_set_definitions[] = {
 	  NULL },
 
 	{ "data",
-	  (getter) pylnk_data_block_get_data,
+	  (getter) pylnk_data_block_get_data_view,
 	  (setter) 0,
-	  "The data.",
+	  "The data, as a read-only memoryview that references the data of the data block.",
 	  NULL },
 
 	/* Sentinel */
 	{ NULL, NULL, NULL, NULL, NULL }
 };
 
+PyBufferProcs pylnk_data_block_buffer_procs = {
+
+	/* bf_getbuffer */
+	(getbufferproc) pylnk_data_block_get_buffer,
+	/* bf_releasebuffer */
+	(releasebufferproc) pylnk_data_block_release_buffer
+};
+
 PyTypeObject pylnk_data_block_type_object = {
 	PyVarObject_HEAD_INIT( NULL, 0 )
 
@@ -111,7 +120,7 @@ PyTypeObject pylnk_data_block_type_object = {
 	/* tp_setattro */
 	0,
 	/* tp_as_buffer */
-	0,
+	&pylnk_data_block_buffer_procs,
 	/* tp_flags */
 	Py_TPFLAGS_DEFAULT,
 	/* tp_doc */
@@ -556,3 +565,149 @@ on_error:
 	return( NULL );
 }
 
+/* Retrieves the data as a memoryview
+ * The memoryview references the data of the data block without copying it
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pylnk_data_block_get_data_view(
+           pylnk_data_block_t *pylnk_data_block,
+           PyObject *arguments PYLNK_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pylnk_data_block_get_data_view";
+	size_t data_size         = 0;
+	int result               = 0;
+
+	PYLNK_UNREFERENCED_PARAMETER( arguments )
+
+	if( pylnk_data_block == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data block.",
+		 function );
+
+		return( NULL );
+	}
+	result = liblnk_data_block_get_data_size(
+	          pylnk_data_block->data_block,
+	          &data_size,
+	          &error );
+
+	if( result == -1 )
+	{
+		pylnk_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( ( result == 0 )
+	      || ( data_size == 0 ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	/* The memoryview keeps a reference to the data block object
+	 * which in turn keeps a reference to the parent object
+	 */
+	return( PyMemoryView_FromObject(
+	         (PyObject *) pylnk_data_block ) );
+}
+
+/* Exports the data as a read-only buffer
+ * Returns 0 if successful or -1 on error
+ */
+int pylnk_data_block_get_buffer(
+     pylnk_data_block_t *pylnk_data_block,
+     Py_buffer *buffer_view,
+     int flags )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *data      = NULL;
+	static char *function    = "pylnk_data_block_get_buffer";
+	size_t data_size         = 0;
+
+	if( pylnk_data_block == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid data block.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_data_block_get_data(
+	     pylnk_data_block->data_block,
+	     &data,
+	     &data_size,
+	     &error ) != 1 )
+	{
+		pylnk_error_raise(
+		 error,
+		 PyExc_BufferError,
+		 "%s: unable to retrieve data.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) PY_SSIZE_T_MAX )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( PyBuffer_FillInfo(
+	     buffer_view,
+	     (PyObject *) pylnk_data_block,
+	     (void *) data,
+	     (Py_ssize_t) data_size,
+	     1,
+	     flags ) != 0 )
+	{
+		return( -1 );
+	}
+	if( ( pylnk_data_block->parent_object != NULL )
+	 && ( PyObject_TypeCheck(
+	       pylnk_data_block->parent_object,
+	       &pylnk_file_type_object ) != 0 ) )
+	{
+		( (pylnk_file_t *) pylnk_data_block->parent_object )->number_of_exported_buffers += 1;
+	}
+	return( 0 );
+}
+
+/* Releases an exported buffer
+ */
+void pylnk_data_block_release_buffer(
+      pylnk_data_block_t *pylnk_data_block,
+      Py_buffer *buffer_view PYLNK_ATTRIBUTE_UNUSED )
+{
+	PYLNK_UNREFERENCED_PARAMETER( buffer_view )
+
+	if( pylnk_data_block == NULL )
+	{
+		return;
+	}
+	if( ( pylnk_data_block->parent_object != NULL )
+	 && ( PyObject_TypeCheck(
+	       pylnk_data_block->parent_object,
+	       &pylnk_file_type_object ) != 0 ) )
+	{
+		( (pylnk_file_t *) pylnk_data_block->parent_object )->number_of_exported_buffers -= 1;
+	}
+}
+
@@ -50,6 +50,7 @@ struct pylnk_data_block
 };
 
 extern PyMethodDef pylnk_data_block_object_methods[];
+extern PyBufferProcs pylnk_data_block_buffer_procs;
 extern PyTypeObject pylnk_data_block_type_object;
 
 PyTypeObject *pylnk_data_block_get_type_object(
@@ -74,6 +75,19 @@ PyObject *pylnk_data_block_get_data(
            pylnk_data_block_t *pylnk_data_block,
            PyObject *arguments );
 
+PyObject *pylnk_data_block_get_data_view(
+           pylnk_data_block_t *pylnk_data_block,
+           PyObject *arguments );
+
+int pylnk_data_block_get_buffer(
+     pylnk_data_block_t *pylnk_data_block,
+     Py_buffer *buffer_view,
+     int flags );
+
+void pylnk_data_block_release_buffer(
+      pylnk_data_block_t *pylnk_data_block,
+      Py_buffer *buffer_view );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -34,6 +34,7 @@
 #include "pylnk_error.h"
 #include "pylnk_file.h"
 #include "pylnk_file_object_io_handle.h"
+#include "pylnk_file_record.h"
 #include "pylnk_guid.h"
 #include "pylnk_integer.h"
 #include "pylnk_libbfio.h"
@@ -78,6 +79,14 @@ PyMethodDef pylnk_file_object_methods[] = {
 	  "\n"
 	  "Opens a file using a file-like object." },
 
+	{ "open_bytes",
+	  (PyCFunction) pylnk_file_open_bytes,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "open_bytes(buffer, mode='r') -> None\n"
+	  "\n"
+	  "Opens a file using an object that supports the buffer protocol, such as bytes.\n"
+	  "The data is parsed in place and must not be modified while the file is open." },
+
 	{ "close",
 	  (PyCFunction) pylnk_file_close,
 	  METH_NOARGS,
@@ -324,6 +333,14 @@ PyMethodDef pylnk_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the (extra) data block specified by the index." },
 
+	{ "to_dict",
+	  (PyCFunction) pylnk_file_to_dict,
+	  METH_NOARGS,
+	  "to_dict() -> Dictionary\n"
+	  "\n"
+	  "Retrieves the values of the file as a dictionary.\n"
+	  "The keys are the names of the corresponding file properties." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -623,8 +640,10 @@ int pylnk_file_init(
 	}
 	/* Make sure liblnk file is set to NULL
 	 */
-	pylnk_file->file           = NULL;
-	pylnk_file->file_io_handle = NULL;
+	pylnk_file->file                       = NULL;
+	pylnk_file->file_io_handle             = NULL;
+	pylnk_file->has_buffer_view            = 0;
+	pylnk_file->number_of_exported_buffers = 0;
 
 	if( liblnk_file_initialize(
 	     &( pylnk_file->file ),
@@ -684,7 +703,8 @@ void pylnk_file_free(
 
 		return;
 	}
-	if( pylnk_file->file_io_handle != NULL )
+	if( ( pylnk_file->file_io_handle != NULL )
+	 || ( pylnk_file->has_buffer_view != 0 ) )
 	{
 		if( pylnk_file_close(
 		     pylnk_file,
@@ -1124,6 +1144,123 @@ on_error:
 	return( NULL );
 }
 
+/* Opens a file using an object that supports the buffer protocol
+ * The buffer is not copied, a buffer view is held until the file is closed
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pylnk_file_open_bytes(
+           pylnk_file_t *pylnk_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *buffer_object     = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pylnk_file_open_bytes";
+	static char *keyword_list[] = { "buffer", "mode", NULL };
+	char *mode                  = NULL;
+	int result                  = 0;
+
+	if( pylnk_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|s",
+	     keyword_list,
+	     &buffer_object,
+	     &mode ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( mode != NULL )
+	 && ( mode[ 0 ] != 'r' ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: unsupported mode: %s.",
+		 function,
+		 mode );
+
+		return( NULL );
+	}
+	if( PyObject_CheckBuffer(
+	     buffer_object ) == 0 )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported buffer object - buffer protocol not supported.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( pylnk_file->file_io_handle != NULL )
+	 || ( pylnk_file->has_buffer_view != 0 ) )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: invalid file - file already open.",
+		 function );
+
+		return( NULL );
+	}
+	/* PyBUF_SIMPLE requests a contiguous buffer
+	 */
+	if( PyObject_GetBuffer(
+	     buffer_object,
+	     &( pylnk_file->buffer_view ),
+	     PyBUF_SIMPLE ) != 0 )
+	{
+		return( NULL );
+	}
+	pylnk_file->has_buffer_view = 1;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = liblnk_file_open_memory(
+	          pylnk_file->file,
+	          (const uint8_t *) pylnk_file->buffer_view.buf,
+	          (size_t) pylnk_file->buffer_view.len,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pylnk_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to open file.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+
+on_error:
+	if( pylnk_file->has_buffer_view != 0 )
+	{
+		PyBuffer_Release(
+		 &( pylnk_file->buffer_view ) );
+
+		pylnk_file->has_buffer_view = 0;
+	}
+	return( NULL );
+}
+
 /* Closes a file
  * Returns a Python object if successful or NULL on error
  */
@@ -1146,6 +1283,18 @@ PyObject *pylnk_file_close(
 
 		return( NULL );
 	}
+	/* The exported buffers reference the data of the data blocks
+	 * that is freed on close
+	 */
+	if( pylnk_file->number_of_exported_buffers > 0 )
+	{
+		PyErr_Format(
+		 PyExc_BufferError,
+		 "%s: unable to close file while data block buffers are exported.",
+		 function );
+
+		return( NULL );
+	}
 	Py_BEGIN_ALLOW_THREADS
 
 	result = liblnk_file_close(
@@ -1191,6 +1340,13 @@ PyObject *pylnk_file_close(
 			return( NULL );
 		}
 	}
+	if( pylnk_file->has_buffer_view != 0 )
+	{
+		PyBuffer_Release(
+		 &( pylnk_file->buffer_view ) );
+
+		pylnk_file->has_buffer_view = 0;
+	}
 	Py_IncRef(
 	 Py_None );
 
@@ -4246,3 +4402,74 @@ PyObject *pylnk_file_get_data_blocks(
 	return( sequence_object );
 }
 
+/* Retrieves the values of the file as a dictionary
+ * The values are retrieved with the GIL released and converted into Python objects afterwards
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pylnk_file_to_dict(
+           pylnk_file_t *pylnk_file,
+           PyObject *arguments PYLNK_ATTRIBUTE_UNUSED )
+{
+	PyObject *dict_object            = NULL;
+	libcerror_error_t *error         = NULL;
+	pylnk_file_record_t *file_record = NULL;
+	static char *function            = "pylnk_file_to_dict";
+	int result                       = 0;
+
+	PYLNK_UNREFERENCED_PARAMETER( arguments )
+
+	if( pylnk_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = pylnk_file_record_initialize(
+	          &file_record,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = pylnk_file_record_read_file(
+		          file_record,
+		          pylnk_file->file,
+		          &error );
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pylnk_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve file values.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	dict_object = pylnk_file_record_new_dict(
+	               file_record );
+
+	pylnk_file_record_free(
+	 &file_record,
+	 NULL );
+
+	return( dict_object );
+
+on_error:
+	if( file_record != NULL )
+	{
+		pylnk_file_record_free(
+		 &file_record,
+		 NULL );
+	}
+	return( NULL );
+}
@@ -48,6 +48,20 @@ struct pylnk_file
 	/* The libbfio file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
+
+	/* The buffer view of the object opened by open_bytes
+	 * The view keeps the exported memory valid while the file is open
+	 */
+	Py_buffer buffer_view;
+
+	/* Value to indicate the buffer view is set
+	 */
+	int has_buffer_view;
+
+	/* The number of buffers exported by the data blocks of the file
+	 * The file cannot be closed while data block buffers are exported
+	 */
+	int number_of_exported_buffers;
 };
 
 extern PyMethodDef pylnk_file_object_methods[];
@@ -73,6 +87,11 @@ PyObject *pylnk_file_open_file_object(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pylnk_file_open_bytes(
+           pylnk_file_t *pylnk_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pylnk_file_close(
            pylnk_file_t *pylnk_file,
            PyObject *arguments );
@@ -232,6 +251,10 @@ PyObject *pylnk_file_get_data_blocks(
            pylnk_file_t *pylnk_file,
            PyObject *arguments );
 
+PyObject *pylnk_file_to_dict(
+           pylnk_file_t *pylnk_file,
+           PyObject *arguments );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -102,7 +102,8 @@ int pylnk_file_object_io_handle_initialize(
 
 		goto on_error;
 	}
-	( *file_object_io_handle )->file_object = file_object;
+	( *file_object_io_handle )->file_object    = file_object;
+	( *file_object_io_handle )->current_offset = -1;
 
 	Py_IncRef(
 	 ( *file_object_io_handle )->file_object );
@@ -232,6 +233,11 @@ int pylnk_file_object_io_handle_free(
 		Py_DecRef(
 		 ( *file_object_io_handle )->file_object );
 
+		if( ( *file_object_io_handle )->read_buffer != NULL )
+		{
+			PyMem_Free(
+			 ( *file_object_io_handle )->read_buffer );
+		}
 		PyMem_Free(
 		 *file_object_io_handle );
 
@@ -366,7 +372,10 @@ int pylnk_file_object_io_handle_open(
 	}
 	/* No need to do anything here, because the file object is already open
 	 */
-	file_object_io_handle->access_flags = access_flags;
+	file_object_io_handle->access_flags          = access_flags;
+	file_object_io_handle->current_offset        = -1;
+	file_object_io_handle->read_buffer_offset    = 0;
+	file_object_io_handle->read_buffer_data_size = 0;
 
 	return( 1 );
 }
@@ -404,7 +413,10 @@ int pylnk_file_object_io_handle_close(
 	}
 	/* Do not close the file object, have Python deal with it
 	 */
-	file_object_io_handle->access_flags = 0;
+	file_object_io_handle->access_flags          = 0;
+	file_object_io_handle->current_offset        = -1;
+	file_object_io_handle->read_buffer_offset    = 0;
+	file_object_io_handle->read_buffer_data_size = 0;
 
 	return( 0 );
 }
@@ -556,13 +568,14 @@ ssize_t pylnk_file_object_read_buffer(
 
 			goto on_error;
 		}
-		if( safe_read_count > (Py_ssize_t) SSIZE_MAX )
+		if( ( safe_read_count < 0 )
+		 || ( (size_t) safe_read_count > size ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid read count value exceeds maximum.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid read count value out of bounds.",
 			 function );
 
 			goto on_error;
@@ -614,6 +627,9 @@ on_error:
 }
 
 /* Reads a buffer from the file object IO handle
+ * The data is read from the file object in blocks of the read-ahead size
+ * and served from the read-ahead buffer, to reduce the number of calls
+ * into the Python file object
  * Returns the number of bytes read if successful, or -1 on error
  */
 ssize_t pylnk_file_object_io_handle_read(
@@ -624,6 +640,9 @@ ssize_t pylnk_file_object_io_handle_read(
 {
 	static char *function      = "pylnk_file_object_io_handle_read";
 	PyGILState_STATE gil_state = 0;
+	size_t buffer_offset       = 0;
+	size_t read_size           = 0;
+	size_t read_buffer_index   = 0;
 	ssize_t read_count         = 0;
 
 	if( file_object_io_handle == NULL )
@@ -637,29 +656,172 @@ ssize_t pylnk_file_object_io_handle_read(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
-
-	read_count = pylnk_file_object_read_buffer(
-	              file_object_io_handle->file_object,
-	              buffer,
-	              size,
-	              error );
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
 
-	if( read_count == -1 )
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	gil_state = PyGILState_Ensure();
+
+	if( file_object_io_handle->current_offset < 0 )
+	{
+		if( pylnk_file_object_get_offset(
+		     file_object_io_handle->file_object,
+		     &( file_object_io_handle->current_offset ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve current offset in file object.",
+			 function );
+
+			file_object_io_handle->current_offset = -1;
+
+			goto on_error;
+		}
+	}
+	while( buffer_offset < size )
+	{
+		if( ( file_object_io_handle->current_offset >= file_object_io_handle->read_buffer_offset )
+		 && ( file_object_io_handle->current_offset < ( file_object_io_handle->read_buffer_offset + (off64_t) file_object_io_handle->read_buffer_data_size ) ) )
+		{
+			read_buffer_index = (size_t) ( file_object_io_handle->current_offset - file_object_io_handle->read_buffer_offset );
+			read_size         = file_object_io_handle->read_buffer_data_size - read_buffer_index;
+
+			if( read_size > ( size - buffer_offset ) )
+			{
+				read_size = size - buffer_offset;
+			}
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( file_object_io_handle->read_buffer[ read_buffer_index ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data from read-ahead buffer.",
+				 function );
+
+				goto on_error;
+			}
+			buffer_offset                         += read_size;
+			file_object_io_handle->current_offset += (off64_t) read_size;
+
+			continue;
+		}
+		/* The seek is deferred until data needs to be read from the file object
+		 */
+		if( pylnk_file_object_seek_offset(
+		     file_object_io_handle->file_object,
+		     file_object_io_handle->current_offset,
+		     SEEK_SET,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek in file object.",
+			 function );
+
+			goto on_error;
+		}
+		read_size = size - buffer_offset;
+
+		/* Read large requests directly into the buffer
+		 */
+		if( read_size >= PYLNK_FILE_OBJECT_IO_HANDLE_READ_AHEAD_SIZE )
+		{
+			read_count = pylnk_file_object_read_buffer(
+			              file_object_io_handle->file_object,
+			              &( buffer[ buffer_offset ] ),
+			              read_size,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from file object.",
+				 function );
+
+				goto on_error;
+			}
+			buffer_offset                         += (size_t) read_count;
+			file_object_io_handle->current_offset += (off64_t) read_count;
+
+			break;
+		}
+		if( file_object_io_handle->read_buffer == NULL )
+		{
+			file_object_io_handle->read_buffer = (uint8_t *) PyMem_Malloc(
+			                                                  sizeof( uint8_t ) * PYLNK_FILE_OBJECT_IO_HANDLE_READ_AHEAD_SIZE );
+
+			if( file_object_io_handle->read_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create read-ahead buffer.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		file_object_io_handle->read_buffer_offset    = file_object_io_handle->current_offset;
+		file_object_io_handle->read_buffer_data_size = 0;
+
+		read_count = pylnk_file_object_read_buffer(
+		              file_object_io_handle->file_object,
+		              file_object_io_handle->read_buffer,
+		              PYLNK_FILE_OBJECT_IO_HANDLE_READ_AHEAD_SIZE,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read from file object.",
+			 function );
+
+			goto on_error;
+		}
+		else if( read_count == 0 )
+		{
+			break;
+		}
+		file_object_io_handle->read_buffer_data_size = (size_t) read_count;
 	}
 	PyGILState_Release(
 	 gil_state );
 
-	return( read_count );
+	return( (ssize_t) buffer_offset );
 
 on_error:
 	PyGILState_Release(
@@ -1130,6 +1292,7 @@ on_error:
 }
 
 /* Seeks a certain offset within the file object IO handle
+ * The seek in the file object is deferred until data is read from it
  * Returns the offset if the seek is successful or -1 on error
  */
 off64_t pylnk_file_object_io_handle_seek_offset(
@@ -1152,37 +1315,91 @@ off64_t pylnk_file_object_io_handle_seek_offset(
 
 		return( -1 );
 	}
-	gil_state = PyGILState_Ensure();
-
-	if( pylnk_file_object_seek_offset(
-	     file_object_io_handle->file_object,
-	     offset,
-	     whence,
-	     error ) != 1 )
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek in file object.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( pylnk_file_object_get_offset(
-	     file_object_io_handle->file_object,
-	     &offset,
-	     error ) != 1 )
+	gil_state = PyGILState_Ensure();
+
+	if( whence == SEEK_END )
+	{
+		/* The end offset is only known by the file object
+		 */
+		if( pylnk_file_object_seek_offset(
+		     file_object_io_handle->file_object,
+		     offset,
+		     whence,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek in file object.",
+			 function );
+
+			goto on_error;
+		}
+		if( pylnk_file_object_get_offset(
+		     file_object_io_handle->file_object,
+		     &offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to retrieve current offset in file object.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( whence == SEEK_CUR )
+	{
+		if( file_object_io_handle->current_offset < 0 )
+		{
+			if( pylnk_file_object_get_offset(
+			     file_object_io_handle->file_object,
+			     &( file_object_io_handle->current_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to retrieve current offset in file object.",
+				 function );
+
+				file_object_io_handle->current_offset = -1;
+
+				goto on_error;
+			}
+		}
+		offset += file_object_io_handle->current_offset;
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to retrieve current offset in file object.",
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
+	file_object_io_handle->current_offset = offset;
+
 	PyGILState_Release(
 	 gil_state );
 
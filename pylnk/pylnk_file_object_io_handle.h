@@ -33,6 +33,10 @@
 extern "C" {
 #endif
 
+/* The size of the read-ahead buffer
+ */
+#define PYLNK_FILE_OBJECT_IO_HANDLE_READ_AHEAD_SIZE	65536
+
 typedef struct pylnk_file_object_io_handle pylnk_file_object_io_handle_t;
 
 struct pylnk_file_object_io_handle
@@ -44,6 +48,23 @@ struct pylnk_file_object_io_handle
 	/* The access flags
 	 */
 	int access_flags;
+
+	/* The current offset
+	 * Contains -1 if the current offset has not been determined
+	 */
+	off64_t current_offset;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *read_buffer;
+
+	/* The offset of the data in the read-ahead buffer
+	 */
+	off64_t read_buffer_offset;
+
+	/* The size of the data in the read-ahead buffer
+	 */
+	size_t read_buffer_data_size;
 };
 
 int pylnk_file_object_io_handle_initialize(
@@ -0,0 +1,1089 @@
+/*
+ * File record functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "pylnk_datetime.h"
+#include "pylnk_file_record.h"
+#include "pylnk_guid.h"
+#include "pylnk_libcerror.h"
+#include "pylnk_liblnk.h"
+#include "pylnk_python.h"
+#include "pylnk_string.h"
+
+/* The string identifiers of the strings in a file record
+ */
+const int pylnk_file_record_string_identifiers[ PYLNK_FILE_RECORD_NUMBER_OF_STRINGS ] = {
+	LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL,
+	LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+	LIBLNK_STRING_IDENTIFIER_NETWORK_PATH,
+	LIBLNK_STRING_IDENTIFIER_DESCRIPTION,
+	LIBLNK_STRING_IDENTIFIER_RELATIVE_PATH,
+	LIBLNK_STRING_IDENTIFIER_WORKING_DIRECTORY,
+	LIBLNK_STRING_IDENTIFIER_COMMAND_LINE_ARGUMENTS,
+	LIBLNK_STRING_IDENTIFIER_ICON_LOCATION,
+	LIBLNK_STRING_IDENTIFIER_ENVIRONMENT_VARIABLES_LOCATION,
+	LIBLNK_STRING_IDENTIFIER_MACHINE_IDENTIFIER };
+
+/* The dictionary keys of the strings in a file record
+ */
+const char *pylnk_file_record_string_keys[ PYLNK_FILE_RECORD_NUMBER_OF_STRINGS ] = {
+	"volume_label",
+	"local_path",
+	"network_path",
+	"description",
+	"relative_path",
+	"working_directory",
+	"command_line_arguments",
+	"icon_location",
+	"environment_variables_location",
+	"machine_identifier" };
+
+/* Value to indicate the strings in a file record are paths
+ * Paths can contain invalid UTF-8 sequences and are converted with RFC 2279 support
+ */
+const int pylnk_file_record_string_is_path[ PYLNK_FILE_RECORD_NUMBER_OF_STRINGS ] = {
+	0, 1, 1, 0, 1, 1, 1, 1, 1, 0 };
+
+/* The dictionary keys of the file times in a file record
+ */
+const char *pylnk_file_record_file_time_keys[ 3 ] = {
+	"file_creation_time",
+	"file_modification_time",
+	"file_access_time" };
+
+/* The dictionary keys of the identifiers in a file record
+ */
+const char *pylnk_file_record_identifier_keys[ PYLNK_FILE_RECORD_NUMBER_OF_IDENTIFIERS ] = {
+	"droid_volume_identifier",
+	"droid_file_identifier",
+	"birth_droid_volume_identifier",
+	"birth_droid_file_identifier" };
+
+/* Creates a file record
+ * Make sure the value file_record is referencing, is set to NULL
+ * This function does not use the Python API and can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pylnk_file_record_initialize(
+     pylnk_file_record_t **file_record,
+     libcerror_error_t **error )
+{
+	static char *function = "pylnk_file_record_initialize";
+
+	if( file_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*file_record = memory_allocate_structure(
+	                pylnk_file_record_t );
+
+	if( *file_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file record.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_record,
+	     0,
+	     sizeof( pylnk_file_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file_record != NULL )
+	{
+		memory_free(
+		 *file_record );
+
+		*file_record = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file record
+ * This function does not use the Python API and can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pylnk_file_record_free(
+     pylnk_file_record_t **file_record,
+     libcerror_error_t **error )
+{
+	static char *function = "pylnk_file_record_free";
+	int string_index      = 0;
+
+	if( file_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_record != NULL )
+	{
+		for( string_index = 0;
+		     string_index < PYLNK_FILE_RECORD_NUMBER_OF_STRINGS;
+		     string_index++ )
+		{
+			if( ( *file_record )->utf8_strings[ string_index ] != NULL )
+			{
+				memory_free(
+				 ( *file_record )->utf8_strings[ string_index ] );
+			}
+		}
+		if( ( *file_record )->link_target_identifier_data != NULL )
+		{
+			memory_free(
+			 ( *file_record )->link_target_identifier_data );
+		}
+		memory_free(
+		 *file_record );
+
+		*file_record = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the file record values from a file
+ * The file record is expected to be newly created
+ * This function does not use the Python API and can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pylnk_file_record_read_file(
+     pylnk_file_record_t *file_record,
+     liblnk_file_t *file,
+     libcerror_error_t **error )
+{
+	uint8_t string_buffer[ PYLNK_FILE_RECORD_STRING_BUFFER_SIZE ];
+
+	int (*get_file_time[ 3 ])(
+	       liblnk_file_t *file,
+	       uint64_t *filetime,
+	       liblnk_error_t **error ) = {
+		&liblnk_file_get_file_creation_time,
+		&liblnk_file_get_file_modification_time,
+		&liblnk_file_get_file_access_time };
+
+	int (*get_identifier[ PYLNK_FILE_RECORD_NUMBER_OF_IDENTIFIERS ])(
+	       liblnk_file_t *file,
+	       uint8_t *guid_data,
+	       size_t guid_data_size,
+	       liblnk_error_t **error ) = {
+		&liblnk_file_get_droid_volume_identifier,
+		&liblnk_file_get_droid_file_identifier,
+		&liblnk_file_get_birth_droid_volume_identifier,
+		&liblnk_file_get_birth_droid_file_identifier };
+
+	static char *function   = "pylnk_file_record_read_file";
+	size_t data_size        = 0;
+	size_t utf8_string_size = 0;
+	int result              = 0;
+	int value_index         = 0;
+
+	if( file_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file record.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_file_get_data_flags(
+	     file,
+	     &( file_record->data_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data flags.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		result = get_file_time[ value_index ](
+		          file,
+		          &( file_record->file_times[ value_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve %s.",
+			 function,
+			 pylnk_file_record_file_time_keys[ value_index ] );
+
+			return( -1 );
+		}
+		file_record->has_file_times[ value_index ] = result;
+	}
+	if( liblnk_file_get_file_size(
+	     file,
+	     &( file_record->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_file_get_icon_index(
+	     file,
+	     &( file_record->icon_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve icon index.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_file_get_show_window_value(
+	     file,
+	     &( file_record->show_window_value ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve show window value.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_file_get_hot_key_value(
+	     file,
+	     &( file_record->hot_key_value ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hot key value.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_file_get_file_attribute_flags(
+	     file,
+	     &( file_record->file_attribute_flags ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file attribute flags.",
+		 function );
+
+		return( -1 );
+	}
+	result = liblnk_file_get_drive_type(
+	          file,
+	          &( file_record->drive_type ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve drive type.",
+		 function );
+
+		return( -1 );
+	}
+	file_record->has_drive_type = result;
+
+	result = liblnk_file_get_drive_serial_number(
+	          file,
+	          &( file_record->drive_serial_number ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve drive serial number.",
+		 function );
+
+		return( -1 );
+	}
+	file_record->has_drive_serial_number = result;
+
+	for( value_index = 0;
+	     value_index < PYLNK_FILE_RECORD_NUMBER_OF_STRINGS;
+	     value_index++ )
+	{
+		/* Most strings fit in the string buffer and are retrieved with a single call
+		 */
+		result = liblnk_file_get_utf8_string(
+		          file,
+		          pylnk_file_record_string_identifiers[ value_index ],
+		          string_buffer,
+		          PYLNK_FILE_RECORD_STRING_BUFFER_SIZE,
+		          &utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve %s.",
+			 function,
+			 pylnk_file_record_string_keys[ value_index ] );
+
+			return( -1 );
+		}
+		else if( ( result == 0 )
+		      || ( utf8_string_size == 0 ) )
+		{
+			continue;
+		}
+		if( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid %s size value exceeds maximum allocation size.",
+			 function,
+			 pylnk_file_record_string_keys[ value_index ] );
+
+			return( -1 );
+		}
+		file_record->utf8_strings[ value_index ] = (uint8_t *) memory_allocate(
+		                                                        sizeof( uint8_t ) * utf8_string_size );
+
+		if( file_record->utf8_strings[ value_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create %s.",
+			 function,
+			 pylnk_file_record_string_keys[ value_index ] );
+
+			return( -1 );
+		}
+		file_record->utf8_string_sizes[ value_index ] = utf8_string_size;
+
+		if( utf8_string_size <= PYLNK_FILE_RECORD_STRING_BUFFER_SIZE )
+		{
+			if( memory_copy(
+			     file_record->utf8_strings[ value_index ],
+			     string_buffer,
+			     utf8_string_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy %s.",
+				 function,
+				 pylnk_file_record_string_keys[ value_index ] );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			result = liblnk_file_get_utf8_string(
+			          file,
+			          pylnk_file_record_string_identifiers[ value_index ],
+			          file_record->utf8_strings[ value_index ],
+			          utf8_string_size,
+			          &utf8_string_size,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve %s.",
+				 function,
+				 pylnk_file_record_string_keys[ value_index ] );
+
+				return( -1 );
+			}
+		}
+	}
+	result = liblnk_file_get_link_target_identifier_data_size(
+	          file,
+	          &data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve link target identifier data size.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( data_size > 0 ) )
+	{
+		if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid link target identifier data size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		file_record->link_target_identifier_data = (uint8_t *) memory_allocate(
+		                                                        sizeof( uint8_t ) * data_size );
+
+		if( file_record->link_target_identifier_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create link target identifier data.",
+			 function );
+
+			return( -1 );
+		}
+		file_record->link_target_identifier_data_size = data_size;
+
+		if( liblnk_file_copy_link_target_identifier_data(
+		     file,
+		     file_record->link_target_identifier_data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy link target identifier data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	for( value_index = 0;
+	     value_index < PYLNK_FILE_RECORD_NUMBER_OF_IDENTIFIERS;
+	     value_index++ )
+	{
+		result = get_identifier[ value_index ](
+		          file,
+		          file_record->identifiers[ value_index ],
+		          16,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve %s.",
+			 function,
+			 pylnk_file_record_identifier_keys[ value_index ] );
+
+			return( -1 );
+		}
+		file_record->has_identifiers[ value_index ] = result;
+	}
+	if( liblnk_file_get_number_of_data_blocks(
+	     file,
+	     &( file_record->number_of_data_blocks ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data blocks.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens a file and reads the file record values from it
+ * This function does not use the Python API and can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pylnk_file_record_read_filename(
+     pylnk_file_record_t *file_record,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	liblnk_file_t *file   = NULL;
+	static char *function = "pylnk_file_record_read_filename";
+
+	if( liblnk_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_file_open(
+	     file,
+	     filename,
+	     LIBLNK_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( pylnk_file_record_read_file(
+	     file_record,
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file record.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+/* Opens a file and reads the file record values from it
+ * This function does not use the Python API and can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pylnk_file_record_read_filename_wide(
+     pylnk_file_record_t *file_record,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	liblnk_file_t *file   = NULL;
+	static char *function = "pylnk_file_record_read_filename_wide";
+
+	if( liblnk_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_file_open_wide(
+	     file,
+	     filename,
+	     LIBLNK_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( pylnk_file_record_read_file(
+	     file_record,
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file record.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+/* Sets a dictionary item
+ * The reference of the value object is stolen
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pylnk_file_record_set_dict_item(
+     PyObject *dict_object,
+     const char *key,
+     PyObject *value_object )
+{
+	int result = 0;
+
+	if( value_object == NULL )
+	{
+		return( -1 );
+	}
+	result = PyDict_SetItemString(
+	          dict_object,
+	          key,
+	          value_object );
+
+	Py_DecRef(
+	 value_object );
+
+	if( result != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a new dictionary object from the file record values
+ * The dictionary keys are the names of the corresponding file properties
+ * Make sure to hold the GIL state before calling this function
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pylnk_file_record_new_dict(
+           pylnk_file_record_t *file_record )
+{
+	PyObject *dict_object  = NULL;
+	PyObject *value_object = NULL;
+	static char *function  = "pylnk_file_record_new_dict";
+	int value_index        = 0;
+
+	if( file_record == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file record.",
+		 function );
+
+		return( NULL );
+	}
+	dict_object = PyDict_New();
+
+	if( dict_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	value_object = PyLong_FromUnsignedLong(
+	                (unsigned long) file_record->data_flags );
+
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "data_flags",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < 3;
+	     value_index++ )
+	{
+		if( file_record->has_file_times[ value_index ] != 0 )
+		{
+			value_object = pylnk_datetime_new_from_filetime(
+			                file_record->file_times[ value_index ] );
+		}
+		else
+		{
+			Py_IncRef(
+			 Py_None );
+
+			value_object = Py_None;
+		}
+		if( pylnk_file_record_set_dict_item(
+		     dict_object,
+		     pylnk_file_record_file_time_keys[ value_index ],
+		     value_object ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	value_object = PyLong_FromUnsignedLong(
+	                (unsigned long) file_record->file_size );
+
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "file_size",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	value_object = PyLong_FromUnsignedLong(
+	                (unsigned long) file_record->icon_index );
+
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "icon_index",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	value_object = PyLong_FromUnsignedLong(
+	                (unsigned long) file_record->show_window_value );
+
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "show_window_value",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	value_object = PyLong_FromLong(
+	                (long) file_record->hot_key_value );
+
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "hot_key_value",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	value_object = PyLong_FromUnsignedLong(
+	                (unsigned long) file_record->file_attribute_flags );
+
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "file_attribute_flags",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	if( file_record->has_drive_type != 0 )
+	{
+		value_object = PyLong_FromUnsignedLong(
+		                (unsigned long) file_record->drive_type );
+	}
+	else
+	{
+		Py_IncRef(
+		 Py_None );
+
+		value_object = Py_None;
+	}
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "drive_type",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	if( file_record->has_drive_serial_number != 0 )
+	{
+		value_object = PyLong_FromUnsignedLong(
+		                (unsigned long) file_record->drive_serial_number );
+	}
+	else
+	{
+		Py_IncRef(
+		 Py_None );
+
+		value_object = Py_None;
+	}
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "drive_serial_number",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < PYLNK_FILE_RECORD_NUMBER_OF_STRINGS;
+	     value_index++ )
+	{
+		if( file_record->utf8_strings[ value_index ] == NULL )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			value_object = Py_None;
+		}
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 3
+		else if( pylnk_file_record_string_is_path[ value_index ] != 0 )
+		{
+			value_object = pylnk_string_new_from_utf8_rfc2279(
+			                file_record->utf8_strings[ value_index ],
+			                file_record->utf8_string_sizes[ value_index ] );
+		}
+#endif
+		else
+		{
+			/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+			 * the end of string character is part of the string
+			 */
+			value_object = PyUnicode_DecodeUTF8(
+			                (char *) file_record->utf8_strings[ value_index ],
+			                (Py_ssize_t) file_record->utf8_string_sizes[ value_index ] - 1,
+			                NULL );
+		}
+		if( pylnk_file_record_set_dict_item(
+		     dict_object,
+		     pylnk_file_record_string_keys[ value_index ],
+		     value_object ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( file_record->link_target_identifier_data != NULL )
+	{
+#if PY_MAJOR_VERSION >= 3
+		value_object = PyBytes_FromStringAndSize(
+		                (char *) file_record->link_target_identifier_data,
+		                (Py_ssize_t) file_record->link_target_identifier_data_size );
+#else
+		value_object = PyString_FromStringAndSize(
+		                (char *) file_record->link_target_identifier_data,
+		                (Py_ssize_t) file_record->link_target_identifier_data_size );
+#endif
+	}
+	else
+	{
+		Py_IncRef(
+		 Py_None );
+
+		value_object = Py_None;
+	}
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "link_target_identifier_data",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < PYLNK_FILE_RECORD_NUMBER_OF_IDENTIFIERS;
+	     value_index++ )
+	{
+		if( file_record->has_identifiers[ value_index ] != 0 )
+		{
+			value_object = pylnk_string_new_from_guid(
+			                file_record->identifiers[ value_index ],
+			                16 );
+		}
+		else
+		{
+			Py_IncRef(
+			 Py_None );
+
+			value_object = Py_None;
+		}
+		if( pylnk_file_record_set_dict_item(
+		     dict_object,
+		     pylnk_file_record_identifier_keys[ value_index ],
+		     value_object ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	value_object = PyLong_FromLong(
+	                (long) file_record->number_of_data_blocks );
+
+	if( pylnk_file_record_set_dict_item(
+	     dict_object,
+	     "number_of_data_blocks",
+	     value_object ) != 1 )
+	{
+		goto on_error;
+	}
+	return( dict_object );
+
+on_error:
+	if( PyErr_Occurred() == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to create dictionary values.",
+		 function );
+	}
+	if( dict_object != NULL )
+	{
+		Py_DecRef(
+		 dict_object );
+	}
+	return( NULL );
+}
+
@@ -0,0 +1,176 @@
+/*
+ * File record functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYLNK_FILE_RECORD_H )
+#define _PYLNK_FILE_RECORD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pylnk_libcerror.h"
+#include "pylnk_liblnk.h"
+#include "pylnk_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of strings in a file record
+ */
+#define PYLNK_FILE_RECORD_NUMBER_OF_STRINGS		10
+
+/* The number of identifiers in a file record
+ */
+#define PYLNK_FILE_RECORD_NUMBER_OF_IDENTIFIERS		4
+
+/* The size of the buffer used to retrieve strings
+ */
+#define PYLNK_FILE_RECORD_STRING_BUFFER_SIZE		512
+
+typedef struct pylnk_file_record pylnk_file_record_t;
+
+/* The file record contains the values of a file
+ * The values are retrieved without using the Python API, so that they
+ * can be retrieved while the GIL is released
+ */
+struct pylnk_file_record
+{
+	/* The data flags
+	 */
+	uint32_t data_flags;
+
+	/* The file creation, modification and access times
+	 * Contains a FILETIME value or 0 if not available
+	 */
+	uint64_t file_times[ 3 ];
+
+	/* Value to indicate which file times are available
+	 */
+	int has_file_times[ 3 ];
+
+	/* The file size
+	 */
+	uint32_t file_size;
+
+	/* The icon index
+	 */
+	uint32_t icon_index;
+
+	/* The show window value
+	 */
+	uint32_t show_window_value;
+
+	/* The hot key value
+	 */
+	uint16_t hot_key_value;
+
+	/* The file attribute flags
+	 */
+	uint32_t file_attribute_flags;
+
+	/* The drive type
+	 */
+	uint32_t drive_type;
+
+	/* Value to indicate the drive type is available
+	 */
+	int has_drive_type;
+
+	/* The drive serial number
+	 */
+	uint32_t drive_serial_number;
+
+	/* Value to indicate the drive serial number is available
+	 */
+	int has_drive_serial_number;
+
+	/* The UTF-8 encoded strings
+	 * Contains NULL if a string is not available
+	 */
+	uint8_t *utf8_strings[ PYLNK_FILE_RECORD_NUMBER_OF_STRINGS ];
+
+	/* The UTF-8 encoded string sizes, including the end-of-string character
+	 */
+	size_t utf8_string_sizes[ PYLNK_FILE_RECORD_NUMBER_OF_STRINGS ];
+
+	/* The link target identifier data
+	 */
+	uint8_t *link_target_identifier_data;
+
+	/* The link target identifier data size
+	 */
+	size_t link_target_identifier_data_size;
+
+	/* The droid and birth droid identifiers
+	 * Contains GUIDs stored in little-endian
+	 */
+	uint8_t identifiers[ PYLNK_FILE_RECORD_NUMBER_OF_IDENTIFIERS ][ 16 ];
+
+	/* Value to indicate which identifiers are available
+	 */
+	int has_identifiers[ PYLNK_FILE_RECORD_NUMBER_OF_IDENTIFIERS ];
+
+	/* The number of data blocks
+	 */
+	int number_of_data_blocks;
+};
+
+int pylnk_file_record_initialize(
+     pylnk_file_record_t **file_record,
+     libcerror_error_t **error );
+
+int pylnk_file_record_free(
+     pylnk_file_record_t **file_record,
+     libcerror_error_t **error );
+
+int pylnk_file_record_read_file(
+     pylnk_file_record_t *file_record,
+     liblnk_file_t *file,
+     libcerror_error_t **error );
+
+int pylnk_file_record_read_filename(
+     pylnk_file_record_t *file_record,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+
+int pylnk_file_record_read_filename_wide(
+     pylnk_file_record_t *file_record,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+int pylnk_file_record_set_dict_item(
+     PyObject *dict_object,
+     const char *key,
+     PyObject *value_object );
+
+PyObject *pylnk_file_record_new_dict(
+           pylnk_file_record_t *file_record );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYLNK_FILE_RECORD_H ) */
+
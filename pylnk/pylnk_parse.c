@@ -0,0 +1,691 @@
+/*
+ * Parse functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "pylnk_error.h"
+#include "pylnk_file_record.h"
+#include "pylnk_libcerror.h"
+#include "pylnk_parse.h"
+#include "pylnk_python.h"
+#include "pylnk_unused.h"
+
+/* Creates the parse sources from a sequence of paths
+ * Make sure the value sources is referencing, is set to NULL
+ * Make sure to hold the GIL state before calling this function
+ * Returns 1 if successful or -1 on error
+ */
+int pylnk_parse_sources_initialize(
+     pylnk_parse_source_t **sources,
+     PyObject *sequence_object,
+     Py_ssize_t number_of_sources )
+{
+	PyObject *string_object = NULL;
+	static char *function   = "pylnk_parse_sources_initialize";
+	Py_ssize_t source_index = 0;
+	int result              = 0;
+
+	if( sources == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid sources.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sources != NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid sources value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sources <= 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of sources value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*sources = (pylnk_parse_source_t *) PyMem_Calloc(
+	                                     (size_t) number_of_sources,
+	                                     sizeof( pylnk_parse_source_t ) );
+
+	if( *sources == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create sources.",
+		 function );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		string_object = PySequence_Fast_GET_ITEM(
+		                 sequence_object,
+		                 source_index );
+
+		PyErr_Clear();
+
+		result = PyObject_IsInstance(
+		          string_object,
+		          (PyObject *) &PyUnicode_Type );
+
+		if( result == -1 )
+		{
+			pylnk_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to determine if string object is of type Unicode.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			( *sources )[ source_index ].filename_wide = (wchar_t *) PyUnicode_AsWideCharString(
+			                                                          string_object,
+			                                                          NULL );
+
+			if( ( *sources )[ source_index ].filename_wide == NULL )
+			{
+				pylnk_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to convert Unicode string to wide character string.",
+				 function );
+
+				goto on_error;
+			}
+#else
+			( *sources )[ source_index ].filename_object = PyUnicode_AsUTF8String(
+			                                                string_object );
+
+			if( ( *sources )[ source_index ].filename_object == NULL )
+			{
+				pylnk_error_fetch_and_raise(
+				 PyExc_RuntimeError,
+				 "%s: unable to convert Unicode string to UTF-8.",
+				 function );
+
+				goto on_error;
+			}
+			( *sources )[ source_index ].filename = PyBytes_AsString(
+			                                         ( *sources )[ source_index ].filename_object );
+#endif
+			continue;
+		}
+		PyErr_Clear();
+
+		result = PyObject_IsInstance(
+		          string_object,
+		          (PyObject *) &PyBytes_Type );
+
+		if( result == -1 )
+		{
+			pylnk_error_fetch_and_raise(
+			 PyExc_RuntimeError,
+			 "%s: unable to determine if string object is of type string.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			PyErr_Format(
+			 PyExc_TypeError,
+			 "%s: unsupported string object type of path: %zd.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+		Py_IncRef(
+		 string_object );
+
+		( *sources )[ source_index ].filename_object = string_object;
+
+		( *sources )[ source_index ].filename = PyBytes_AsString(
+		                                         string_object );
+	}
+	return( 1 );
+
+on_error:
+	if( *sources != NULL )
+	{
+		pylnk_parse_sources_free(
+		 sources,
+		 number_of_sources );
+	}
+	return( -1 );
+}
+
+/* Frees the parse sources
+ * Make sure to hold the GIL state before calling this function
+ */
+void pylnk_parse_sources_free(
+      pylnk_parse_source_t **sources,
+      Py_ssize_t number_of_sources )
+{
+	Py_ssize_t source_index = 0;
+
+	if( sources == NULL )
+	{
+		return;
+	}
+	if( *sources != NULL )
+	{
+		for( source_index = 0;
+		     source_index < number_of_sources;
+		     source_index++ )
+		{
+			if( ( *sources )[ source_index ].filename_object != NULL )
+			{
+				Py_DecRef(
+				 ( *sources )[ source_index ].filename_object );
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			if( ( *sources )[ source_index ].filename_wide != NULL )
+			{
+				PyMem_Free(
+				 ( *sources )[ source_index ].filename_wide );
+			}
+#endif
+			if( ( *sources )[ source_index ].file_record != NULL )
+			{
+				pylnk_file_record_free(
+				 &( ( *sources )[ source_index ].file_record ),
+				 NULL );
+			}
+		}
+		PyMem_Free(
+		 *sources );
+
+		*sources = NULL;
+	}
+}
+
+/* Opens the file of a parse source and reads its file record
+ * This function does not use the Python API and can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pylnk_parse_source_read(
+     pylnk_parse_source_t *source,
+     libcerror_error_t **error )
+{
+	static char *function = "pylnk_parse_source_read";
+	int result            = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	if( pylnk_file_record_initialize(
+	     &( source->file_record ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file record.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( source->filename_wide != NULL )
+	{
+		result = pylnk_file_record_read_filename_wide(
+		          source->file_record,
+		          source->filename_wide,
+		          error );
+	}
+	else
+#endif
+	{
+		result = pylnk_file_record_read_filename(
+		          source->file_record,
+		          source->filename,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( source->file_record != NULL )
+	{
+		pylnk_file_record_free(
+		 &( source->file_record ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the file record of a file opened by the batch
+ * This function is called by the worker thread that opened the file, concurrently
+ * with the other workers. It does not use the Python API and is called without
+ * holding the GIL
+ * Returns 1 to continue processing the batch
+ */
+int pylnk_parse_batch_entry_function(
+     int entry_index,
+     liblnk_file_t *file,
+     pylnk_parse_source_t *sources )
+{
+	libcerror_error_t *error = NULL;
+
+	if( ( sources == NULL )
+	 || ( entry_index < 0 ) )
+	{
+		return( -1 );
+	}
+	if( pylnk_file_record_initialize(
+	     &( sources[ entry_index ].file_record ),
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		return( 1 );
+	}
+	if( pylnk_file_record_read_file(
+	     sources[ entry_index ].file_record,
+	     file,
+	     &error ) != 1 )
+	{
+		libcerror_error_free(
+		 &error );
+
+		pylnk_file_record_free(
+		 &( sources[ entry_index ].file_record ),
+		 NULL );
+	}
+	return( 1 );
+}
+
+/* Opens the files of the parse sources and reads their file records using a liblnk batch
+ * The files are opened and parsed by the worker threads of the batch
+ * This function does not use the Python API and can be called without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pylnk_parse_sources_read_batch(
+     pylnk_parse_source_t *sources,
+     int number_of_sources,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	liblnk_batch_t *batch = NULL;
+	static char *function = "pylnk_parse_sources_read_batch";
+	int result            = 0;
+	int source_index      = 0;
+
+	if( sources == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sources.",
+		 function );
+
+		return( -1 );
+	}
+	if( liblnk_batch_initialize(
+	     &batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_batch_set_number_of_threads(
+	     batch,
+	     number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads.",
+		 function );
+
+		goto on_error;
+	}
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		if( sources[ source_index ].filename_wide != NULL )
+		{
+			result = liblnk_batch_append_filename_wide(
+			          batch,
+			          sources[ source_index ].filename_wide,
+			          error );
+		}
+		else
+#endif
+		{
+			result = liblnk_batch_append_filename(
+			          batch,
+			          sources[ source_index ].filename,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source: %d to batch.",
+			 function,
+			 source_index );
+
+			goto on_error;
+		}
+	}
+	/* The file records are read by the worker threads that opened the files
+	 */
+	if( liblnk_batch_set_entry_function(
+	     batch,
+	     (int (*)(int, liblnk_file_t *, void *)) &pylnk_parse_batch_entry_function,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry function.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file records are stored by entry index by the entry function,
+	 * hence no callback function is needed
+	 */
+	if( liblnk_batch_process(
+	     batch,
+	     LIBLNK_OPEN_READ,
+	     LIBLNK_BATCH_RESULT_ORDER_COMPLETION,
+	     NULL,
+	     (void *) sources,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( liblnk_batch_free(
+	     &batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free batch.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( batch != NULL )
+	{
+		liblnk_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Parses files and retrieves their values
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pylnk_parse_many(
+           PyObject *self PYLNK_ATTRIBUTE_UNUSED,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *list_object         = NULL;
+	PyObject *paths_object        = NULL;
+	PyObject *sequence_object     = NULL;
+	PyObject *value_object        = NULL;
+	libcerror_error_t *error      = NULL;
+	pylnk_parse_source_t *sources = NULL;
+	static char *function         = "pylnk_parse_many";
+	static char *keyword_list[]   = { "paths", "workers", NULL };
+	Py_ssize_t number_of_sources  = 0;
+	Py_ssize_t source_index       = 0;
+	int number_of_workers         = 1;
+	int result                    = 0;
+
+	PYLNK_UNREFERENCED_PARAMETER( self )
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O|i",
+	     keyword_list,
+	     &paths_object,
+	     &number_of_workers ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > PYLNK_PARSE_MAXIMUM_NUMBER_OF_WORKERS ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid workers value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	sequence_object = PySequence_Fast(
+	                   paths_object,
+	                   "paths must be a sequence" );
+
+	if( sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	number_of_sources = PySequence_Fast_GET_SIZE(
+	                     sequence_object );
+
+	if( number_of_sources > (Py_ssize_t) INT_MAX )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of paths value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+
+	list_object = PyList_New(
+	               number_of_sources );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sources == 0 )
+	{
+		Py_DecRef(
+		 sequence_object );
+
+		return( list_object );
+	}
+	/* The paths are converted before the GIL is released
+	 */
+	if( pylnk_parse_sources_initialize(
+	     &sources,
+	     sequence_object,
+	     number_of_sources ) != 1 )
+	{
+		goto on_error;
+	}
+	if( number_of_workers > 1 )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = pylnk_parse_sources_read_batch(
+		          sources,
+		          (int) number_of_sources,
+		          number_of_workers,
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pylnk_error_raise(
+			 error,
+			 PyExc_IOError,
+			 "%s: unable to parse files.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		for( source_index = 0;
+		     source_index < number_of_sources;
+		     source_index++ )
+		{
+			/* A file that cannot be opened or read is represented by None
+			 */
+			if( pylnk_parse_source_read(
+			     &( sources[ source_index ] ),
+			     &error ) != 1 )
+			{
+				libcerror_error_free(
+				 &error );
+			}
+		}
+		Py_END_ALLOW_THREADS
+	}
+
+	for( source_index = 0;
+	     source_index < number_of_sources;
+	     source_index++ )
+	{
+		if( sources[ source_index ].file_record == NULL )
+		{
+			Py_IncRef(
+			 Py_None );
+
+			value_object = Py_None;
+		}
+		else
+		{
+			value_object = pylnk_file_record_new_dict(
+			                sources[ source_index ].file_record );
+
+			if( value_object == NULL )
+			{
+				goto on_error;
+			}
+		}
+		/* PyList_SET_ITEM steals the reference of the value object
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 source_index,
+		 value_object );
+	}
+	pylnk_parse_sources_free(
+	 &sources,
+	 number_of_sources );
+
+	Py_DecRef(
+	 sequence_object );
+
+	return( list_object );
+
+on_error:
+	if( sources != NULL )
+	{
+		pylnk_parse_sources_free(
+		 &sources,
+		 number_of_sources );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	return( NULL );
+}
+
@@ -0,0 +1,100 @@
+/*
+ * Parse functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYLNK_PARSE_H )
+#define _PYLNK_PARSE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pylnk_file_record.h"
+#include "pylnk_libcerror.h"
+#include "pylnk_liblnk.h"
+#include "pylnk_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of workers (threads) used to parse files
+ */
+#define PYLNK_PARSE_MAXIMUM_NUMBER_OF_WORKERS	64
+
+typedef struct pylnk_parse_source pylnk_parse_source_t;
+
+struct pylnk_parse_source
+{
+	/* The narrow filename object
+	 */
+	PyObject *filename_object;
+
+	/* The narrow filename
+	 * References the data of the filename object
+	 */
+	const char *filename;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The wide filename
+	 */
+	wchar_t *filename_wide;
+#endif
+
+	/* The file record
+	 * Contains NULL if the file could not be opened or read
+	 */
+	pylnk_file_record_t *file_record;
+};
+
+int pylnk_parse_sources_initialize(
+     pylnk_parse_source_t **sources,
+     PyObject *sequence_object,
+     Py_ssize_t number_of_sources );
+
+void pylnk_parse_sources_free(
+      pylnk_parse_source_t **sources,
+      Py_ssize_t number_of_sources );
+
+int pylnk_parse_source_read(
+     pylnk_parse_source_t *source,
+     libcerror_error_t **error );
+
+int pylnk_parse_batch_entry_function(
+     int entry_index,
+     liblnk_file_t *file,
+     pylnk_parse_source_t *sources );
+
+int pylnk_parse_sources_read_batch(
+     pylnk_parse_source_t *sources,
+     int number_of_sources,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+PyObject *pylnk_parse_many(
+           PyObject *self,
+           PyObject *arguments,
+           PyObject *keywords );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYLNK_PARSE_H ) */
+
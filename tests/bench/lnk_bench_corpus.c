@@ -0,0 +1,967 @@
+/*
+ * Synthetic shortcut corpus functions for benchmarking
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "lnk_bench_corpus.h"
+#include "lnk_test_liblnk.h"
+
+/* The path segment that is repeated to reach the requested path length
+ */
+#define LNK_BENCH_CORPUS_PATH_SEGMENT	"Project Documents\\"
+
+typedef struct lnk_bench_corpus_writer lnk_bench_corpus_writer_t;
+
+struct lnk_bench_corpus_writer
+{
+	/* The buffer, NULL when only the size is determined
+	 */
+	uint8_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The current offset
+	 */
+	size_t offset;
+};
+
+/* The class identifier of the shell link
+ */
+static uint8_t lnk_bench_corpus_class_identifier[ 16 ] = {
+	0x01, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46 };
+
+/* The My Computer root folder shell item
+ */
+static uint8_t lnk_bench_corpus_root_folder_shell_item[ 20 ] = {
+	0x14, 0x00, 0x1f, 0x50, 0xe0, 0x4f, 0xd0, 0x20, 0xea, 0x3a, 0x69, 0x10, 0xa2, 0xd8, 0x08, 0x00,
+	0x2b, 0x30, 0x30, 0x9d };
+
+/* The Documents known folder identifier
+ */
+static uint8_t lnk_bench_corpus_known_folder_identifier[ 16 ] = {
+	0xd0, 0x9a, 0xd3, 0xfd, 0x8f, 0x23, 0xaf, 0x46, 0xad, 0xb4, 0x6c, 0x85, 0x48, 0x03, 0x69, 0xc7 };
+
+/* The summary information property set format identifier
+ */
+static uint8_t lnk_bench_corpus_format_identifier[ 16 ] = {
+	0xe0, 0x85, 0x9f, 0xf2, 0xf9, 0x4f, 0x68, 0x10, 0xab, 0x91, 0x08, 0x00, 0x2b, 0x27, 0xb3, 0xd9 };
+
+/* Writes data
+ * The data is only stored if it fits in the buffer
+ */
+static void lnk_bench_corpus_writer_write_data(
+             lnk_bench_corpus_writer_t *writer,
+             const uint8_t *data,
+             size_t data_size )
+{
+	if( ( writer->buffer != NULL )
+	 && ( writer->offset <= writer->buffer_size )
+	 && ( data_size <= ( writer->buffer_size - writer->offset ) ) )
+	{
+		if( data != NULL )
+		{
+			memory_copy(
+			 &( writer->buffer[ writer->offset ] ),
+			 data,
+			 data_size );
+		}
+		else
+		{
+			memory_set(
+			 &( writer->buffer[ writer->offset ] ),
+			 0,
+			 data_size );
+		}
+	}
+	writer->offset += data_size;
+}
+
+/* Writes a 16-bit little-endian value
+ */
+static void lnk_bench_corpus_writer_write_uint16(
+             lnk_bench_corpus_writer_t *writer,
+             uint16_t value_16bit )
+{
+	uint8_t data[ 2 ];
+
+	byte_stream_copy_from_uint16_little_endian(
+	 data,
+	 value_16bit );
+
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 data,
+	 2 );
+}
+
+/* Writes a 32-bit little-endian value
+ */
+static void lnk_bench_corpus_writer_write_uint32(
+             lnk_bench_corpus_writer_t *writer,
+             uint32_t value_32bit )
+{
+	uint8_t data[ 4 ];
+
+	byte_stream_copy_from_uint32_little_endian(
+	 data,
+	 value_32bit );
+
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 data,
+	 4 );
+}
+
+/* Writes a 64-bit little-endian value
+ */
+static void lnk_bench_corpus_writer_write_uint64(
+             lnk_bench_corpus_writer_t *writer,
+             uint64_t value_64bit )
+{
+	uint8_t data[ 8 ];
+
+	byte_stream_copy_from_uint64_little_endian(
+	 data,
+	 value_64bit );
+
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 data,
+	 8 );
+}
+
+/* Overwrites a 32-bit little-endian value at a previously written offset
+ */
+static void lnk_bench_corpus_writer_set_uint32(
+             lnk_bench_corpus_writer_t *writer,
+             size_t offset,
+             uint32_t value_32bit )
+{
+	if( ( writer->buffer != NULL )
+	 && ( writer->buffer_size >= 4 )
+	 && ( offset <= ( writer->buffer_size - 4 ) ) )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( writer->buffer[ offset ] ),
+		 value_32bit );
+	}
+}
+
+/* Writes a path that starts with a prefix and is padded with path segments
+ * up to the number of characters
+ */
+static void lnk_bench_corpus_writer_write_path(
+             lnk_bench_corpus_writer_t *writer,
+             const char *prefix,
+             size_t number_of_characters,
+             int is_unicode,
+             int add_end_of_string )
+{
+	const char *segment    = LNK_BENCH_CORPUS_PATH_SEGMENT;
+	size_t character_index = 0;
+	size_t prefix_length   = 0;
+	size_t segment_length  = 0;
+	uint8_t character      = 0;
+
+	prefix_length  = narrow_string_length( prefix );
+	segment_length = narrow_string_length( segment );
+
+	for( character_index = 0;
+	     character_index < number_of_characters;
+	     character_index++ )
+	{
+		if( character_index < prefix_length )
+		{
+			character = (uint8_t) prefix[ character_index ];
+		}
+		else
+		{
+			character = (uint8_t) segment[ ( character_index - prefix_length ) % segment_length ];
+		}
+		if( is_unicode != 0 )
+		{
+			lnk_bench_corpus_writer_write_uint16(
+			 writer,
+			 (uint16_t) character );
+		}
+		else
+		{
+			lnk_bench_corpus_writer_write_data(
+			 writer,
+			 &character,
+			 1 );
+		}
+	}
+	if( add_end_of_string != 0 )
+	{
+		lnk_bench_corpus_writer_write_data(
+		 writer,
+		 NULL,
+		 ( is_unicode != 0 ) ? 2 : 1 );
+	}
+}
+
+/* Writes the location information
+ */
+static void lnk_bench_corpus_writer_write_location_information(
+             lnk_bench_corpus_writer_t *writer,
+             const lnk_bench_corpus_options_t *options )
+{
+	size_t header_offset = writer->offset;
+	size_t value_offset  = 0;
+	uint32_t header_size = 28;
+
+	if( options->is_unicode != 0 )
+	{
+		header_size = 36;
+	}
+	/* The offsets are filled in when the values are written
+	 */
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 0 );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 header_size );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 ( options->is_network_location != 0 ) ? 0x00000002UL : 0x00000001UL );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 NULL,
+	 (size_t) header_size - 12 );
+
+	if( options->is_network_location == 0 )
+	{
+		/* The volume information with an ASCII volume label
+		 */
+		lnk_bench_corpus_writer_set_uint32(
+		 writer,
+		 header_offset + 12,
+		 (uint32_t) ( writer->offset - header_offset ) );
+
+		lnk_bench_corpus_writer_write_uint32(
+		 writer,
+		 16 + 5 );
+		lnk_bench_corpus_writer_write_uint32(
+		 writer,
+		 3 );
+		lnk_bench_corpus_writer_write_uint32(
+		 writer,
+		 0x1c2b3a49UL );
+		lnk_bench_corpus_writer_write_uint32(
+		 writer,
+		 16 );
+		lnk_bench_corpus_writer_write_data(
+		 writer,
+		 (uint8_t *) "Data",
+		 5 );
+
+		lnk_bench_corpus_writer_set_uint32(
+		 writer,
+		 header_offset + 16,
+		 (uint32_t) ( writer->offset - header_offset ) );
+
+		lnk_bench_corpus_writer_write_path(
+		 writer,
+		 "C:\\",
+		 (size_t) options->path_length,
+		 0,
+		 1 );
+
+		lnk_bench_corpus_writer_set_uint32(
+		 writer,
+		 header_offset + 24,
+		 (uint32_t) ( writer->offset - header_offset ) );
+
+		lnk_bench_corpus_writer_write_path(
+		 writer,
+		 "",
+		 0,
+		 0,
+		 1 );
+
+		if( options->is_unicode != 0 )
+		{
+			lnk_bench_corpus_writer_set_uint32(
+			 writer,
+			 header_offset + 28,
+			 (uint32_t) ( writer->offset - header_offset ) );
+
+			lnk_bench_corpus_writer_write_path(
+			 writer,
+			 "C:\\",
+			 (size_t) options->path_length,
+			 1,
+			 1 );
+
+			lnk_bench_corpus_writer_set_uint32(
+			 writer,
+			 header_offset + 32,
+			 (uint32_t) ( writer->offset - header_offset ) );
+
+			lnk_bench_corpus_writer_write_path(
+			 writer,
+			 "",
+			 0,
+			 1,
+			 1 );
+		}
+	}
+	else
+	{
+		/* The network share information with an ASCII network share name
+		 */
+		lnk_bench_corpus_writer_set_uint32(
+		 writer,
+		 header_offset + 20,
+		 (uint32_t) ( writer->offset - header_offset ) );
+
+		value_offset = writer->offset;
+
+		lnk_bench_corpus_writer_write_uint32(
+		 writer,
+		 0 );
+		lnk_bench_corpus_writer_write_uint32(
+		 writer,
+		 0x00000002UL );
+		lnk_bench_corpus_writer_write_uint32(
+		 writer,
+		 20 );
+		lnk_bench_corpus_writer_write_uint32(
+		 writer,
+		 0 );
+		lnk_bench_corpus_writer_write_uint32(
+		 writer,
+		 0x00020000UL );
+		lnk_bench_corpus_writer_write_path(
+		 writer,
+		 "\\\\fileserver.example.com\\share",
+		 30,
+		 0,
+		 1 );
+
+		lnk_bench_corpus_writer_set_uint32(
+		 writer,
+		 value_offset,
+		 (uint32_t) ( writer->offset - value_offset ) );
+
+		lnk_bench_corpus_writer_set_uint32(
+		 writer,
+		 header_offset + 24,
+		 (uint32_t) ( writer->offset - header_offset ) );
+
+		lnk_bench_corpus_writer_write_path(
+		 writer,
+		 "Department\\",
+		 (size_t) options->path_length,
+		 0,
+		 1 );
+
+		if( options->is_unicode != 0 )
+		{
+			lnk_bench_corpus_writer_set_uint32(
+			 writer,
+			 header_offset + 32,
+			 (uint32_t) ( writer->offset - header_offset ) );
+
+			lnk_bench_corpus_writer_write_path(
+			 writer,
+			 "Department\\",
+			 (size_t) options->path_length,
+			 1,
+			 1 );
+		}
+	}
+	lnk_bench_corpus_writer_set_uint32(
+	 writer,
+	 header_offset,
+	 (uint32_t) ( writer->offset - header_offset ) );
+}
+
+/* Writes a data string
+ */
+static void lnk_bench_corpus_writer_write_data_string(
+             lnk_bench_corpus_writer_t *writer,
+             const lnk_bench_corpus_options_t *options,
+             const char *prefix )
+{
+	lnk_bench_corpus_writer_write_uint16(
+	 writer,
+	 (uint16_t) options->path_length );
+
+	lnk_bench_corpus_writer_write_path(
+	 writer,
+	 prefix,
+	 (size_t) options->path_length,
+	 options->is_unicode,
+	 0 );
+}
+
+/* Writes the extra data blocks
+ */
+static void lnk_bench_corpus_writer_write_extra_data_blocks(
+             lnk_bench_corpus_writer_t *writer )
+{
+	size_t value_offset = 0;
+
+	/* The environment variables location data block
+	 */
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 788 );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 LIBLNK_DATA_BLOCK_SIGNATURE_ENVIRONMENT_VARIABLES_LOCATION );
+
+	value_offset = writer->offset;
+
+	lnk_bench_corpus_writer_write_path(
+	 writer,
+	 "%USERPROFILE%\\",
+	 64,
+	 0,
+	 1 );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 NULL,
+	 260 - ( writer->offset - value_offset ) );
+
+	value_offset = writer->offset;
+
+	lnk_bench_corpus_writer_write_path(
+	 writer,
+	 "%USERPROFILE%\\",
+	 64,
+	 1,
+	 1 );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 NULL,
+	 520 - ( writer->offset - value_offset ) );
+
+	/* The distributed link tracker properties data block
+	 */
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 96 );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 LIBLNK_DATA_BLOCK_SIGNATURE_DISTRIBUTED_LINK_TRACKER_PROPERTIES );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 88 );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 0 );
+	lnk_bench_corpus_writer_write_path(
+	 writer,
+	 "workstation",
+	 11,
+	 0,
+	 1 );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 NULL,
+	 4 );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 lnk_bench_corpus_known_folder_identifier,
+	 16 );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 lnk_bench_corpus_root_folder_shell_item + 4,
+	 16 );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 lnk_bench_corpus_known_folder_identifier,
+	 16 );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 lnk_bench_corpus_root_folder_shell_item + 4,
+	 16 );
+
+	/* The special folder location data block
+	 */
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 16 );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 LIBLNK_DATA_BLOCK_SIGNATURE_SPECIAL_FOLDER_LOCATION );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 0x00000005UL );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 0 );
+
+	/* The known folder location data block
+	 */
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 28 );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 LIBLNK_DATA_BLOCK_SIGNATURE_KNOWN_FOLDER_LOCATION );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 lnk_bench_corpus_known_folder_identifier,
+	 16 );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 0 );
+}
+
+/* Writes the additional console properties and console codepage data blocks
+ */
+static void lnk_bench_corpus_writer_write_additional_data_blocks(
+             lnk_bench_corpus_writer_t *writer,
+             const lnk_bench_corpus_options_t *options )
+{
+	int data_block_index = 0;
+
+	for( data_block_index = 0;
+	     data_block_index < options->number_of_additional_data_blocks;
+	     data_block_index++ )
+	{
+		if( ( data_block_index % 2 ) == 0 )
+		{
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 204 );
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 LIBLNK_DATA_BLOCK_SIGNATURE_CONSOLE_PROPERTIES );
+			lnk_bench_corpus_writer_write_data(
+			 writer,
+			 NULL,
+			 196 );
+		}
+		else
+		{
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 12 );
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 LIBLNK_DATA_BLOCK_SIGNATURE_CONSOLE_CODEPAGE );
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 1252 );
+		}
+	}
+}
+
+/* Writes the metadata property store data block
+ * The values alternate between a 32-bit integer and an UTF-16 string
+ */
+static void lnk_bench_corpus_writer_write_property_store(
+             lnk_bench_corpus_writer_t *writer,
+             const lnk_bench_corpus_options_t *options )
+{
+	size_t data_block_offset = writer->offset;
+	size_t storage_offset    = 0;
+	int value_index          = 0;
+
+	/* The sizes are filled in when the values are written
+	 */
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 0 );
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 LIBLNK_DATA_BLOCK_SIGNATURE_METADATA_PROPERTY_STORE );
+
+	storage_offset = writer->offset;
+
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 0 );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 (uint8_t *) "1SPS",
+	 4 );
+	lnk_bench_corpus_writer_write_data(
+	 writer,
+	 lnk_bench_corpus_format_identifier,
+	 16 );
+
+	for( value_index = 0;
+	     value_index < options->number_of_property_values;
+	     value_index++ )
+	{
+		if( ( value_index % 2 ) == 0 )
+		{
+			/* VT_UI4
+			 */
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 17 );
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 (uint32_t) value_index + 2 );
+			lnk_bench_corpus_writer_write_data(
+			 writer,
+			 NULL,
+			 1 );
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 0x00000013UL );
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 (uint32_t) value_index );
+		}
+		else
+		{
+			/* VT_LPWSTR, the string data is padded to a multiple of 4 bytes
+			 */
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 69 );
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 (uint32_t) value_index + 2 );
+			lnk_bench_corpus_writer_write_data(
+			 writer,
+			 NULL,
+			 1 );
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 0x0000001fUL );
+			lnk_bench_corpus_writer_write_uint32(
+			 writer,
+			 25 );
+			lnk_bench_corpus_writer_write_path(
+			 writer,
+			 "Synthetic property value",
+			 24,
+			 1,
+			 1 );
+			lnk_bench_corpus_writer_write_data(
+			 writer,
+			 NULL,
+			 2 );
+		}
+	}
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 0 );
+
+	lnk_bench_corpus_writer_set_uint32(
+	 writer,
+	 storage_offset,
+	 (uint32_t) ( writer->offset - storage_offset ) );
+
+	lnk_bench_corpus_writer_write_uint32(
+	 writer,
+	 0 );
+
+	lnk_bench_corpus_writer_set_uint32(
+	 writer,
+	 data_block_offset,
+	 (uint32_t) ( writer->offset - data_block_offset ) );
+}
+
+/* Writes a synthetic shortcut
+ * If buffer is NULL only the size of the shortcut is determined
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_corpus_write_shortcut(
+     const lnk_bench_corpus_options_t *options,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *shortcut_size,
+     lnk_bench_corpus_layout_t *layout )
+{
+	lnk_bench_corpus_writer_t writer;
+
+	size_t data_offset   = 0;
+	uint32_t data_flags  = 0;
+	int shell_item_index = 0;
+
+	if( ( options == NULL )
+	 || ( shortcut_size == NULL ) )
+	{
+		return( -1 );
+	}
+	if( ( options->number_of_shell_items < 0 )
+	 || ( options->number_of_shell_items > 3000 )
+	 || ( options->path_length < 1 )
+	 || ( options->path_length > 32767 )
+	 || ( options->number_of_additional_data_blocks < 0 )
+	 || ( options->number_of_additional_data_blocks > 4096 )
+	 || ( options->number_of_property_values < 0 )
+	 || ( options->number_of_property_values > 4096 ) )
+	{
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		return( -1 );
+	}
+	writer.buffer      = buffer;
+	writer.buffer_size = buffer_size;
+	writer.offset      = 0;
+
+	data_flags = LIBLNK_DATA_FLAG_HAS_LOCATION_INFORMATION
+	           | LIBLNK_DATA_FLAG_HAS_DESCRIPTION_STRING
+	           | LIBLNK_DATA_FLAG_HAS_RELATIVE_PATH_STRING
+	           | LIBLNK_DATA_FLAG_HAS_WORKING_DIRECTORY_STRING
+	           | LIBLNK_DATA_FLAG_HAS_COMMAND_LINE_ARGUMENTS_STRING
+	           | LIBLNK_DATA_FLAG_HAS_ICON_LOCATION_STRING;
+
+	if( options->number_of_shell_items > 0 )
+	{
+		data_flags |= LIBLNK_DATA_FLAG_HAS_LINK_TARGET_IDENTIFIER;
+	}
+	if( options->is_unicode != 0 )
+	{
+		data_flags |= LIBLNK_DATA_FLAG_IS_UNICODE;
+	}
+	if( options->has_extra_data_blocks != 0 )
+	{
+		data_flags |= LIBLNK_DATA_FLAG_HAS_ENVIRONMENT_VARIABLES_LOCATION_BLOCK;
+	}
+	if( options->number_of_property_values > 0 )
+	{
+		data_flags |= LIBLNK_DATA_FLAG_HAS_METADATA_PROPERTY_STORE_DATA_BLOCK;
+	}
+	/* The file header
+	 */
+	lnk_bench_corpus_writer_write_uint32(
+	 &writer,
+	 76 );
+	lnk_bench_corpus_writer_write_data(
+	 &writer,
+	 lnk_bench_corpus_class_identifier,
+	 16 );
+	lnk_bench_corpus_writer_write_uint32(
+	 &writer,
+	 data_flags );
+	lnk_bench_corpus_writer_write_uint32(
+	 &writer,
+	 0x00000020UL );
+	lnk_bench_corpus_writer_write_uint64(
+	 &writer,
+	 0x01cb7db3fc938000ULL );
+	lnk_bench_corpus_writer_write_uint64(
+	 &writer,
+	 0x01cb7db3fc938000ULL );
+	lnk_bench_corpus_writer_write_uint64(
+	 &writer,
+	 0x01cb7db3fc938000ULL );
+	lnk_bench_corpus_writer_write_uint32(
+	 &writer,
+	 0x000ad510UL );
+	lnk_bench_corpus_writer_write_uint32(
+	 &writer,
+	 0 );
+	lnk_bench_corpus_writer_write_uint32(
+	 &writer,
+	 1 );
+	lnk_bench_corpus_writer_write_data(
+	 &writer,
+	 NULL,
+	 12 );
+
+	/* The link target identifier
+	 */
+	data_offset = writer.offset;
+
+	if( options->number_of_shell_items > 0 )
+	{
+		lnk_bench_corpus_writer_write_uint16(
+		 &writer,
+		 (uint16_t) ( ( options->number_of_shell_items * 20 ) + 2 ) );
+
+		for( shell_item_index = 0;
+		     shell_item_index < options->number_of_shell_items;
+		     shell_item_index++ )
+		{
+			lnk_bench_corpus_writer_write_data(
+			 &writer,
+			 lnk_bench_corpus_root_folder_shell_item,
+			 20 );
+		}
+		lnk_bench_corpus_writer_write_uint16(
+		 &writer,
+		 0 );
+	}
+	if( layout != NULL )
+	{
+		layout->link_target_identifier_offset = data_offset;
+		layout->link_target_identifier_size   = writer.offset - data_offset;
+	}
+	/* The location information
+	 */
+	data_offset = writer.offset;
+
+	lnk_bench_corpus_writer_write_location_information(
+	 &writer,
+	 options );
+
+	if( layout != NULL )
+	{
+		layout->location_information_offset = data_offset;
+		layout->location_information_size   = writer.offset - data_offset;
+	}
+	/* The data strings
+	 */
+	data_offset = writer.offset;
+
+	lnk_bench_corpus_writer_write_data_string(
+	 &writer,
+	 options,
+	 "Synthetic shortcut " );
+
+	if( layout != NULL )
+	{
+		layout->data_string_offset = data_offset;
+		layout->data_string_size   = writer.offset - data_offset;
+	}
+	lnk_bench_corpus_writer_write_data_string(
+	 &writer,
+	 options,
+	 "..\\..\\" );
+	lnk_bench_corpus_writer_write_data_string(
+	 &writer,
+	 options,
+	 "C:\\Users\\" );
+	lnk_bench_corpus_writer_write_data_string(
+	 &writer,
+	 options,
+	 "--input C:\\Users\\" );
+	lnk_bench_corpus_writer_write_data_string(
+	 &writer,
+	 options,
+	 "%SystemRoot%\\system32\\" );
+
+	/* The extra data blocks
+	 */
+	data_offset = writer.offset;
+
+	if( options->has_extra_data_blocks != 0 )
+	{
+		lnk_bench_corpus_writer_write_extra_data_blocks(
+		 &writer );
+	}
+	if( layout != NULL )
+	{
+		layout->data_block_offset = data_offset;
+
+		if( options->has_extra_data_blocks != 0 )
+		{
+			layout->data_block_size                = 788;
+			layout->special_folder_location_offset = data_offset + 788 + 96;
+			layout->special_folder_location_size   = 16;
+			layout->known_folder_location_offset   = data_offset + 788 + 96 + 16;
+			layout->known_folder_location_size     = 28;
+		}
+		else
+		{
+			layout->data_block_size                = 0;
+			layout->special_folder_location_offset = 0;
+			layout->special_folder_location_size   = 0;
+			layout->known_folder_location_offset   = 0;
+			layout->known_folder_location_size     = 0;
+		}
+	}
+	lnk_bench_corpus_writer_write_additional_data_blocks(
+	 &writer,
+	 options );
+
+	if( options->number_of_property_values > 0 )
+	{
+		lnk_bench_corpus_writer_write_property_store(
+		 &writer,
+		 options );
+	}
+	lnk_bench_corpus_writer_write_uint32(
+	 &writer,
+	 0 );
+
+	if( ( buffer != NULL )
+	 && ( writer.offset > buffer_size ) )
+	{
+		return( -1 );
+	}
+	*shortcut_size = writer.offset;
+
+	return( 1 );
+}
+
+/* Builds a synthetic shortcut
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_corpus_build_shortcut(
+     const lnk_bench_corpus_options_t *options,
+     uint8_t **shortcut_data,
+     size_t *shortcut_size,
+     lnk_bench_corpus_layout_t *layout )
+{
+	uint8_t *safe_shortcut_data = NULL;
+	size_t safe_shortcut_size   = 0;
+
+	if( ( shortcut_data == NULL )
+	 || ( shortcut_size == NULL ) )
+	{
+		return( -1 );
+	}
+	if( lnk_bench_corpus_write_shortcut(
+	     options,
+	     NULL,
+	     0,
+	     &safe_shortcut_size,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	safe_shortcut_data = (uint8_t *) memory_allocate(
+	                                  sizeof( uint8_t ) * safe_shortcut_size );
+
+	if( safe_shortcut_data == NULL )
+	{
+		return( -1 );
+	}
+	if( lnk_bench_corpus_write_shortcut(
+	     options,
+	     safe_shortcut_data,
+	     safe_shortcut_size,
+	     shortcut_size,
+	     layout ) != 1 )
+	{
+		memory_free(
+		 safe_shortcut_data );
+
+		return( -1 );
+	}
+	*shortcut_data = safe_shortcut_data;
+
+	return( 1 );
+}
+
@@ -0,0 +1,140 @@
+/*
+ * Synthetic shortcut corpus functions for benchmarking
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LNK_BENCH_CORPUS_H )
+#define _LNK_BENCH_CORPUS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct lnk_bench_corpus_options lnk_bench_corpus_options_t;
+
+struct lnk_bench_corpus_options
+{
+	/* Value to indicate the strings are stored as UTF-16 little-endian
+	 * instead of the ASCII codepage
+	 */
+	int is_unicode;
+
+	/* The number of shell items in the link target identifier
+	 */
+	int number_of_shell_items;
+
+	/* The number of characters in the path and data strings
+	 */
+	int path_length;
+
+	/* Value to indicate the location information contains
+	 * a network share (UNC) instead of a local path
+	 */
+	int is_network_location;
+
+	/* Value to indicate the extra data blocks should be written
+	 */
+	int has_extra_data_blocks;
+
+	/* The number of additional console properties and console codepage
+	 * data blocks
+	 */
+	int number_of_additional_data_blocks;
+
+	/* The number of values in the metadata property store data block,
+	 * 0 if the data block should not be written
+	 */
+	int number_of_property_values;
+};
+
+typedef struct lnk_bench_corpus_layout lnk_bench_corpus_layout_t;
+
+struct lnk_bench_corpus_layout
+{
+	/* The link target identifier offset
+	 */
+	size_t link_target_identifier_offset;
+
+	/* The link target identifier size
+	 */
+	size_t link_target_identifier_size;
+
+	/* The location information offset
+	 */
+	size_t location_information_offset;
+
+	/* The location information size
+	 */
+	size_t location_information_size;
+
+	/* The description data string offset
+	 */
+	size_t data_string_offset;
+
+	/* The description data string size
+	 */
+	size_t data_string_size;
+
+	/* The first extra data block offset
+	 */
+	size_t data_block_offset;
+
+	/* The first extra data block size
+	 */
+	size_t data_block_size;
+
+	/* The special folder location data block offset
+	 */
+	size_t special_folder_location_offset;
+
+	/* The special folder location data block size
+	 */
+	size_t special_folder_location_size;
+
+	/* The known folder location data block offset
+	 */
+	size_t known_folder_location_offset;
+
+	/* The known folder location data block size
+	 */
+	size_t known_folder_location_size;
+};
+
+int lnk_bench_corpus_write_shortcut(
+     const lnk_bench_corpus_options_t *options,
+     uint8_t *buffer,
+     size_t buffer_size,
+     size_t *shortcut_size,
+     lnk_bench_corpus_layout_t *layout );
+
+int lnk_bench_corpus_build_shortcut(
+     const lnk_bench_corpus_options_t *options,
+     uint8_t **shortcut_data,
+     size_t *shortcut_size,
+     lnk_bench_corpus_layout_t *layout );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LNK_BENCH_CORPUS_H ) */
+
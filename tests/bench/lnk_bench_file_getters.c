@@ -0,0 +1,626 @@
+/*
+ * Benchmarks the throughput of the file retrieval functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_bench_functions.h"
+#include "lnk_bench_libcthreads.h"
+#include "lnk_test_getopt.h"
+#include "lnk_test_libcerror.h"
+#include "lnk_test_liblnk.h"
+
+/* The number of fixed-size value retrieval functions called per iteration
+ */
+#define LNK_BENCH_FILE_GETTERS_FIXED_SIZE_PER_ITERATION	5
+
+/* The number of string retrieval functions called per iteration
+ */
+#define LNK_BENCH_FILE_GETTERS_STRING_PER_ITERATION	6
+
+/* The size of the string buffer
+ */
+#define LNK_BENCH_FILE_GETTERS_STRING_SIZE		1024
+
+/* The maximum number of threads
+ */
+#define LNK_BENCH_MAXIMUM_NUMBER_OF_THREADS	256
+
+typedef struct lnk_bench_file_getters_context lnk_bench_file_getters_context_t;
+
+struct lnk_bench_file_getters_context
+{
+	/* The file
+	 */
+	liblnk_file_t *file;
+
+	/* The number of iterations
+	 */
+	int number_of_iterations;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Prints usage information
+ */
+void lnk_bench_file_getters_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use lnk_bench_file_getters to measure the throughput of the file\n"
+	                 "retrieval functions when called from multiple threads. The fixed-size\n"
+	                 "value and the string retrieval functions are measured separately.\n\n" );
+
+	fprintf( stream, "Usage: lnk_bench_file_getters [ -i iterations ] [ -t threads ] [ -hl ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations per thread, default is 1000000\n" );
+	fprintf( stream, "\t-l:     read the extra data blocks on demand, which keeps\n"
+	                 "\t        the file unfrozen and the read/write lock in use\n" );
+	fprintf( stream, "\t-t:     number of threads, default is 1\n" );
+}
+
+/* Calls the fixed-size value file retrieval functions
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_file_getters_run_fixed_size(
+     lnk_bench_file_getters_context_t *context )
+{
+	libcerror_error_t *error  = NULL;
+	uint64_t filetime         = 0;
+	uint32_t value_32bit      = 0;
+	int iteration             = 0;
+
+	if( context == NULL )
+	{
+		return( -1 );
+	}
+	context->result = -1;
+
+	for( iteration = 0;
+	     iteration < context->number_of_iterations;
+	     iteration++ )
+	{
+		if( liblnk_file_get_data_flags(
+		     context->file,
+		     &value_32bit,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( liblnk_file_get_file_attribute_flags(
+		     context->file,
+		     &value_32bit,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( liblnk_file_get_file_size(
+		     context->file,
+		     &value_32bit,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( liblnk_file_get_file_creation_time(
+		     context->file,
+		     &filetime,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( liblnk_file_get_file_modification_time(
+		     context->file,
+		     &filetime,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	context->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Calls the string file retrieval functions
+ * Every string is retrieved with a size and a copy call
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_file_getters_run_string(
+     lnk_bench_file_getters_context_t *context )
+{
+	uint8_t utf8_string[ LNK_BENCH_FILE_GETTERS_STRING_SIZE ];
+
+	libcerror_error_t *error  = NULL;
+	size_t utf8_string_size   = 0;
+	int iteration             = 0;
+	int result                = 0;
+
+	if( context == NULL )
+	{
+		return( -1 );
+	}
+	context->result = -1;
+
+	for( iteration = 0;
+	     iteration < context->number_of_iterations;
+	     iteration++ )
+	{
+		result = liblnk_file_get_utf8_local_path_size(
+		          context->file,
+		          &utf8_string_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( utf8_string_size <= LNK_BENCH_FILE_GETTERS_STRING_SIZE ) )
+		{
+			if( liblnk_file_get_utf8_local_path(
+			     context->file,
+			     utf8_string,
+			     utf8_string_size,
+			     &error ) == -1 )
+			{
+				goto on_error;
+			}
+		}
+		result = liblnk_file_get_utf8_description_size(
+		          context->file,
+		          &utf8_string_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( utf8_string_size <= LNK_BENCH_FILE_GETTERS_STRING_SIZE ) )
+		{
+			if( liblnk_file_get_utf8_description(
+			     context->file,
+			     utf8_string,
+			     utf8_string_size,
+			     &error ) == -1 )
+			{
+				goto on_error;
+			}
+		}
+		result = liblnk_file_get_utf8_command_line_arguments_size(
+		          context->file,
+		          &utf8_string_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			goto on_error;
+		}
+		else if( ( result != 0 )
+		      && ( utf8_string_size <= LNK_BENCH_FILE_GETTERS_STRING_SIZE ) )
+		{
+			if( liblnk_file_get_utf8_command_line_arguments(
+			     context->file,
+			     utf8_string,
+			     utf8_string_size,
+			     &error ) == -1 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	context->result = 1;
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* Runs a set of file retrieval functions on multiple threads and prints the throughput
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_file_getters_measure(
+     liblnk_file_t *file,
+     const char *getters,
+     int (*run_function)(
+            lnk_bench_file_getters_context_t *context ),
+     int number_of_getters_per_iteration,
+     int number_of_threads,
+     int number_of_iterations,
+     int is_frozen )
+{
+	lnk_bench_file_getters_context_t contexts[ LNK_BENCH_MAXIMUM_NUMBER_OF_THREADS ];
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ LNK_BENCH_MAXIMUM_NUMBER_OF_THREADS ];
+#endif
+
+	libcerror_error_t *error      = NULL;
+	uint64_t end_time             = 0;
+	uint64_t number_of_operations = 0;
+	uint64_t start_time           = 0;
+	int result                    = 1;
+	int thread_index              = 0;
+
+	if( ( number_of_threads < 1 )
+	 || ( number_of_threads > LNK_BENCH_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		contexts[ thread_index ].file                 = file;
+		contexts[ thread_index ].number_of_iterations = number_of_iterations;
+		contexts[ thread_index ].result               = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		threads[ thread_index ] = NULL;
+#endif
+	}
+	if( lnk_bench_get_time(
+	     &start_time ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve start time.\n" );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) run_function,
+		     (void *) &( contexts[ thread_index ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create thread: %d.\n",
+			 thread_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ thread_index ] ),
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to join thread: %d.\n",
+			 thread_index );
+
+			result = -1;
+		}
+	}
+#else
+	run_function(
+	 &( contexts[ 0 ] ) );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	if( lnk_bench_get_time(
+	     &end_time ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to retrieve end time.\n" );
+
+		result = -1;
+	}
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( contexts[ thread_index ].result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Thread: %d failed.\n",
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	number_of_operations = (uint64_t) number_of_threads * (uint64_t) number_of_iterations * (uint64_t) number_of_getters_per_iteration;
+
+	fprintf(
+	 stdout,
+	 "benchmark=file_getters getters=%s frozen=%d threads=%d operations=%" PRIu64 " elapsed_ns=%" PRIu64 " ns_per_op=%.2f operations_per_second=%.0f\n",
+	 getters,
+	 is_frozen,
+	 number_of_threads,
+	 number_of_operations,
+	 end_time - start_time,
+	 ( number_of_operations > 0 ) ? (double) ( end_time - start_time ) / (double) number_of_operations : 0.0,
+	 ( end_time > start_time ) ? ( (double) number_of_operations * 1000000000.0 ) / (double) ( end_time - start_time ) : 0.0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error   = NULL;
+	liblnk_file_t *file        = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int access_flags           = LIBLNK_OPEN_READ;
+	int is_frozen              = 1;
+	int number_of_iterations   = 1000000;
+	int number_of_threads      = 1;
+
+	while( ( option = lnk_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:lt:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 'h':
+				lnk_bench_file_getters_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				if( lnk_bench_get_integer(
+				     optarg,
+				     &number_of_iterations ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid number of iterations: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'l':
+				access_flags |= LIBLNK_ACCESS_FLAG_LAZY_DATA_BLOCKS;
+				is_frozen      = 0;
+
+				break;
+
+			case (system_integer_t) 't':
+				if( ( lnk_bench_get_integer(
+				       optarg,
+				       &number_of_threads ) != 1 )
+				 || ( number_of_threads < 1 )
+				 || ( number_of_threads > LNK_BENCH_MAXIMUM_NUMBER_OF_THREADS ) )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid number of threads: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				lnk_bench_file_getters_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind >= argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		lnk_bench_file_getters_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+#if !defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Multiple threads require multi-thread support.\n" );
+
+		return( EXIT_FAILURE );
+	}
+#endif
+	if( liblnk_file_initialize(
+	     &file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize file.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( liblnk_file_open_wide(
+	     file,
+	     source,
+	     access_flags,
+	     &error ) != 1 )
+#else
+	if( liblnk_file_open(
+	     file,
+	     source,
+	     access_flags,
+	     &error ) != 1 )
+#endif
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	/* The fixed-size values and the strings are measured separately
+	 * since the string retrieval functions also copy the string
+	 */
+	if( lnk_bench_file_getters_measure(
+	     file,
+	     "fixed_size",
+	     &lnk_bench_file_getters_run_fixed_size,
+	     LNK_BENCH_FILE_GETTERS_FIXED_SIZE_PER_ITERATION,
+	     number_of_threads,
+	     number_of_iterations,
+	     is_frozen ) != 1 )
+	{
+		goto on_error;
+	}
+	if( lnk_bench_file_getters_measure(
+	     file,
+	     "string",
+	     &lnk_bench_file_getters_run_string,
+	     LNK_BENCH_FILE_GETTERS_STRING_PER_ITERATION,
+	     number_of_threads,
+	     number_of_iterations,
+	     is_frozen ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_file_close(
+	     file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close file.\n" );
+
+		goto on_error;
+	}
+	if( liblnk_file_free(
+	     &file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free file.\n" );
+
+		goto on_error;
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,180 @@
+/*
+ * Functions for benchmarking
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_TIME_H ) && !defined( WINAPI )
+#include <time.h>
+#endif
+
+#include "lnk_bench_functions.h"
+
+/* Retrieves a monotonic time in nanoseconds
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_get_time(
+     uint64_t *nanoseconds )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	struct timespec time_value;
+
+#endif
+
+	if( nanoseconds == NULL )
+	{
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( QueryPerformanceFrequency(
+	     &frequency ) == 0 )
+	{
+		return( -1 );
+	}
+	if( QueryPerformanceCounter(
+	     &counter ) == 0 )
+	{
+		return( -1 );
+	}
+	*nanoseconds = ( (uint64_t) counter.QuadPart / (uint64_t) frequency.QuadPart ) * 1000000000UL
+	             + ( ( (uint64_t) counter.QuadPart % (uint64_t) frequency.QuadPart ) * 1000000000UL ) / (uint64_t) frequency.QuadPart;
+
+#elif defined( HAVE_CLOCK_GETTIME )
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_value ) != 0 )
+	{
+		return( -1 );
+	}
+	*nanoseconds = ( (uint64_t) time_value.tv_sec * 1000000000UL ) + (uint64_t) time_value.tv_nsec;
+
+#else
+	*nanoseconds = (uint64_t) clock() * ( 1000000000UL / CLOCKS_PER_SEC );
+
+#endif
+	return( 1 );
+}
+
+/* Retrieves a positive decimal integer value from a string
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_get_integer(
+     const system_character_t *string,
+     int *value )
+{
+	int safe_value = 0;
+
+	if( ( string == NULL )
+	 || ( value == NULL ) )
+	{
+		return( -1 );
+	}
+	if( *string == 0 )
+	{
+		return( -1 );
+	}
+	while( *string != 0 )
+	{
+		if( ( *string < (system_character_t) '0' )
+		 || ( *string > (system_character_t) '9' ) )
+		{
+			return( -1 );
+		}
+		if( safe_value > ( ( INT32_MAX - 9 ) / 10 ) )
+		{
+			return( -1 );
+		}
+		safe_value *= 10;
+		safe_value += (int) ( *string - (system_character_t) '0' );
+
+		string++;
+	}
+	*value = safe_value;
+
+	return( 1 );
+}
+
+/* Joins a directory and a filename into a path
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_join_path(
+     const system_character_t *directory,
+     const system_character_t *filename,
+     system_character_t **path )
+{
+	system_character_t *safe_path = NULL;
+	size_t directory_length       = 0;
+	size_t filename_length        = 0;
+
+	if( ( directory == NULL )
+	 || ( filename == NULL )
+	 || ( path == NULL ) )
+	{
+		return( -1 );
+	}
+	directory_length = system_string_length(
+	                    directory );
+
+	filename_length = system_string_length(
+	                   filename );
+
+	safe_path = system_string_allocate(
+	             directory_length + filename_length + 2 );
+
+	if( safe_path == NULL )
+	{
+		return( -1 );
+	}
+	if( system_string_copy(
+	     safe_path,
+	     directory,
+	     directory_length ) == NULL )
+	{
+		memory_free(
+		 safe_path );
+
+		return( -1 );
+	}
+	safe_path[ directory_length ] = (system_character_t) '/';
+
+	if( system_string_copy(
+	     &( safe_path[ directory_length + 1 ] ),
+	     filename,
+	     filename_length ) == NULL )
+	{
+		memory_free(
+		 safe_path );
+
+		return( -1 );
+	}
+	safe_path[ directory_length + filename_length + 1 ] = 0;
+
+	*path = safe_path;
+
+	return( 1 );
+}
+
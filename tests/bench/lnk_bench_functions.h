@@ -0,0 +1,49 @@
+/*
+ * Functions for benchmarking
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LNK_BENCH_FUNCTIONS_H )
+#define _LNK_BENCH_FUNCTIONS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int lnk_bench_get_time(
+     uint64_t *nanoseconds );
+
+int lnk_bench_get_integer(
+     const system_character_t *string,
+     int *value );
+
+int lnk_bench_join_path(
+     const system_character_t *directory,
+     const system_character_t *filename,
+     system_character_t **path );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LNK_BENCH_FUNCTIONS_H ) */
+
@@ -0,0 +1,668 @@
+/*
+ * Generates a synthetic shortcut corpus for scale testing
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_bench_corpus.h"
+#include "lnk_bench_functions.h"
+#include "lnk_test_getopt.h"
+
+enum LNK_BENCH_GENERATE_MIXES
+{
+	LNK_BENCH_GENERATE_MIX_MIXED,
+	LNK_BENCH_GENERATE_MIX_CODEPAGE,
+	LNK_BENCH_GENERATE_MIX_UNICODE,
+	LNK_BENCH_GENERATE_MIX_NETWORK,
+	LNK_BENCH_GENERATE_MIX_DATA_BLOCKS,
+	LNK_BENCH_GENERATE_MIX_SHELL_ITEMS,
+	LNK_BENCH_GENERATE_MIX_PROPERTY_STORE
+};
+
+/* Prints usage information
+ */
+void lnk_bench_generate_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use lnk_bench_generate to generate a reproducible corpus of synthetic\n"
+	                 "shortcuts, either as individual files or as a single concatenated blob.\n\n" );
+
+	fprintf( stream, "Usage: lnk_bench_generate [ -b file | -d directory ] [ -m mix ]\n"
+	                 "                          [ -n number ] [ -r seed ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-b:     write the shortcuts back to back into a single file\n" );
+	fprintf( stream, "\t-d:     write the shortcuts as shortcut_########.lnk files into\n"
+	                 "\t        an existing directory\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-m:     structure mix, options: mixed (default), codepage, unicode,\n"
+	                 "\t        network, data_blocks, shell_items, property_store\n" );
+	fprintf( stream, "\t-n:     number of shortcuts, default is 1000\n" );
+	fprintf( stream, "\t-r:     seed of the pseudo random number generator, default is 1\n" );
+}
+
+/* Determines the structure mix from a string
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_generate_get_mix(
+     const system_character_t *string,
+     int *mix )
+{
+	size_t string_length = 0;
+
+	if( ( string == NULL )
+	 || ( mix == NULL ) )
+	{
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 5 )
+	 && ( system_string_compare(
+	       string,
+	       _SYSTEM_STRING( "mixed" ),
+	       5 ) == 0 ) )
+	{
+		*mix = LNK_BENCH_GENERATE_MIX_MIXED;
+	}
+	else if( ( string_length == 8 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "codepage" ),
+	            8 ) == 0 ) )
+	{
+		*mix = LNK_BENCH_GENERATE_MIX_CODEPAGE;
+	}
+	else if( ( string_length == 7 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "unicode" ),
+	            7 ) == 0 ) )
+	{
+		*mix = LNK_BENCH_GENERATE_MIX_UNICODE;
+	}
+	else if( ( string_length == 7 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "network" ),
+	            7 ) == 0 ) )
+	{
+		*mix = LNK_BENCH_GENERATE_MIX_NETWORK;
+	}
+	else if( ( string_length == 11 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "data_blocks" ),
+	            11 ) == 0 ) )
+	{
+		*mix = LNK_BENCH_GENERATE_MIX_DATA_BLOCKS;
+	}
+	else if( ( string_length == 11 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "shell_items" ),
+	            11 ) == 0 ) )
+	{
+		*mix = LNK_BENCH_GENERATE_MIX_SHELL_ITEMS;
+	}
+	else if( ( string_length == 14 )
+	      && ( system_string_compare(
+	            string,
+	            _SYSTEM_STRING( "property_store" ),
+	            14 ) == 0 ) )
+	{
+		*mix = LNK_BENCH_GENERATE_MIX_PROPERTY_STORE;
+	}
+	else
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next value of a xorshift64 pseudo random number generator
+ * Returns the value
+ */
+uint64_t lnk_bench_generate_random(
+          uint64_t *state )
+{
+	uint64_t value = *state;
+
+	value ^= value << 13;
+	value ^= value >> 7;
+	value ^= value << 17;
+
+	*state = value;
+
+	return( value );
+}
+
+/* Retrieves a pseudo random value in the range minimum to maximum inclusive
+ * Returns the value
+ */
+int lnk_bench_generate_random_range(
+     uint64_t *state,
+     int minimum,
+     int maximum )
+{
+	uint64_t range = (uint64_t) ( maximum - minimum ) + 1;
+
+	return( minimum + (int) ( lnk_bench_generate_random( state ) % range ) );
+}
+
+/* Determines the structure of the next shortcut
+ */
+void lnk_bench_generate_get_options(
+      int mix,
+      uint64_t *state,
+      lnk_bench_corpus_options_t *options )
+{
+	int percentage = 0;
+
+	options->is_unicode                       = 1;
+	options->number_of_shell_items            = 4;
+	options->path_length                      = 64;
+	options->is_network_location              = 0;
+	options->has_extra_data_blocks            = 1;
+	options->number_of_additional_data_blocks = 0;
+	options->number_of_property_values        = 0;
+
+	switch( mix )
+	{
+		case LNK_BENCH_GENERATE_MIX_CODEPAGE:
+			options->is_unicode = 0;
+			break;
+
+		case LNK_BENCH_GENERATE_MIX_UNICODE:
+			break;
+
+		case LNK_BENCH_GENERATE_MIX_NETWORK:
+			options->is_network_location = 1;
+			break;
+
+		case LNK_BENCH_GENERATE_MIX_DATA_BLOCKS:
+			options->number_of_additional_data_blocks = 64;
+			break;
+
+		case LNK_BENCH_GENERATE_MIX_SHELL_ITEMS:
+			options->number_of_shell_items = 1024;
+			break;
+
+		case LNK_BENCH_GENERATE_MIX_PROPERTY_STORE:
+			options->number_of_property_values = 64;
+			break;
+
+		case LNK_BENCH_GENERATE_MIX_MIXED:
+		default:
+			options->is_unicode = lnk_bench_generate_random_range(
+			                       state,
+			                       0,
+			                       1 );
+
+			/* Most shortcuts have a short shell item list and path,
+			 * a small fraction has a long one
+			 */
+			percentage = lnk_bench_generate_random_range(
+			              state,
+			              0,
+			              99 );
+
+			if( percentage < 70 )
+			{
+				options->number_of_shell_items = lnk_bench_generate_random_range(
+				                                  state,
+				                                  0,
+				                                  8 );
+			}
+			else if( percentage < 95 )
+			{
+				options->number_of_shell_items = lnk_bench_generate_random_range(
+				                                  state,
+				                                  9,
+				                                  64 );
+			}
+			else
+			{
+				options->number_of_shell_items = lnk_bench_generate_random_range(
+				                                  state,
+				                                  65,
+				                                  512 );
+			}
+			percentage = lnk_bench_generate_random_range(
+			              state,
+			              0,
+			              99 );
+
+			if( percentage < 70 )
+			{
+				options->path_length = lnk_bench_generate_random_range(
+				                        state,
+				                        8,
+				                        64 );
+			}
+			else if( percentage < 95 )
+			{
+				options->path_length = lnk_bench_generate_random_range(
+				                        state,
+				                        65,
+				                        260 );
+			}
+			else
+			{
+				options->path_length = lnk_bench_generate_random_range(
+				                        state,
+				                        261,
+				                        4096 );
+			}
+			options->is_network_location = (int) ( lnk_bench_generate_random_range(
+			                                        state,
+			                                        0,
+			                                        99 ) < 25 );
+
+			options->has_extra_data_blocks = lnk_bench_generate_random_range(
+			                                  state,
+			                                  0,
+			                                  1 );
+
+			if( lnk_bench_generate_random_range(
+			     state,
+			     0,
+			     99 ) < 10 )
+			{
+				options->number_of_additional_data_blocks = lnk_bench_generate_random_range(
+				                                             state,
+				                                             1,
+				                                             32 );
+			}
+			if( lnk_bench_generate_random_range(
+			     state,
+			     0,
+			     99 ) < 30 )
+			{
+				options->number_of_property_values = lnk_bench_generate_random_range(
+				                                      state,
+				                                      1,
+				                                      16 );
+			}
+			break;
+	}
+}
+
+/* Writes a shortcut as a file in a directory
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_generate_write_file(
+     const system_character_t *directory,
+     int file_index,
+     const uint8_t *data,
+     size_t data_size )
+{
+	char narrow_filename[ 32 ];
+	system_character_t filename[ 32 ];
+
+	FILE *stream             = NULL;
+	system_character_t *path = NULL;
+	size_t character_index   = 0;
+	size_t write_count       = 0;
+	int print_count          = 0;
+
+	print_count = narrow_string_snprintf(
+	               narrow_filename,
+	               32,
+	               "shortcut_%08d.lnk",
+	               file_index );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 32 ) )
+	{
+		return( -1 );
+	}
+	for( character_index = 0;
+	     character_index <= (size_t) print_count;
+	     character_index++ )
+	{
+		filename[ character_index ] = (system_character_t) narrow_filename[ character_index ];
+	}
+	if( lnk_bench_join_path(
+	     directory,
+	     filename,
+	     &path ) != 1 )
+	{
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          path,
+	          _SYSTEM_STRING( "wb" ) );
+#else
+	stream = file_stream_open(
+	          path,
+	          "wb" );
+#endif
+	memory_free(
+	 path );
+
+	if( stream == NULL )
+	{
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               stream,
+	               data,
+	               data_size );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		return( -1 );
+	}
+	if( write_count != data_size )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	lnk_bench_corpus_options_t options;
+
+	FILE *blob_stream                 = NULL;
+	system_character_t *blob_filename = NULL;
+	system_character_t *directory     = NULL;
+	system_integer_t option           = 0;
+	uint8_t *reallocation             = NULL;
+	uint8_t *shortcut_data            = NULL;
+	size_t shortcut_data_size         = 0;
+	size_t shortcut_size              = 0;
+	uint64_t random_state             = 0;
+	uint64_t total_size               = 0;
+	int file_index                    = 0;
+	int mix                           = LNK_BENCH_GENERATE_MIX_MIXED;
+	int number_of_files               = 1000;
+	int seed                          = 1;
+
+	while( ( option = lnk_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:d:hm:n:r:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 'b':
+				blob_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'd':
+				directory = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				lnk_bench_generate_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'm':
+				if( lnk_bench_generate_get_mix(
+				     optarg,
+				     &mix ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported structure mix: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'n':
+				if( lnk_bench_get_integer(
+				     optarg,
+				     &number_of_files ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid number of shortcuts: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'r':
+				if( lnk_bench_get_integer(
+				     optarg,
+				     &seed ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid seed: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				lnk_bench_generate_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( ( ( blob_filename == NULL )
+	  && ( directory == NULL ) )
+	 || ( ( blob_filename != NULL )
+	  && ( directory != NULL ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing or conflicting output, specify either -b or -d.\n" );
+
+		lnk_bench_generate_usage_fprint(
+		 stderr );
+
+		return( EXIT_FAILURE );
+	}
+	/* The xorshift64 state cannot be 0
+	 */
+	random_state = ( (uint64_t) seed << 1 ) | 1;
+
+	if( blob_filename != NULL )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		blob_stream = file_stream_open_wide(
+		               blob_filename,
+		               _SYSTEM_STRING( "wb" ) );
+#else
+		blob_stream = file_stream_open(
+		               blob_filename,
+		               "wb" );
+#endif
+		if( blob_stream == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open blob: %" PRIs_SYSTEM ".\n",
+			 blob_filename );
+
+			goto on_error;
+		}
+	}
+	for( file_index = 0;
+	     file_index < number_of_files;
+	     file_index++ )
+	{
+		lnk_bench_generate_get_options(
+		 mix,
+		 &random_state,
+		 &options );
+
+		if( lnk_bench_corpus_write_shortcut(
+		     &options,
+		     NULL,
+		     0,
+		     &shortcut_size,
+		     NULL ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine shortcut size.\n" );
+
+			goto on_error;
+		}
+		/* The shortcut buffer is reused and only grows
+		 */
+		if( shortcut_size > shortcut_data_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            shortcut_data,
+			                            sizeof( uint8_t ) * shortcut_size );
+
+			if( reallocation == NULL )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to resize shortcut data.\n" );
+
+				goto on_error;
+			}
+			shortcut_data      = reallocation;
+			shortcut_data_size = shortcut_size;
+		}
+		if( lnk_bench_corpus_write_shortcut(
+		     &options,
+		     shortcut_data,
+		     shortcut_data_size,
+		     &shortcut_size,
+		     NULL ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write shortcut.\n" );
+
+			goto on_error;
+		}
+		if( blob_stream != NULL )
+		{
+			if( file_stream_write(
+			     blob_stream,
+			     shortcut_data,
+			     shortcut_size ) != shortcut_size )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to write shortcut: %d to blob.\n",
+				 file_index );
+
+				goto on_error;
+			}
+		}
+		else if( lnk_bench_generate_write_file(
+		          directory,
+		          file_index,
+		          shortcut_data,
+		          shortcut_size ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to write shortcut: %d.\n",
+			 file_index );
+
+			goto on_error;
+		}
+		total_size += shortcut_size;
+	}
+	if( blob_stream != NULL )
+	{
+		if( file_stream_close(
+		     blob_stream ) != 0 )
+		{
+			blob_stream = NULL;
+
+			fprintf(
+			 stderr,
+			 "Unable to close blob.\n" );
+
+			goto on_error;
+		}
+		blob_stream = NULL;
+	}
+	if( shortcut_data != NULL )
+	{
+		memory_free(
+		 shortcut_data );
+	}
+	fprintf(
+	 stdout,
+	 "shortcuts=%d bytes=%" PRIu64 " seed=%d\n",
+	 number_of_files,
+	 total_size,
+	 seed );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( blob_stream != NULL )
+	{
+		file_stream_close(
+		 blob_stream );
+	}
+	if( shortcut_data != NULL )
+	{
+		memory_free(
+		 shortcut_data );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,155 @@
+/*
+ * Memory allocation counting functions for benchmarking
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+#define __USE_GNU
+#include <dlfcn.h>
+#undef __USE_GNU
+#endif
+
+#include "lnk_bench_memory.h"
+
+#if defined( HAVE_LNK_BENCH_MEMORY )
+
+static void *(*lnk_bench_real_calloc)(size_t, size_t)  = NULL;
+static void *(*lnk_bench_real_malloc)(size_t)          = NULL;
+static void *(*lnk_bench_real_realloc)(void *, size_t) = NULL;
+static uint64_t lnk_bench_number_of_allocations        = 0;
+
+/* Custom malloc that counts the number of allocations
+ * Returns a pointer to newly allocated data or NULL
+ */
+void *malloc(
+       size_t size )
+{
+	if( lnk_bench_real_malloc == NULL )
+	{
+		lnk_bench_real_malloc = dlsym(
+		                         RTLD_NEXT,
+		                         "malloc" );
+
+		if( lnk_bench_real_malloc == NULL )
+		{
+			return( NULL );
+		}
+	}
+	lnk_bench_number_of_allocations++;
+
+	return( lnk_bench_real_malloc(
+	         size ) );
+}
+
+/* Custom calloc that counts the number of allocations
+ * Note that dlsym can call calloc hence the first call is served from a static buffer
+ * Returns a pointer to newly allocated data or NULL
+ */
+void *calloc(
+       size_t number_of_elements,
+       size_t element_size )
+{
+	static uint8_t dlsym_buffer[ 256 ];
+	static int in_dlsym = 0;
+
+	if( lnk_bench_real_calloc == NULL )
+	{
+		if( in_dlsym != 0 )
+		{
+			if( ( number_of_elements * element_size ) > sizeof( dlsym_buffer ) )
+			{
+				return( NULL );
+			}
+			return( dlsym_buffer );
+		}
+		in_dlsym = 1;
+
+		lnk_bench_real_calloc = dlsym(
+		                         RTLD_NEXT,
+		                         "calloc" );
+
+		in_dlsym = 0;
+
+		if( lnk_bench_real_calloc == NULL )
+		{
+			return( NULL );
+		}
+	}
+	lnk_bench_number_of_allocations++;
+
+	return( lnk_bench_real_calloc(
+	         number_of_elements,
+	         element_size ) );
+}
+
+/* Custom realloc that counts the number of allocations
+ * Returns a pointer to reallocated data or NULL
+ */
+void *realloc(
+       void *ptr,
+       size_t size )
+{
+	if( lnk_bench_real_realloc == NULL )
+	{
+		lnk_bench_real_realloc = dlsym(
+		                          RTLD_NEXT,
+		                          "realloc" );
+
+		if( lnk_bench_real_realloc == NULL )
+		{
+			return( NULL );
+		}
+	}
+	lnk_bench_number_of_allocations++;
+
+	return( lnk_bench_real_realloc(
+	         ptr,
+	         size ) );
+}
+
+#endif /* defined( HAVE_LNK_BENCH_MEMORY ) */
+
+/* Retrieves the number of allocations made since the start of the program
+ * Returns 1 if successful, 0 if allocations are not counted or -1 on error
+ */
+int lnk_bench_memory_get_number_of_allocations(
+     uint64_t *number_of_allocations )
+{
+	if( number_of_allocations == NULL )
+	{
+		return( -1 );
+	}
+#if defined( HAVE_LNK_BENCH_MEMORY )
+	*number_of_allocations = lnk_bench_number_of_allocations;
+
+	return( 1 );
+#else
+	*number_of_allocations = 0;
+
+	return( 0 );
+#endif
+}
+
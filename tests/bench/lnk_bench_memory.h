@@ -0,0 +1,53 @@
+/*
+ * Memory allocation counting functions for benchmarking
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LNK_BENCH_MEMORY_H )
+#define _LNK_BENCH_MEMORY_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* Allocation counting cannot be used in combination with DLLs or CygWin
+ */
+#if !defined( LIBLNK_DLL_IMPORT ) && !defined( __CYGWIN__ )
+
+/* Allocation counting requires dlsym
+ */
+#if defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ )
+
+#define HAVE_LNK_BENCH_MEMORY	1
+
+#endif /* defined( HAVE_GNU_DL_DLSYM ) && defined( __GNUC__ ) */
+#endif /* !defined( LIBLNK_DLL_IMPORT ) && !defined( __CYGWIN__ ) */
+
+int lnk_bench_memory_get_number_of_allocations(
+     uint64_t *number_of_allocations );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LNK_BENCH_MEMORY_H ) */
+
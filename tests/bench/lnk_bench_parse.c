@@ -0,0 +1,1555 @@
+/*
+ * Benchmarks the parsing hot paths
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_bench_corpus.h"
+#include "lnk_bench_functions.h"
+#include "lnk_bench_memory.h"
+#include "lnk_test_getopt.h"
+#include "lnk_test_libbfio.h"
+#include "lnk_test_libcerror.h"
+#include "lnk_test_liblnk.h"
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+#include "../../liblnk/liblnk_data_block.h"
+#include "../../liblnk/liblnk_data_string.h"
+#include "../../liblnk/liblnk_file_header.h"
+#include "../../liblnk/liblnk_io_handle.h"
+#include "../../liblnk/liblnk_known_folder_location.h"
+#include "../../liblnk/liblnk_link_target_identifier.h"
+#include "../../liblnk/liblnk_location_information.h"
+#include "../../liblnk/liblnk_special_folder_location.h"
+#endif
+
+/* The maximum size of an input file
+ */
+#define LNK_BENCH_PARSE_MAXIMUM_INPUT_SIZE	( 16 * 1024 * 1024 )
+
+/* The size of the string buffers of the string retrieval benchmarks
+ */
+#define LNK_BENCH_PARSE_STRING_BUFFER_SIZE	( 256 * 1024 )
+
+typedef struct lnk_bench_parse_getter lnk_bench_parse_getter_t;
+
+struct lnk_bench_parse_getter
+{
+	/* The name of the string
+	 */
+	const char *name;
+
+	/* The function to retrieve the size of the UTF-8 string
+	 */
+	int (*get_utf8_string_size)(
+	       liblnk_file_t *file,
+	       size_t *utf8_string_size,
+	       liblnk_error_t **error );
+
+	/* The function to retrieve the UTF-8 string
+	 */
+	int (*get_utf8_string)(
+	       liblnk_file_t *file,
+	       uint8_t *utf8_string,
+	       size_t utf8_string_size,
+	       liblnk_error_t **error );
+
+	/* The function to retrieve the size of the UTF-16 string
+	 */
+	int (*get_utf16_string_size)(
+	       liblnk_file_t *file,
+	       size_t *utf16_string_size,
+	       liblnk_error_t **error );
+
+	/* The function to retrieve the UTF-16 string
+	 */
+	int (*get_utf16_string)(
+	       liblnk_file_t *file,
+	       uint16_t *utf16_string,
+	       size_t utf16_string_size,
+	       liblnk_error_t **error );
+};
+
+lnk_bench_parse_getter_t lnk_bench_parse_getters[] = {
+	{ "description",
+	  liblnk_file_get_utf8_description_size,
+	  liblnk_file_get_utf8_description,
+	  liblnk_file_get_utf16_description_size,
+	  liblnk_file_get_utf16_description },
+	{ "relative_path",
+	  liblnk_file_get_utf8_relative_path_size,
+	  liblnk_file_get_utf8_relative_path,
+	  liblnk_file_get_utf16_relative_path_size,
+	  liblnk_file_get_utf16_relative_path },
+	{ "working_directory",
+	  liblnk_file_get_utf8_working_directory_size,
+	  liblnk_file_get_utf8_working_directory,
+	  liblnk_file_get_utf16_working_directory_size,
+	  liblnk_file_get_utf16_working_directory },
+	{ "command_line_arguments",
+	  liblnk_file_get_utf8_command_line_arguments_size,
+	  liblnk_file_get_utf8_command_line_arguments,
+	  liblnk_file_get_utf16_command_line_arguments_size,
+	  liblnk_file_get_utf16_command_line_arguments },
+	{ "icon_location",
+	  liblnk_file_get_utf8_icon_location_size,
+	  liblnk_file_get_utf8_icon_location,
+	  liblnk_file_get_utf16_icon_location_size,
+	  liblnk_file_get_utf16_icon_location },
+	{ "environment_variables_location",
+	  liblnk_file_get_utf8_environment_variables_location_size,
+	  liblnk_file_get_utf8_environment_variables_location,
+	  liblnk_file_get_utf16_environment_variables_location_size,
+	  liblnk_file_get_utf16_environment_variables_location },
+	{ "local_path",
+	  liblnk_file_get_utf8_local_path_size,
+	  liblnk_file_get_utf8_local_path,
+	  liblnk_file_get_utf16_local_path_size,
+	  liblnk_file_get_utf16_local_path },
+	{ "network_path",
+	  liblnk_file_get_utf8_network_path_size,
+	  liblnk_file_get_utf8_network_path,
+	  liblnk_file_get_utf16_network_path_size,
+	  liblnk_file_get_utf16_network_path },
+	{ "volume_label",
+	  liblnk_file_get_utf8_volume_label_size,
+	  liblnk_file_get_utf8_volume_label,
+	  liblnk_file_get_utf16_volume_label_size,
+	  liblnk_file_get_utf16_volume_label },
+	{ NULL, NULL, NULL, NULL, NULL } };
+
+typedef struct lnk_bench_parse_context lnk_bench_parse_context_t;
+
+struct lnk_bench_parse_context
+{
+	/* The name of the input
+	 */
+	const system_character_t *input_name;
+
+	/* The data of the structure being benchmarked
+	 */
+	const uint8_t *data;
+
+	/* The data size of the structure being benchmarked
+	 */
+	size_t data_size;
+
+	/* The file IO handle of the shortcut
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The opened shortcut
+	 */
+	liblnk_file_t *file;
+
+	/* The string retrieval functions being benchmarked
+	 */
+	const lnk_bench_parse_getter_t *getter;
+
+	/* The UTF-8 string buffer
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-16 string buffer
+	 */
+	uint16_t *utf16_string;
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+	/* The IO handle used by the decoders
+	 */
+	liblnk_io_handle_t *io_handle;
+
+	/* The data string encoding flags
+	 */
+	uint32_t encoding_flags;
+#endif
+};
+
+typedef int (*lnk_bench_parse_function_t)(
+             lnk_bench_parse_context_t *context,
+             libcerror_error_t **error );
+
+/* Prints usage information
+ */
+void lnk_bench_parse_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use lnk_bench_parse to measure the time and number of allocations\n"
+	                 "per operation of opening a shortcut from memory, of the structure\n"
+	                 "decoders and of the string retrieval functions.\n\n" );
+
+	fprintf( stream, "Usage: lnk_bench_parse [ -d directory ] [ -i iterations ] [ -s size ]\n"
+	                 "                       [ -h ] [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: one or more shortcut files to benchmark in addition\n"
+	                 "\t        to the synthetic shortcuts\n\n" );
+
+	fprintf( stream, "\t-d:     directory containing the structure test data (tests/data)\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations, default is 10000\n" );
+	fprintf( stream, "\t-s:     number of characters in the paths of the large synthetic\n"
+	                 "\t        shortcuts, default is 1024\n" );
+}
+
+/* Reads the contents of a file into memory
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_read_file(
+     const system_character_t *filename,
+     uint8_t **data,
+     size_t *data_size )
+{
+	FILE *stream          = NULL;
+	uint8_t *reallocation = NULL;
+	uint8_t *safe_data    = NULL;
+	size_t allocated_size = 0;
+	size_t read_count     = 0;
+	size_t safe_data_size = 0;
+
+	if( ( filename == NULL )
+	 || ( data == NULL )
+	 || ( data_size == NULL ) )
+	{
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( "rb" ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          "rb" );
+#endif
+	if( stream == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		if( safe_data_size == allocated_size )
+		{
+			if( allocated_size >= LNK_BENCH_PARSE_MAXIMUM_INPUT_SIZE )
+			{
+				goto on_error;
+			}
+			allocated_size += 64 * 1024;
+
+			reallocation = (uint8_t *) memory_reallocate(
+			                            safe_data,
+			                            sizeof( uint8_t ) * allocated_size );
+
+			if( reallocation == NULL )
+			{
+				goto on_error;
+			}
+			safe_data = reallocation;
+		}
+		read_count = file_stream_read(
+		              stream,
+		              &( safe_data[ safe_data_size ] ),
+		              allocated_size - safe_data_size );
+
+		safe_data_size += read_count;
+	}
+	while( read_count > 0 );
+
+	file_stream_close(
+	 stream );
+
+	*data      = safe_data;
+	*data_size = safe_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	file_stream_close(
+	 stream );
+
+	return( -1 );
+}
+
+/* Runs a benchmark and prints its result
+ * The function is called once before the measurement, if it returns 0
+ * the benchmark is not applicable to the input and is skipped
+ * Returns 1 if successful, 0 if skipped or -1 on error
+ */
+int lnk_bench_parse_run(
+     lnk_bench_parse_context_t *context,
+     const char *benchmark_name,
+     lnk_bench_parse_function_t function,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	uint64_t end_allocations   = 0;
+	uint64_t end_time          = 0;
+	uint64_t start_allocations = 0;
+	uint64_t start_time        = 0;
+	int iteration              = 0;
+	int result                 = 0;
+
+	if( ( context == NULL )
+	 || ( benchmark_name == NULL )
+	 || ( function == NULL ) )
+	{
+		return( -1 );
+	}
+	result = function(
+	          context,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	lnk_bench_memory_get_number_of_allocations(
+	 &start_allocations );
+
+	lnk_bench_get_time(
+	 &start_time );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( function(
+		     context,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	lnk_bench_get_time(
+	 &end_time );
+
+	result = lnk_bench_memory_get_number_of_allocations(
+	          &end_allocations );
+
+	fprintf(
+	 stdout,
+	 "benchmark=%s input=%" PRIs_SYSTEM " size=%" PRIzd " operations=%d elapsed_ns=%" PRIu64 " ns_per_op=%.2f",
+	 benchmark_name,
+	 context->input_name,
+	 context->data_size,
+	 number_of_iterations,
+	 end_time - start_time,
+	 ( number_of_iterations > 0 ) ? (double) ( end_time - start_time ) / (double) number_of_iterations : 0.0 );
+
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 " allocations_per_op=%.2f\n",
+		 ( number_of_iterations > 0 ) ? (double) ( end_allocations - start_allocations ) / (double) number_of_iterations : 0.0 );
+	}
+	else
+	{
+		fprintf(
+		 stdout,
+		 " allocations_per_op=unknown\n" );
+	}
+	return( 1 );
+}
+
+/* Opens and closes the shortcut from the memory range file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_file_open(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	liblnk_file_t *file = NULL;
+
+	if( liblnk_file_initialize(
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_file_open_file_io_handle(
+	     file,
+	     context->file_io_handle,
+	     LIBLNK_OPEN_READ,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_file_close(
+	     file,
+	     error ) != 0 )
+	{
+		goto on_error;
+	}
+	if( liblnk_file_free(
+	     &file,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the UTF-8 string and its size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int lnk_bench_parse_get_utf8_string(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	size_t utf8_string_size = 0;
+	int result              = 0;
+
+	result = context->getter->get_utf8_string_size(
+	          context->file,
+	          &utf8_string_size,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( utf8_string_size > LNK_BENCH_PARSE_STRING_BUFFER_SIZE )
+	{
+		return( -1 );
+	}
+	return( context->getter->get_utf8_string(
+	         context->file,
+	         context->utf8_string,
+	         utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves the UTF-16 string and its size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int lnk_bench_parse_get_utf16_string(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	size_t utf16_string_size = 0;
+	int result               = 0;
+
+	result = context->getter->get_utf16_string_size(
+	          context->file,
+	          &utf16_string_size,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	if( utf16_string_size > ( LNK_BENCH_PARSE_STRING_BUFFER_SIZE / 2 ) )
+	{
+		return( -1 );
+	}
+	return( context->getter->get_utf16_string(
+	         context->file,
+	         context->utf16_string,
+	         utf16_string_size,
+	         error ) );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+/* Decodes the file header
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_read_file_header(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	liblnk_file_header_t *file_header = NULL;
+
+	if( liblnk_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_file_header_read_data(
+	     file_header,
+	     context->data,
+	     context->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_file_header_free(
+	     &file_header,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_header != NULL )
+	{
+		liblnk_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes the link target identifier
+ * The data starts after the 16-bit link target identifier size
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_read_link_target_identifier(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	liblnk_link_target_identifier_t *link_target_identifier = NULL;
+
+	if( liblnk_link_target_identifier_initialize(
+	     &link_target_identifier,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_link_target_identifier_read_data(
+	     link_target_identifier,
+	     context->io_handle,
+	     context->data,
+	     context->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_link_target_identifier_free(
+	     &link_target_identifier,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( link_target_identifier != NULL )
+	{
+		liblnk_link_target_identifier_free(
+		 &link_target_identifier,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes the location information
+ * The data starts after the 32-bit location information size
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_read_location_information(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	liblnk_location_information_t *location_information = NULL;
+
+	if( liblnk_location_information_initialize(
+	     &location_information,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_location_information_read_data(
+	     location_information,
+	     context->io_handle,
+	     context->data,
+	     context->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_location_information_free(
+	     &location_information,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( location_information != NULL )
+	{
+		liblnk_location_information_free(
+		 &location_information,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes a data string
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_read_data_string(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	liblnk_data_string_t *data_string = NULL;
+
+	if( liblnk_data_string_initialize(
+	     &data_string,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_data_string_read_data(
+	     data_string,
+	     context->io_handle,
+	     context->data,
+	     context->data_size,
+	     context->encoding_flags,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_data_string_free(
+	     &data_string,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_string != NULL )
+	{
+		liblnk_data_string_free(
+		 &data_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes a data block
+ * The data starts with the 32-bit data block size
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_read_data_block(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	liblnk_data_block_t *data_block = NULL;
+
+	if( liblnk_data_block_initialize(
+	     &data_block,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_data_block_read_buffer(
+	     data_block,
+	     context->io_handle,
+	     context->data,
+	     context->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_data_block_free(
+	     &data_block,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( data_block != NULL )
+	{
+		liblnk_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes the special folder location data block
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_read_special_folder_location(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	liblnk_special_folder_location_t *special_folder_location = NULL;
+
+	if( liblnk_special_folder_location_initialize(
+	     &special_folder_location,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_special_folder_location_read_data(
+	     special_folder_location,
+	     context->data,
+	     context->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_special_folder_location_free(
+	     &special_folder_location,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( special_folder_location != NULL )
+	{
+		liblnk_special_folder_location_free(
+		 &special_folder_location,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Decodes the known folder location data block
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_read_known_folder_location(
+     lnk_bench_parse_context_t *context,
+     libcerror_error_t **error )
+{
+	liblnk_known_folder_location_t *known_folder_location = NULL;
+
+	if( liblnk_known_folder_location_initialize(
+	     &known_folder_location,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_known_folder_location_read_data(
+	     known_folder_location,
+	     context->data,
+	     context->data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( liblnk_known_folder_location_free(
+	     &known_folder_location,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( known_folder_location != NULL )
+	{
+		liblnk_known_folder_location_free(
+		 &known_folder_location,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs a decoder benchmark on part of the data
+ * Returns 1 if successful, 0 if skipped or -1 on error
+ */
+int lnk_bench_parse_run_decoder(
+     lnk_bench_parse_context_t *context,
+     const char *benchmark_name,
+     lnk_bench_parse_function_t function,
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	const uint8_t *shortcut_data = NULL;
+	size_t shortcut_data_size    = 0;
+	int result                   = 0;
+
+	if( context == NULL )
+	{
+		return( -1 );
+	}
+	shortcut_data      = context->data;
+	shortcut_data_size = context->data_size;
+
+	context->data      = data;
+	context->data_size = data_size;
+
+	result = lnk_bench_parse_run(
+	          context,
+	          benchmark_name,
+	          function,
+	          number_of_iterations,
+	          error );
+
+	context->data      = shortcut_data;
+	context->data_size = shortcut_data_size;
+
+	return( result );
+}
+
+/* Runs the decoder benchmarks on a synthetic shortcut
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_run_decoders(
+     lnk_bench_parse_context_t *context,
+     const lnk_bench_corpus_options_t *options,
+     const lnk_bench_corpus_layout_t *layout,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	const uint8_t *data = NULL;
+
+	if( ( context == NULL )
+	 || ( options == NULL )
+	 || ( layout == NULL ) )
+	{
+		return( -1 );
+	}
+	data = context->data;
+
+	context->io_handle->is_unicode = (uint8_t) options->is_unicode;
+	context->encoding_flags        = 0;
+
+	if( lnk_bench_parse_run_decoder(
+	     context,
+	     "read_file_header",
+	     lnk_bench_parse_read_file_header,
+	     data,
+	     76,
+	     number_of_iterations,
+	     error ) == -1 )
+	{
+		return( -1 );
+	}
+	if( layout->link_target_identifier_size > 2 )
+	{
+		if( lnk_bench_parse_run_decoder(
+		     context,
+		     "read_link_target_identifier",
+		     lnk_bench_parse_read_link_target_identifier,
+		     &( data[ layout->link_target_identifier_offset + 2 ] ),
+		     layout->link_target_identifier_size - 2,
+		     number_of_iterations,
+		     error ) == -1 )
+		{
+			return( -1 );
+		}
+	}
+	if( layout->location_information_size > 4 )
+	{
+		if( lnk_bench_parse_run_decoder(
+		     context,
+		     "read_location_information",
+		     lnk_bench_parse_read_location_information,
+		     &( data[ layout->location_information_offset + 4 ] ),
+		     layout->location_information_size - 4,
+		     number_of_iterations,
+		     error ) == -1 )
+		{
+			return( -1 );
+		}
+	}
+	if( lnk_bench_parse_run_decoder(
+	     context,
+	     "read_data_string",
+	     lnk_bench_parse_read_data_string,
+	     &( data[ layout->data_string_offset ] ),
+	     layout->data_string_size,
+	     number_of_iterations,
+	     error ) == -1 )
+	{
+		return( -1 );
+	}
+	if( layout->data_block_size > 0 )
+	{
+		if( lnk_bench_parse_run_decoder(
+		     context,
+		     "read_data_block",
+		     lnk_bench_parse_read_data_block,
+		     &( data[ layout->data_block_offset ] ),
+		     layout->data_block_size,
+		     number_of_iterations,
+		     error ) == -1 )
+		{
+			return( -1 );
+		}
+	}
+	if( layout->special_folder_location_size > 0 )
+	{
+		if( lnk_bench_parse_run_decoder(
+		     context,
+		     "read_special_folder_location",
+		     lnk_bench_parse_read_special_folder_location,
+		     &( data[ layout->special_folder_location_offset ] ),
+		     layout->special_folder_location_size,
+		     number_of_iterations,
+		     error ) == -1 )
+		{
+			return( -1 );
+		}
+	}
+	if( layout->known_folder_location_size > 0 )
+	{
+		if( lnk_bench_parse_run_decoder(
+		     context,
+		     "read_known_folder_location",
+		     lnk_bench_parse_read_known_folder_location,
+		     &( data[ layout->known_folder_location_offset ] ),
+		     layout->known_folder_location_size,
+		     number_of_iterations,
+		     error ) == -1 )
+		{
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Runs the decoder benchmarks on the structure test data in a directory
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_run_test_data(
+     lnk_bench_parse_context_t *context,
+     const system_character_t *directory,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	struct lnk_bench_parse_test_data
+	{
+		const system_character_t *filename;
+		const char *benchmark_name;
+		lnk_bench_parse_function_t function;
+	};
+
+	struct lnk_bench_parse_test_data test_data[] = {
+		{ _SYSTEM_STRING( "file_header.1" ), "read_file_header", lnk_bench_parse_read_file_header },
+		{ _SYSTEM_STRING( "data_string.1" ), "read_data_string", lnk_bench_parse_read_data_string },
+		{ _SYSTEM_STRING( "data_block.1" ), "read_data_block", lnk_bench_parse_read_data_block },
+		{ _SYSTEM_STRING( "special_folder_location.1" ), "read_special_folder_location", lnk_bench_parse_read_special_folder_location },
+		{ _SYSTEM_STRING( "known_folder_location.1" ), "read_known_folder_location", lnk_bench_parse_read_known_folder_location },
+		{ NULL, NULL, NULL } };
+
+	system_character_t *path = NULL;
+	uint8_t *data            = NULL;
+	size_t data_size         = 0;
+	int test_data_index      = 0;
+
+	if( context == NULL )
+	{
+		return( -1 );
+	}
+	/* The data string test data is stored in UTF-16 little-endian
+	 */
+	context->io_handle->is_unicode = 1;
+	context->encoding_flags        = 0;
+
+	for( test_data_index = 0;
+	     test_data[ test_data_index ].filename != NULL;
+	     test_data_index++ )
+	{
+		if( lnk_bench_join_path(
+		     directory,
+		     test_data[ test_data_index ].filename,
+		     &path ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create test data path.\n" );
+
+			goto on_error;
+		}
+		if( lnk_bench_parse_read_file(
+		     path,
+		     &data,
+		     &data_size ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read test data: %" PRIs_SYSTEM ".\n",
+			 path );
+
+			goto on_error;
+		}
+		context->input_name = test_data[ test_data_index ].filename;
+		context->data       = data;
+		context->data_size  = data_size;
+
+		if( lnk_bench_parse_run(
+		     context,
+		     test_data[ test_data_index ].benchmark_name,
+		     test_data[ test_data_index ].function,
+		     number_of_iterations,
+		     error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark: %s on: %" PRIs_SYSTEM ".\n",
+			 test_data[ test_data_index ].benchmark_name,
+			 path );
+
+			goto on_error;
+		}
+		context->data      = NULL;
+		context->data_size = 0;
+
+		memory_free(
+		 data );
+
+		data = NULL;
+
+		memory_free(
+		 path );
+
+		path = NULL;
+	}
+	return( 1 );
+
+on_error:
+	context->data      = NULL;
+	context->data_size = 0;
+
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+/* Runs the file open and string retrieval benchmarks on a shortcut
+ * Returns 1 if successful or -1 on error
+ */
+int lnk_bench_parse_run_shortcut(
+     lnk_bench_parse_context_t *context,
+     int number_of_iterations,
+     libcerror_error_t **error )
+{
+	char benchmark_name[ 64 ];
+
+	int getter_index = 0;
+	int result       = 0;
+
+	if( context == NULL )
+	{
+		return( -1 );
+	}
+	if( libbfio_memory_range_initialize(
+	     &( context->file_io_handle ),
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create file IO handle.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     context->file_io_handle,
+	     (uint8_t *) context->data,
+	     context->data_size,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to set memory range of file IO handle.\n" );
+
+		goto on_error;
+	}
+	if( lnk_bench_parse_run(
+	     context,
+	     "file_open",
+	     lnk_bench_parse_file_open,
+	     number_of_iterations,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to run benchmark: file_open.\n" );
+
+		goto on_error;
+	}
+	if( liblnk_file_initialize(
+	     &( context->file ),
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create file.\n" );
+
+		goto on_error;
+	}
+	if( liblnk_file_open_file_io_handle(
+	     context->file,
+	     context->file_io_handle,
+	     LIBLNK_OPEN_READ,
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open file.\n" );
+
+		goto on_error;
+	}
+	for( getter_index = 0;
+	     lnk_bench_parse_getters[ getter_index ].name != NULL;
+	     getter_index++ )
+	{
+		context->getter = &( lnk_bench_parse_getters[ getter_index ] );
+
+		result = narrow_string_snprintf(
+		          benchmark_name,
+		          64,
+		          "get_utf8_%s",
+		          context->getter->name );
+
+		if( ( result < 0 )
+		 || ( result >= 64 ) )
+		{
+			goto on_error;
+		}
+		if( lnk_bench_parse_run(
+		     context,
+		     benchmark_name,
+		     lnk_bench_parse_get_utf8_string,
+		     number_of_iterations,
+		     error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark: %s.\n",
+			 benchmark_name );
+
+			goto on_error;
+		}
+		result = narrow_string_snprintf(
+		          benchmark_name,
+		          64,
+		          "get_utf16_%s",
+		          context->getter->name );
+
+		if( ( result < 0 )
+		 || ( result >= 64 ) )
+		{
+			goto on_error;
+		}
+		if( lnk_bench_parse_run(
+		     context,
+		     benchmark_name,
+		     lnk_bench_parse_get_utf16_string,
+		     number_of_iterations,
+		     error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run benchmark: %s.\n",
+			 benchmark_name );
+
+			goto on_error;
+		}
+	}
+	context->getter = NULL;
+
+	if( liblnk_file_close(
+	     context->file,
+	     error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close file.\n" );
+
+		goto on_error;
+	}
+	if( liblnk_file_free(
+	     &( context->file ),
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free file.\n" );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &( context->file_io_handle ),
+	     error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free file IO handle.\n" );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	context->getter = NULL;
+
+	if( context->file != NULL )
+	{
+		liblnk_file_free(
+		 &( context->file ),
+		 NULL );
+	}
+	if( context->file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( context->file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	lnk_bench_corpus_layout_t layout;
+	lnk_bench_parse_context_t context;
+
+	lnk_bench_corpus_options_t synthetic_options[ 3 ] = {
+		{ 0, 0, 16, 0, 0, 0, 0 },
+		{ 1, 64, 1024, 0, 1, 0, 0 },
+		{ 1, 64, 1024, 1, 1, 0, 0 } };
+
+	const system_character_t *synthetic_names[ 3 ] = {
+		_SYSTEM_STRING( "synthetic_small" ),
+		_SYSTEM_STRING( "synthetic_large_local" ),
+		_SYSTEM_STRING( "synthetic_large_network" ) };
+
+	libcerror_error_t *error           = NULL;
+	system_character_t *test_data_path = NULL;
+	system_integer_t option            = 0;
+	uint8_t *data                      = NULL;
+	size_t data_size                   = 0;
+	int number_of_characters           = 1024;
+	int number_of_iterations           = 10000;
+	int synthetic_index                = 0;
+
+	if( memory_set(
+	     &context,
+	     0,
+	     sizeof( lnk_bench_parse_context_t ) ) == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to clear context.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	while( ( option = lnk_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "d:hi:s:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 'd':
+				test_data_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				lnk_bench_parse_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				if( ( lnk_bench_get_integer(
+				       optarg,
+				       &number_of_iterations ) != 1 )
+				 || ( number_of_iterations < 1 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid number of iterations: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 's':
+				if( ( lnk_bench_get_integer(
+				       optarg,
+				       &number_of_characters ) != 1 )
+				 || ( number_of_characters < 1 )
+				 || ( number_of_characters > 32767 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid number of characters: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				lnk_bench_parse_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+		}
+	}
+#if !defined( __GNUC__ ) || defined( LIBLNK_DLL_IMPORT )
+	if( test_data_path != NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Internal functions are not available.\n" );
+
+		return( EXIT_FAILURE );
+	}
+#endif
+	synthetic_options[ 1 ].path_length = number_of_characters;
+	synthetic_options[ 2 ].path_length = number_of_characters;
+
+	context.utf8_string = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * LNK_BENCH_PARSE_STRING_BUFFER_SIZE );
+
+	if( context.utf8_string == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create UTF-8 string.\n" );
+
+		goto on_error;
+	}
+	context.utf16_string = (uint16_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * LNK_BENCH_PARSE_STRING_BUFFER_SIZE );
+
+	if( context.utf16_string == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create UTF-16 string.\n" );
+
+		goto on_error;
+	}
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+	if( liblnk_io_handle_initialize(
+	     &( context.io_handle ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create IO handle.\n" );
+
+		goto on_error;
+	}
+#endif
+	for( synthetic_index = 0;
+	     synthetic_index < 3;
+	     synthetic_index++ )
+	{
+		if( lnk_bench_corpus_build_shortcut(
+		     &( synthetic_options[ synthetic_index ] ),
+		     &data,
+		     &data_size,
+		     &layout ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to build synthetic shortcut.\n" );
+
+			goto on_error;
+		}
+		context.input_name = synthetic_names[ synthetic_index ];
+		context.data       = data;
+		context.data_size  = data_size;
+
+		if( lnk_bench_parse_run_shortcut(
+		     &context,
+		     number_of_iterations,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+		if( lnk_bench_parse_run_decoders(
+		     &context,
+		     &( synthetic_options[ synthetic_index ] ),
+		     &layout,
+		     number_of_iterations,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run decoder benchmarks.\n" );
+
+			goto on_error;
+		}
+#endif
+		context.data      = NULL;
+		context.data_size = 0;
+
+		memory_free(
+		 data );
+
+		data = NULL;
+	}
+	while( optind < argc )
+	{
+		if( lnk_bench_parse_read_file(
+		     argv[ optind ],
+		     &data,
+		     &data_size ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read source: %" PRIs_SYSTEM ".\n",
+			 argv[ optind ] );
+
+			goto on_error;
+		}
+		context.input_name = argv[ optind ];
+		context.data       = data;
+		context.data_size  = data_size;
+
+		if( lnk_bench_parse_run_shortcut(
+		     &context,
+		     number_of_iterations,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		context.data      = NULL;
+		context.data_size = 0;
+
+		memory_free(
+		 data );
+
+		data = NULL;
+
+		optind++;
+	}
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+	if( test_data_path != NULL )
+	{
+		if( lnk_bench_parse_run_test_data(
+		     &context,
+		     test_data_path,
+		     number_of_iterations,
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( liblnk_io_handle_free(
+	     &( context.io_handle ),
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free IO handle.\n" );
+
+		goto on_error;
+	}
+#endif
+	memory_free(
+	 context.utf16_string );
+
+	memory_free(
+	 context.utf8_string );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+	if( context.io_handle != NULL )
+	{
+		liblnk_io_handle_free(
+		 &( context.io_handle ),
+		 NULL );
+	}
+#endif
+	if( context.utf16_string != NULL )
+	{
+		memory_free(
+		 context.utf16_string );
+	}
+	if( context.utf8_string != NULL )
+	{
+		memory_free(
+		 context.utf8_string );
+	}
+	return( EXIT_FAILURE );
+}
+
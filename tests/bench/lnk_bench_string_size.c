@@ -0,0 +1,418 @@
+/*
+ * Benchmarks the end of string character search functions
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_bench_functions.h"
+#include "lnk_test_getopt.h"
+#include "lnk_test_libcerror.h"
+
+#include "../../liblnk/liblnk_string_size.h"
+
+/* The UNC path prefix and the path segment that is repeated
+ */
+#define LNK_BENCH_STRING_SIZE_PREFIX	"\\\\fileserver.example.com\\department share\\"
+#define LNK_BENCH_STRING_SIZE_SEGMENT	"Project Documents\\"
+
+/* Prints usage information
+ */
+void lnk_bench_string_size_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use lnk_bench_string_size to compare the end of string character\n"
+	                 "search functions with a byte by byte search on a long UNC path.\n\n" );
+
+	fprintf( stream, "Usage: lnk_bench_string_size [ -i iterations ] [ -s size ] [ -h ]\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     number of iterations, default is 100000\n" );
+	fprintf( stream, "\t-s:     number of characters in the path, default is 4096\n" );
+}
+
+/* Determines the size of a string in a byte stream byte by byte
+ * Returns the size of the string including the end of string character
+ */
+size_t lnk_bench_string_size_scalar_byte_stream(
+        const uint8_t *byte_stream,
+        size_t byte_stream_size )
+{
+	size_t string_size = 0;
+
+	for( string_size = 0;
+	     string_size < byte_stream_size;
+	     string_size++ )
+	{
+		if( byte_stream[ string_size ] == 0 )
+		{
+			string_size++;
+			break;
+		}
+	}
+	return( string_size );
+}
+
+/* Determines the size of a string in an UTF-16 stream code unit by code unit
+ * Returns the size of the string including the end of string character
+ */
+size_t lnk_bench_string_size_scalar_utf16_stream(
+        const uint8_t *utf16_stream,
+        size_t utf16_stream_size )
+{
+	size_t string_size = 0;
+
+	for( string_size = 0;
+	     ( string_size + 1 ) < utf16_stream_size;
+	     string_size += 2 )
+	{
+		if( ( utf16_stream[ string_size ] == 0 )
+		 && ( utf16_stream[ string_size + 1 ] == 0 ) )
+		{
+			string_size += 2;
+			break;
+		}
+	}
+	return( string_size );
+}
+
+/* Prints the result of a benchmark
+ */
+void lnk_bench_string_size_result_fprint(
+      FILE *stream,
+      const char *variant,
+      size_t string_size,
+      int number_of_iterations,
+      uint64_t elapsed_time )
+{
+	fprintf(
+	 stream,
+	 "benchmark=string_size variant=%s string_size=%" PRIzd " operations=%d elapsed_ns=%" PRIu64 " ns_per_op=%.2f bytes_per_ns=%.2f\n",
+	 variant,
+	 string_size,
+	 number_of_iterations,
+	 elapsed_time,
+	 ( number_of_iterations > 0 ) ? (double) elapsed_time / (double) number_of_iterations : 0.0,
+	 ( elapsed_time > 0 ) ? ( (double) string_size * (double) number_of_iterations ) / (double) elapsed_time : 0.0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	const char *prefix       = LNK_BENCH_STRING_SIZE_PREFIX;
+	const char *segment      = LNK_BENCH_STRING_SIZE_SEGMENT;
+	libcerror_error_t *error = NULL;
+	uint8_t *byte_stream     = NULL;
+	uint8_t *utf16_stream    = NULL;
+	system_integer_t option  = 0;
+	size_t byte_stream_size  = 0;
+	size_t prefix_length     = 0;
+	size_t segment_length    = 0;
+	size_t string_index      = 0;
+	size_t string_size       = 0;
+	size_t utf16_stream_size = 0;
+	uint64_t end_time        = 0;
+	uint64_t start_time      = 0;
+	uint64_t checksum        = 0;
+	int iteration            = 0;
+	int number_of_characters = 4096;
+	int number_of_iterations = 100000;
+
+	while( ( option = lnk_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hi:s:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 'h':
+				lnk_bench_string_size_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				if( lnk_bench_get_integer(
+				     optarg,
+				     &number_of_iterations ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid number of iterations: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 's':
+				if( ( lnk_bench_get_integer(
+				       optarg,
+				       &number_of_characters ) != 1 )
+				 || ( number_of_characters < 1 )
+				 || ( number_of_characters > 32767 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Invalid number of characters: %" PRIs_SYSTEM ".\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				lnk_bench_string_size_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+		}
+	}
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+	byte_stream_size  = (size_t) number_of_characters + 1;
+	utf16_stream_size = byte_stream_size * 2;
+
+	byte_stream = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * byte_stream_size );
+
+	if( byte_stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create byte stream.\n" );
+
+		goto on_error;
+	}
+	utf16_stream = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * utf16_stream_size );
+
+	if( utf16_stream == NULL )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create UTF-16 stream.\n" );
+
+		goto on_error;
+	}
+	prefix_length  = narrow_string_length( prefix );
+	segment_length = narrow_string_length( segment );
+
+	for( string_index = 0;
+	     string_index < (size_t) number_of_characters;
+	     string_index++ )
+	{
+		if( string_index < prefix_length )
+		{
+			byte_stream[ string_index ] = (uint8_t) prefix[ string_index ];
+		}
+		else
+		{
+			byte_stream[ string_index ] = (uint8_t) segment[ ( string_index - prefix_length ) % segment_length ];
+		}
+		utf16_stream[ string_index * 2 ]         = byte_stream[ string_index ];
+		utf16_stream[ ( string_index * 2 ) + 1 ] = 0;
+	}
+	byte_stream[ number_of_characters ]              = 0;
+	utf16_stream[ number_of_characters * 2 ]         = 0;
+	utf16_stream[ ( number_of_characters * 2 ) + 1 ] = 0;
+
+	/* Byte stream
+	 */
+	lnk_bench_get_time(
+	 &start_time );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		checksum += lnk_bench_string_size_scalar_byte_stream(
+		             byte_stream,
+		             byte_stream_size );
+	}
+	lnk_bench_get_time(
+	 &end_time );
+
+	lnk_bench_string_size_result_fprint(
+	 stdout,
+	 "byte_stream_scalar",
+	 byte_stream_size,
+	 number_of_iterations,
+	 end_time - start_time );
+
+	lnk_bench_get_time(
+	 &start_time );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( liblnk_string_size_from_byte_stream(
+		     byte_stream,
+		     byte_stream_size,
+		     &string_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine byte stream string size.\n" );
+
+			goto on_error;
+		}
+		checksum += string_size;
+	}
+	lnk_bench_get_time(
+	 &end_time );
+
+	lnk_bench_string_size_result_fprint(
+	 stdout,
+	 "byte_stream",
+	 byte_stream_size,
+	 number_of_iterations,
+	 end_time - start_time );
+
+	/* UTF-16 stream
+	 */
+	lnk_bench_get_time(
+	 &start_time );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		checksum += lnk_bench_string_size_scalar_utf16_stream(
+		             utf16_stream,
+		             utf16_stream_size );
+	}
+	lnk_bench_get_time(
+	 &end_time );
+
+	lnk_bench_string_size_result_fprint(
+	 stdout,
+	 "utf16_stream_scalar",
+	 utf16_stream_size,
+	 number_of_iterations,
+	 end_time - start_time );
+
+	lnk_bench_get_time(
+	 &start_time );
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		if( liblnk_string_size_from_utf16_stream(
+		     utf16_stream,
+		     utf16_stream_size,
+		     &string_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to determine UTF-16 stream string size.\n" );
+
+			goto on_error;
+		}
+		checksum += string_size;
+	}
+	lnk_bench_get_time(
+	 &end_time );
+
+	lnk_bench_string_size_result_fprint(
+	 stdout,
+	 "utf16_stream",
+	 utf16_stream_size,
+	 number_of_iterations,
+	 end_time - start_time );
+
+	/* The checksum prevents the compiler from optimizing the loops away
+	 */
+	if( checksum != ( (uint64_t) number_of_iterations * 2 * ( byte_stream_size + utf16_stream_size ) ) )
+	{
+		fprintf(
+		 stderr,
+		 "Mismatch in string sizes.\n" );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf16_stream );
+
+	memory_free(
+	 byte_stream );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( utf16_stream != NULL )
+	{
+		memory_free(
+		 utf16_stream );
+	}
+	if( byte_stream != NULL )
+	{
+		memory_free(
+		 byte_stream );
+	}
+	return( EXIT_FAILURE );
+
+#else
+	fprintf(
+	 stderr,
+	 "Internal functions are not available.\n" );
+
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+}
+
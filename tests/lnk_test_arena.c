@@ -0,0 +1,714 @@
+/*
+ * Library arena type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_test_libcerror.h"
+#include "lnk_test_liblnk.h"
+#include "lnk_test_macros.h"
+#include "lnk_test_memory.h"
+#include "lnk_test_unused.h"
+
+#include "../liblnk/liblnk_arena.h"
+#include "../liblnk/liblnk_definitions.h"
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+/* Tests the liblnk_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	liblnk_arena_t *arena           = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_LNK_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = liblnk_arena_initialize(
+	          &arena,
+	          LIBLNK_ARENA_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_arena_free(
+	          &arena,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_arena_initialize(
+	          NULL,
+	          LIBLNK_ARENA_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (liblnk_arena_t *) 0x12345678UL;
+
+	result = liblnk_arena_initialize(
+	          &arena,
+	          LIBLNK_ARENA_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	arena = NULL;
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_LNK_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test liblnk_arena_initialize with malloc failing
+		 */
+		lnk_test_malloc_attempts_before_fail = test_number;
+
+		result = liblnk_arena_initialize(
+		          &arena,
+		          LIBLNK_ARENA_DEFAULT_BLOCK_SIZE,
+		          &error );
+
+		if( lnk_test_malloc_attempts_before_fail != -1 )
+		{
+			lnk_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				liblnk_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			LNK_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			LNK_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test liblnk_arena_initialize with memset failing
+		 */
+		lnk_test_memset_attempts_before_fail = test_number;
+
+		result = liblnk_arena_initialize(
+		          &arena,
+		          LIBLNK_ARENA_DEFAULT_BLOCK_SIZE,
+		          &error );
+
+		if( lnk_test_memset_attempts_before_fail != -1 )
+		{
+			lnk_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				liblnk_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			LNK_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			LNK_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_LNK_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		liblnk_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = liblnk_arena_free(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_arena_allocate(
+     liblnk_arena_t *arena )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *first_memory    = NULL;
+	uint8_t *memory          = NULL;
+	size_t memory_index      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_arena_allocate(
+	          arena,
+	          3,
+	          (void **) &first_memory,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "first_memory",
+	 first_memory );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "first_memory alignment",
+	 (int) ( (intptr_t) first_memory % LIBLNK_ARENA_ALIGNMENT ),
+	 0 );
+
+	result = liblnk_arena_allocate(
+	          arena,
+	          5,
+	          (void **) &memory,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Subsequent allocations are aligned and do not overlap
+	 */
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "memory offset",
+	 (int) ( memory - first_memory ),
+	 LIBLNK_ARENA_ALIGNMENT );
+
+	/* Allocations larger than the block size get a block of their own
+	 */
+	result = liblnk_arena_allocate(
+	          arena,
+	          LIBLNK_ARENA_DEFAULT_BLOCK_SIZE * 2,
+	          (void **) &memory,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( memory_index = 0;
+	     memory_index < (size_t) ( LIBLNK_ARENA_DEFAULT_BLOCK_SIZE * 2 );
+	     memory_index++ )
+	{
+		if( memory[ memory_index ] != 0 )
+		{
+			break;
+		}
+	}
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "memory_index",
+	 memory_index,
+	 (size_t) ( LIBLNK_ARENA_DEFAULT_BLOCK_SIZE * 2 ) );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_allocations",
+	 arena->number_of_allocations,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = liblnk_arena_allocate(
+	          NULL,
+	          8,
+	          (void **) &memory,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_arena_allocate(
+	          arena,
+	          0,
+	          (void **) &memory,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_arena_allocate(
+	          arena,
+	          (size_t) SSIZE_MAX + 1,
+	          (void **) &memory,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_arena_allocate(
+	          arena,
+	          8,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_arena_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_arena_clear(
+     liblnk_arena_t *arena )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t *memory          = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_arena_clear(
+	          arena,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "arena->number_of_allocations",
+	 arena->number_of_allocations,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "arena->first_block",
+	 arena->first_block );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "arena->first_block->next_block",
+	 arena->first_block->next_block );
+
+	/* The blocks are reused after clear
+	 */
+	result = liblnk_arena_allocate(
+	          arena,
+	          8,
+	          (void **) &memory,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "memory",
+	 (int) ( memory == arena->first_block->data ),
+	 1 );
+
+	result = liblnk_arena_allocate(
+	          arena,
+	          LIBLNK_ARENA_DEFAULT_BLOCK_SIZE * 2,
+	          (void **) &memory,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "memory",
+	 (int) ( memory == arena->first_block->next_block->data ),
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "arena->first_block->next_block->next_block",
+	 arena->first_block->next_block->next_block );
+
+	/* Test error cases
+	 */
+	result = liblnk_arena_clear(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+	libcerror_error_t *error = NULL;
+	liblnk_arena_t *arena    = NULL;
+	int result               = 0;
+#endif
+
+	LNK_TEST_UNREFERENCED_PARAMETER( argc )
+	LNK_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+	LNK_TEST_RUN(
+	 "liblnk_arena_initialize",
+	 lnk_test_arena_initialize );
+
+	LNK_TEST_RUN(
+	 "liblnk_arena_free",
+	 lnk_test_arena_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize arena for tests
+	 */
+	result = liblnk_arena_initialize(
+	          &arena,
+	          LIBLNK_ARENA_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_arena_allocate",
+	 lnk_test_arena_allocate,
+	 arena );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_arena_clear",
+	 lnk_test_arena_clear,
+	 arena );
+
+	/* Clean up
+	 */
+	result = liblnk_arena_free(
+	          &arena,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+on_error:
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		liblnk_arena_free(
+		 &arena,
+		 NULL );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1208 @@
+/*
+ * Library batch type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_test_functions.h"
+#include "lnk_test_getopt.h"
+#include "lnk_test_libbfio.h"
+#include "lnk_test_libcerror.h"
+#include "lnk_test_liblnk.h"
+#include "lnk_test_macros.h"
+#include "lnk_test_memory.h"
+#include "lnk_test_unused.h"
+
+#define LNK_TEST_BATCH_MAXIMUM_NUMBER_OF_RESULTS	8
+
+typedef struct lnk_test_batch_results lnk_test_batch_results_t;
+
+struct lnk_test_batch_results
+{
+	/* The entry indexes in the order they were passed
+	 */
+	int entry_indexes[ LNK_TEST_BATCH_MAXIMUM_NUMBER_OF_RESULTS ];
+
+	/* Values to indicate a file was passed
+	 */
+	int has_file[ LNK_TEST_BATCH_MAXIMUM_NUMBER_OF_RESULTS ];
+
+	/* Values to indicate an open error was passed
+	 */
+	int has_open_error[ LNK_TEST_BATCH_MAXIMUM_NUMBER_OF_RESULTS ];
+
+	/* Values to indicate the entry function was called, by entry index
+	 */
+	int has_entry_function_call[ LNK_TEST_BATCH_MAXIMUM_NUMBER_OF_RESULTS ];
+
+	/* The number of results
+	 */
+	int number_of_results;
+
+	/* The number of results after which to abort
+	 */
+	int abort_after;
+};
+
+/* Records a batch result
+ * Returns 1 to continue or 0 to abort
+ */
+int lnk_test_batch_record_result(
+     int entry_index,
+     liblnk_file_t *file,
+     libcerror_error_t *open_error,
+     void *callback_function_arguments )
+{
+	lnk_test_batch_results_t *results = NULL;
+
+	results = (lnk_test_batch_results_t *) callback_function_arguments;
+
+	if( results->number_of_results < LNK_TEST_BATCH_MAXIMUM_NUMBER_OF_RESULTS )
+	{
+		results->entry_indexes[ results->number_of_results ]  = entry_index;
+		results->has_file[ results->number_of_results ]       = (int) ( file != NULL );
+		results->has_open_error[ results->number_of_results ] = (int) ( open_error != NULL );
+	}
+	results->number_of_results += 1;
+
+	if( ( results->abort_after > 0 )
+	 && ( results->number_of_results >= results->abort_after ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Records an entry function call
+ * The entry function can be called by multiple threads at the same time,
+ * hence only the value of the entry index is changed
+ * Returns 1 to continue
+ */
+int lnk_test_batch_record_entry_function_call(
+     int entry_index,
+     liblnk_file_t *file,
+     void *callback_function_arguments )
+{
+	lnk_test_batch_results_t *results = NULL;
+
+	results = (lnk_test_batch_results_t *) callback_function_arguments;
+
+	if( ( file != NULL )
+	 && ( entry_index >= 0 )
+	 && ( entry_index < LNK_TEST_BATCH_MAXIMUM_NUMBER_OF_RESULTS ) )
+	{
+		results->has_entry_function_call[ entry_index ] = 1;
+	}
+	return( 1 );
+}
+
+/* Tests the liblnk_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_batch_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	liblnk_batch_t *batch    = NULL;
+	int result               = 0;
+
+#if defined( HAVE_LNK_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = liblnk_batch_initialize(
+	          &batch,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_batch_free(
+	          &batch,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_batch_initialize(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	batch = (liblnk_batch_t *) 0x12345678UL;
+
+	result = liblnk_batch_initialize(
+	          &batch,
+	          &error );
+
+	batch = NULL;
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_LNK_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test liblnk_batch_initialize with malloc failing
+		 */
+		lnk_test_malloc_attempts_before_fail = test_number;
+
+		result = liblnk_batch_initialize(
+		          &batch,
+		          &error );
+
+		if( lnk_test_malloc_attempts_before_fail != -1 )
+		{
+			lnk_test_malloc_attempts_before_fail = -1;
+
+			if( batch != NULL )
+			{
+				liblnk_batch_free(
+				 &batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			LNK_TEST_ASSERT_IS_NULL(
+			 "batch",
+			 batch );
+
+			LNK_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_LNK_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		liblnk_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = liblnk_batch_free(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_batch_get_number_of_threads and liblnk_batch_set_number_of_threads functions
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_batch_number_of_threads(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	liblnk_batch_t *batch    = NULL;
+	int number_of_threads    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_batch_initialize(
+	          &batch,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_batch_get_number_of_threads(
+	          batch,
+	          &number_of_threads,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_batch_set_number_of_threads(
+	          batch,
+	          4,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_batch_get_number_of_threads(
+	          batch,
+	          &number_of_threads,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 4 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_batch_get_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_batch_get_number_of_threads(
+	          batch,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_batch_set_number_of_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_batch_set_number_of_threads(
+	          batch,
+	          -1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_batch_free(
+	          &batch,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		liblnk_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_batch_append_filename function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_batch_append_filename(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	liblnk_batch_t *batch    = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_batch_initialize(
+	          &batch,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_batch_append_filename(
+	          batch,
+	          "test.lnk",
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_batch_get_number_of_entries(
+	          batch,
+	          &number_of_entries,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_batch_append_filename(
+	          NULL,
+	          "test.lnk",
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_batch_append_filename(
+	          batch,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_batch_append_file_io_handle(
+	          batch,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_batch_free(
+	          &batch,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		liblnk_batch_free(
+		 &batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_batch_process function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_batch_process(
+     const system_character_t *source )
+{
+	uint8_t empty_block[ 128 ];
+	char narrow_source[ 256 ];
+
+	lnk_test_batch_results_t results;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	liblnk_batch_t *batch            = NULL;
+	void *memset_result              = NULL;
+	int expected_number_of_results   = 1;
+	int result                       = 0;
+	int result_index                 = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 empty_block,
+	                 0,
+	                 sizeof( uint8_t ) * 128 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = liblnk_batch_initialize(
+	          &batch,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "batch",
+	 batch );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_batch_set_number_of_threads(
+	          batch,
+	          2,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( source != NULL )
+	{
+		result = lnk_test_get_narrow_source(
+		          source,
+		          narrow_source,
+		          256,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_batch_append_filename(
+		          batch,
+		          narrow_source,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_batch_append_filename(
+		          batch,
+		          narrow_source,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		expected_number_of_results += 2;
+	}
+	/* The data of this entry does not contain a LNK file
+	 */
+	result = lnk_test_open_file_io_handle(
+	          &file_io_handle,
+	          empty_block,
+	          128,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_batch_append_file_io_handle(
+	          batch,
+	          file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test process in input order
+	 */
+	memset_result = memory_set(
+	                 &results,
+	                 0,
+	                 sizeof( lnk_test_batch_results_t ) );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = liblnk_batch_process(
+	          batch,
+	          LIBLNK_OPEN_READ,
+	          LIBLNK_BATCH_RESULT_ORDER_INPUT,
+	          &lnk_test_batch_record_result,
+	          (void *) &results,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "results.number_of_results",
+	 results.number_of_results,
+	 expected_number_of_results );
+
+	for( result_index = 0;
+	     result_index < expected_number_of_results;
+	     result_index++ )
+	{
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "results.entry_indexes[ result_index ]",
+		 results.entry_indexes[ result_index ],
+		 result_index );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "results.has_file[ result_index ]",
+		 results.has_file[ result_index ],
+		 (int) ( result_index < ( expected_number_of_results - 1 ) ) );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "results.has_open_error[ result_index ]",
+		 results.has_open_error[ result_index ],
+		 (int) ( result_index == ( expected_number_of_results - 1 ) ) );
+	}
+	/* Test process in completion order
+	 */
+	memset_result = memory_set(
+	                 &results,
+	                 0,
+	                 sizeof( lnk_test_batch_results_t ) );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = liblnk_batch_process(
+	          batch,
+	          LIBLNK_OPEN_READ,
+	          LIBLNK_BATCH_RESULT_ORDER_COMPLETION,
+	          &lnk_test_batch_record_result,
+	          (void *) &results,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "results.number_of_results",
+	 results.number_of_results,
+	 expected_number_of_results );
+
+	/* Test process aborted by the callback function
+	 */
+	memset_result = memory_set(
+	                 &results,
+	                 0,
+	                 sizeof( lnk_test_batch_results_t ) );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	results.abort_after = 1;
+
+	result = liblnk_batch_process(
+	          batch,
+	          LIBLNK_OPEN_READ,
+	          LIBLNK_BATCH_RESULT_ORDER_INPUT,
+	          &lnk_test_batch_record_result,
+	          (void *) &results,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "results.number_of_results",
+	 results.number_of_results,
+	 1 );
+
+	/* Test process with an entry function
+	 */
+	memset_result = memory_set(
+	                 &results,
+	                 0,
+	                 sizeof( lnk_test_batch_results_t ) );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = liblnk_batch_set_entry_function(
+	          batch,
+	          &lnk_test_batch_record_entry_function_call,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_batch_process(
+	          batch,
+	          LIBLNK_OPEN_READ,
+	          LIBLNK_BATCH_RESULT_ORDER_COMPLETION,
+	          &lnk_test_batch_record_result,
+	          (void *) &results,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( result_index = 0;
+	     result_index < expected_number_of_results;
+	     result_index++ )
+	{
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "results.has_entry_function_call[ result_index ]",
+		 results.has_entry_function_call[ result_index ],
+		 (int) ( result_index < ( expected_number_of_results - 1 ) ) );
+	}
+	/* Test process with an entry function and without a callback function
+	 */
+	memset_result = memory_set(
+	                 &results,
+	                 0,
+	                 sizeof( lnk_test_batch_results_t ) );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = liblnk_batch_process(
+	          batch,
+	          LIBLNK_OPEN_READ,
+	          LIBLNK_BATCH_RESULT_ORDER_INPUT,
+	          NULL,
+	          (void *) &results,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "results.number_of_results",
+	 results.number_of_results,
+	 0 );
+
+	for( result_index = 0;
+	     result_index < expected_number_of_results;
+	     result_index++ )
+	{
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "results.has_entry_function_call[ result_index ]",
+		 results.has_entry_function_call[ result_index ],
+		 (int) ( result_index < ( expected_number_of_results - 1 ) ) );
+	}
+	result = liblnk_batch_set_entry_function(
+	          batch,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_batch_set_entry_function(
+	          NULL,
+	          &lnk_test_batch_record_entry_function_call,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_batch_process(
+	          NULL,
+	          LIBLNK_OPEN_READ,
+	          LIBLNK_BATCH_RESULT_ORDER_INPUT,
+	          &lnk_test_batch_record_result,
+	          (void *) &results,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_batch_process(
+	          batch,
+	          LIBLNK_OPEN_READ,
+	          -1,
+	          &lnk_test_batch_record_result,
+	          (void *) &results,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_batch_free(
+	          &batch,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "batch",
+	 batch );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = lnk_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( batch != NULL )
+	{
+		liblnk_batch_free(
+		 &batch,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+
+	while( ( option = lnk_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	LNK_TEST_RUN(
+	 "liblnk_batch_initialize",
+	 lnk_test_batch_initialize );
+
+	LNK_TEST_RUN(
+	 "liblnk_batch_free",
+	 lnk_test_batch_free );
+
+	LNK_TEST_RUN(
+	 "liblnk_batch_get_number_of_threads",
+	 lnk_test_batch_number_of_threads );
+
+	LNK_TEST_RUN(
+	 "liblnk_batch_append_filename",
+	 lnk_test_batch_append_filename );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_batch_process",
+	 lnk_test_batch_process,
+	 source );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -481,6 +482,317 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the liblnk_data_block_read_buffer function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_data_block_read_buffer(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	liblnk_data_block_t *data_block = NULL;
+	liblnk_io_handle_t *io_handle   = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_data_block_initialize(
+	          &data_block,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_data_block_read_buffer(
+	          data_block,
+	          io_handle,
+	          lnk_test_data_block_data1,
+	          788,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_UINT32(
+	 "data_block->size",
+	 ( (liblnk_internal_data_block_t *) data_block )->size,
+	 (uint32_t) 788 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT32(
+	 "data_block->signature",
+	 ( (liblnk_internal_data_block_t *) data_block )->signature,
+	 (uint32_t) 0xa0000001UL );
+
+	/* Test error cases
+	 */
+	result = liblnk_data_block_read_buffer(
+	          data_block,
+	          io_handle,
+	          lnk_test_data_block_data1,
+	          788,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_internal_data_block_free(
+	          (liblnk_internal_data_block_t **) &data_block,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "data_block",
+	 data_block );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = liblnk_data_block_initialize(
+	          &data_block,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_data_block_read_buffer(
+	          NULL,
+	          io_handle,
+	          lnk_test_data_block_data1,
+	          788,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_data_block_read_buffer(
+	          data_block,
+	          NULL,
+	          lnk_test_data_block_data1,
+	          788,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_data_block_read_buffer(
+	          data_block,
+	          io_handle,
+	          NULL,
+	          788,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_data_block_read_buffer(
+	          data_block,
+	          io_handle,
+	          lnk_test_data_block_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_data_block_read_buffer(
+	          data_block,
+	          io_handle,
+	          lnk_test_data_block_data1,
+	          0,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data block size exceeding the buffer size
+	 */
+	result = liblnk_data_block_read_buffer(
+	          data_block,
+	          io_handle,
+	          lnk_test_data_block_data1,
+	          8,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_internal_data_block_free(
+	          (liblnk_internal_data_block_t **) &data_block,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "data_block",
+	 data_block );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block != NULL )
+	{
+		liblnk_internal_data_block_free(
+		 (liblnk_internal_data_block_t **) &data_block,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		liblnk_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the liblnk_data_block_read_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
@@ -834,6 +1146,242 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the liblnk_data_block_get_data function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_data_block_get_data(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	liblnk_data_block_t *data_block = NULL;
+	liblnk_io_handle_t *io_handle   = NULL;
+	const uint8_t *data             = NULL;
+	size_t data_size                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_data_block_initialize(
+	          &data_block,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case with data block without data
+	 */
+	result = liblnk_data_block_get_data(
+	          data_block,
+	          &data,
+	          &data_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_data_block_read_buffer(
+	          data_block,
+	          io_handle,
+	          lnk_test_data_block_data1,
+	          788,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_data_block_get_data(
+	          data_block,
+	          &data,
+	          &data_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 780 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( lnk_test_data_block_data1[ 8 ] ),
+	          780 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = liblnk_data_block_get_data(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_data_block_get_data(
+	          data_block,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_data_block_get_data(
+	          data_block,
+	          &data,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_internal_data_block_free(
+	          (liblnk_internal_data_block_t **) &data_block,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "data_block",
+	 data_block );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block != NULL )
+	{
+		liblnk_internal_data_block_free(
+		 (liblnk_internal_data_block_t **) &data_block,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		liblnk_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
 
 /* The main program
@@ -865,10 +1413,18 @@ int main(
 	 "liblnk_data_block_read_data",
 	 lnk_test_data_block_read_data );
 
+	LNK_TEST_RUN(
+	 "liblnk_data_block_read_buffer",
+	 lnk_test_data_block_read_buffer );
+
 	LNK_TEST_RUN(
 	 "liblnk_data_block_read_file_io_handle",
 	 lnk_test_data_block_read_file_io_handle );
 
+	LNK_TEST_RUN(
+	 "liblnk_data_block_get_data",
+	 lnk_test_data_block_get_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -35,6 +36,7 @@
 #include "lnk_test_unused.h"
 
 #include "../liblnk/liblnk_data_string.h"
+#include "../liblnk/liblnk_definitions.h"
 #include "../liblnk/liblnk_io_handle.h"
 
 uint8_t lnk_test_data_string_data1[ 60 ] = {
@@ -278,6 +280,192 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the liblnk_data_string_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_data_string_clear(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	liblnk_data_string_t *data_string = NULL;
+	liblnk_io_handle_t *io_handle     = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->is_unicode = 1;
+
+	result = liblnk_data_string_initialize(
+	          &data_string,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "data_string",
+	 data_string );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_data_string_read_data(
+	          data_string,
+	          io_handle,
+	          lnk_test_data_string_data1,
+	          60,
+	          0,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_data_string_clear(
+	          data_string,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "data_string->data",
+	 data_string->data );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "data_string->data_size",
+	 data_string->data_size,
+	 (size_t) 0 );
+
+	/* The data string can be read again after it was cleared
+	 */
+	result = liblnk_data_string_read_data(
+	          data_string,
+	          io_handle,
+	          lnk_test_data_string_data1,
+	          60,
+	          0,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_data_string_clear(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_data_string_free(
+	          &data_string,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "data_string",
+	 data_string );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_string != NULL )
+	{
+		liblnk_data_string_free(
+		 &data_string,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		liblnk_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the liblnk_data_string_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -1291,6 +1479,253 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the liblnk_data_string_cache_string function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_data_string_cache_string(
+     liblnk_data_string_t *data_string )
+{
+	uint8_t cached_utf8_string[ 64 ];
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t cached_utf8_string_size = 0;
+	size_t utf8_string_size        = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_data_string_get_utf8_string_size(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          &utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_data_string_get_utf8_string(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          utf8_string,
+	          64,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_data_string_cache_string(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8,
+	          0,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_data_string_has_cached_string(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8,
+	          0 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = liblnk_data_string_has_cached_string(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_DATA_STRING_FORMAT_UTF16,
+	          0 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = liblnk_data_string_get_utf8_string_size(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          &cached_utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_utf8_string_size",
+	 cached_utf8_string_size,
+	 utf8_string_size );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_data_string_get_utf8_string(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          cached_utf8_string,
+	          64,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          cached_utf8_string,
+	          utf8_string,
+	          utf8_string_size );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test get UTF-8 string with a cached string and a buffer that is too small
+	 */
+	result = liblnk_data_string_get_utf8_string(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          cached_utf8_string,
+	          1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test clear cache
+	 */
+	result = liblnk_data_string_clear_cache(
+	          data_string,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_data_string_has_cached_string(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8,
+	          0 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = liblnk_data_string_cache_string(
+	          NULL,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8,
+	          0,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_data_string_cache_string(
+	          data_string,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          -1,
+	          0,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_data_string_clear_cache(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
 
 /* The main program
@@ -1325,6 +1760,10 @@ int main(
 	 "liblnk_data_string_free",
 	 lnk_test_data_string_free );
 
+	LNK_TEST_RUN(
+	 "liblnk_data_string_clear",
+	 lnk_test_data_string_clear );
+
 	LNK_TEST_RUN(
 	 "liblnk_data_string_read_data",
 	 lnk_test_data_string_read_data );
@@ -1412,6 +1851,11 @@ int main(
 	 lnk_test_data_string_get_utf16_string,
 	 data_string );
 
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_data_string_cache_string",
+	 lnk_test_data_string_cache_string,
+	 data_string );
+
 	/* Clean up
 	 */
 	result = liblnk_data_string_free(
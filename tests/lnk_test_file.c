@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -597,25 +598,26 @@ on_error:
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the liblnk_file_open_wide function
+/* Tests the liblnk_file_open function with memory mapping
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_open_wide(
+int lnk_test_file_open_memory_map(
      const system_character_t *source )
 {
-	wchar_t wide_source[ 256 ];
+	char narrow_source[ 256 ];
 
-	libcerror_error_t *error = NULL;
-	liblnk_file_t *file      = NULL;
-	int result               = 0;
+	libcerror_error_t *error   = NULL;
+	liblnk_file_t *file        = NULL;
+	liblnk_file_t *mapped_file = NULL;
+	size64_t data_size         = 0;
+	size64_t mapped_data_size  = 0;
+	int result                 = 0;
 
 	/* Initialize test
 	 */
-	result = lnk_test_get_wide_source(
+	result = lnk_test_get_narrow_source(
 	          source,
-	          wide_source,
+	          narrow_source,
 	          256,
 	          &error );
 
@@ -645,11 +647,9 @@ int lnk_test_file_open_wide(
 	 "error",
 	 error );
 
-	/* Test open
-	 */
-	result = liblnk_file_open_wide(
+	result = liblnk_file_open(
 	          file,
-	          wide_source,
+	          narrow_source,
 	          LIBLNK_OPEN_READ,
 	          &error );
 
@@ -662,68 +662,82 @@ int lnk_test_file_open_wide(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = liblnk_file_open_wide(
-	          NULL,
-	          wide_source,
-	          LIBLNK_OPEN_READ,
+	result = liblnk_file_initialize(
+	          &mapped_file,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = liblnk_file_open_wide(
-	          file,
-	          NULL,
-	          LIBLNK_OPEN_READ,
+	/* Test open with memory mapping, which falls back to reading
+	 * the file if memory mapping is not supported
+	 */
+	result = liblnk_file_open(
+	          mapped_file,
+	          narrow_source,
+	          LIBLNK_OPEN_READ | LIBLNK_ACCESS_FLAG_MEMORY_MAP,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
+	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = liblnk_file_open_wide(
+	/* Test if the memory mapped file is parsed the same as the read file
+	 */
+	result = liblnk_file_get_data_size(
 	          file,
-	          wide_source,
-	          -1,
+	          &data_size,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
+	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = liblnk_file_get_data_size(
+	          mapped_file,
+	          &mapped_data_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_data_size",
+	 (uint64_t) mapped_data_size,
+	 (uint64_t) data_size );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test open when already opened
 	 */
-	result = liblnk_file_open_wide(
-	          file,
-	          wide_source,
-	          LIBLNK_OPEN_READ,
+	result = liblnk_file_open(
+	          mapped_file,
+	          narrow_source,
+	          LIBLNK_OPEN_READ | LIBLNK_ACCESS_FLAG_MEMORY_MAP,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -740,6 +754,36 @@ int lnk_test_file_open_wide(
 
 	/* Clean up
 	 */
+	result = liblnk_file_close(
+	          mapped_file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_free(
+	          &mapped_file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = liblnk_file_free(
 	          &file,
 	          &error );
@@ -765,6 +809,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( mapped_file != NULL )
+	{
+		liblnk_file_free(
+		 &mapped_file,
+		 NULL );
+	}
 	if( file != NULL )
 	{
 		liblnk_file_free(
@@ -774,55 +824,36 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
-
-/* Tests the liblnk_file_open_file_io_handle function
+/* Tests the liblnk_file_open function with lazy data blocks
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_open_file_io_handle(
+int lnk_test_file_open_lazy_data_blocks(
      const system_character_t *source )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	liblnk_file_t *file              = NULL;
-	size_t string_length             = 0;
-	int result                       = 0;
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error             = NULL;
+	liblnk_data_block_t *data_block      = NULL;
+	liblnk_data_block_t *lazy_data_block = NULL;
+	liblnk_file_t *file                  = NULL;
+	liblnk_file_t *lazy_file             = NULL;
+	size_t data_size                     = 0;
+	size_t lazy_data_size                = 0;
+	uint32_t lazy_signature              = 0;
+	uint32_t signature                   = 0;
+	int data_block_index                 = 0;
+	int lazy_number_of_data_blocks       = 0;
+	int number_of_data_blocks            = 0;
+	int result                           = 0;
 
 	/* Initialize test
 	 */
-	result = libbfio_file_initialize(
-	          &file_io_handle,
-	          &error );
-
-	LNK_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	LNK_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	LNK_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	string_length = system_string_length(
-	                 source );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libbfio_file_set_name_wide(
-	          file_io_handle,
-	          source,
-	          string_length,
-	          &error );
-#else
-	result = libbfio_file_set_name(
-	          file_io_handle,
+	result = lnk_test_get_narrow_source(
 	          source,
-	          string_length,
+	          narrow_source,
+	          256,
 	          &error );
-#endif
+
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -849,11 +880,9 @@ int lnk_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test open
-	 */
-	result = liblnk_file_open_file_io_handle(
+	result = liblnk_file_open(
 	          file,
-	          file_io_handle,
+	          narrow_source,
 	          LIBLNK_OPEN_READ,
 	          &error );
 
@@ -866,86 +895,73 @@ int lnk_test_file_open_file_io_handle(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = liblnk_file_open_file_io_handle(
-	          NULL,
-	          file_io_handle,
-	          LIBLNK_OPEN_READ,
+	result = liblnk_file_initialize(
+	          &lazy_file,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "lazy_file",
+	 lazy_file );
+
+	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = liblnk_file_open_file_io_handle(
-	          file,
-	          NULL,
-	          LIBLNK_OPEN_READ,
+	/* Disable the single read so that the data blocks are read from the file IO handle on demand
+	 */
+	result = liblnk_file_set_maximum_read_buffer_size(
+	          lazy_file,
+	          0,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
+	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = liblnk_file_open_file_io_handle(
-	          file,
-	          file_io_handle,
-	          -1,
+	result = liblnk_file_open(
+	          lazy_file,
+	          narrow_source,
+	          LIBLNK_OPEN_READ | LIBLNK_ACCESS_FLAG_LAZY_DATA_BLOCKS,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
+	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Test open when already opened
+	/* Test if the data blocks read on demand match the data blocks read on open
 	 */
-	result = liblnk_file_open_file_io_handle(
+	result = liblnk_file_get_number_of_data_blocks(
 	          file,
-	          file_io_handle,
-	          LIBLNK_OPEN_READ,
+	          &number_of_data_blocks,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
+	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	/* Clean up
-	 */
-	result = liblnk_file_free(
-	          &file,
+	result = liblnk_file_get_number_of_data_blocks(
+	          lazy_file,
+	          &lazy_number_of_data_blocks,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -953,66 +969,2449 @@ int lnk_test_file_open_file_io_handle(
 	 result,
 	 1 );
 
-	LNK_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "lazy_number_of_data_blocks",
+	 lazy_number_of_data_blocks,
+	 number_of_data_blocks );
 
 	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libbfio_handle_free(
-	          &file_io_handle,
-	          &error );
+	for( data_block_index = 0;
+	     data_block_index < number_of_data_blocks;
+	     data_block_index++ )
+	{
+		result = liblnk_file_get_data_block_by_index(
+		          file,
+		          data_block_index,
+		          &data_block,
+		          &error );
 
-	LNK_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	LNK_TEST_ASSERT_IS_NULL(
-	 "file_io_handle",
-	 file_io_handle );
+		LNK_TEST_ASSERT_IS_NOT_NULL(
+		 "data_block",
+		 data_block );
 
-	LNK_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	return( 1 );
+		result = liblnk_file_get_data_block_by_index(
+		          lazy_file,
+		          data_block_index,
+		          &lazy_data_block,
+		          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( file != NULL )
-	{
-		liblnk_file_free(
-		 &file,
-		 NULL );
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NOT_NULL(
+		 "lazy_data_block",
+		 lazy_data_block );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_data_block_get_signature(
+		          data_block,
+		          &signature,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_data_block_get_signature(
+		          lazy_data_block,
+		          &lazy_signature,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_EQUAL_UINT32(
+		 "lazy_signature",
+		 lazy_signature,
+		 signature );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_data_block_get_data_size(
+		          data_block,
+		          &data_size,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_data_block_get_data_size(
+		          lazy_data_block,
+		          &lazy_data_size,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_EQUAL_SIZE(
+		 "lazy_data_size",
+		 lazy_data_size,
+		 data_size );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_data_block_free(
+		          &lazy_data_block,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_data_block_free(
+		          &data_block,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = liblnk_file_close(
+	          lazy_file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_free(
+	          &lazy_file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "lazy_file",
+	 lazy_file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_close(
+	          file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_free(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( lazy_data_block != NULL )
+	{
+		liblnk_data_block_free(
+		 &lazy_data_block,
+		 NULL );
+	}
+	if( data_block != NULL )
+	{
+		liblnk_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	if( lazy_file != NULL )
+	{
+		liblnk_file_free(
+		 &lazy_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the liblnk_file_open function with an arena
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_open_arena(
+     const system_character_t *source )
+{
+	uint8_t arena_utf8_string[ 512 ];
+	uint8_t utf8_string[ 512 ];
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error        = NULL;
+	liblnk_file_t *arena_file       = NULL;
+	liblnk_file_t *file             = NULL;
+	size64_t arena_data_size        = 0;
+	size64_t data_size              = 0;
+	size_t arena_utf8_string_size   = 0;
+	size_t utf8_string_size         = 0;
+	int arena_number_of_data_blocks = 0;
+	int arena_result                = 0;
+	int number_of_data_blocks       = 0;
+	int open_iterator               = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = lnk_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_initialize(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_open(
+	          file,
+	          narrow_source,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_get_data_size(
+	          file,
+	          &data_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_get_number_of_data_blocks(
+	          file,
+	          &number_of_data_blocks,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_get_utf8_string(
+	          file,
+	          LIBLNK_STRING_IDENTIFIER_DESCRIPTION,
+	          utf8_string,
+	          512,
+	          &utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_initialize(
+	          &arena_file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "arena_file",
+	 arena_file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Open the file twice to test if the arena is released on close
+	 */
+	for( open_iterator = 0;
+	     open_iterator < 2;
+	     open_iterator++ )
+	{
+		arena_result = liblnk_file_open(
+		                arena_file,
+		                narrow_source,
+		                LIBLNK_OPEN_READ | LIBLNK_ACCESS_FLAG_USE_ARENA,
+		                &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "arena_result",
+		 arena_result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test if the values parsed into the arena match the values parsed without
+		 */
+		arena_result = liblnk_file_get_data_size(
+		                arena_file,
+		                &arena_data_size,
+		                &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "arena_result",
+		 arena_result,
+		 1 );
+
+		LNK_TEST_ASSERT_EQUAL_UINT64(
+		 "arena_data_size",
+		 (uint64_t) arena_data_size,
+		 (uint64_t) data_size );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		arena_result = liblnk_file_get_number_of_data_blocks(
+		                arena_file,
+		                &arena_number_of_data_blocks,
+		                &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "arena_result",
+		 arena_result,
+		 1 );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "arena_number_of_data_blocks",
+		 arena_number_of_data_blocks,
+		 number_of_data_blocks );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		arena_result = liblnk_file_get_utf8_string(
+		                arena_file,
+		                LIBLNK_STRING_IDENTIFIER_DESCRIPTION,
+		                arena_utf8_string,
+		                512,
+		                &arena_utf8_string_size,
+		                &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "arena_result",
+		 arena_result,
+		 result );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( ( result == 1 )
+		 && ( utf8_string_size <= 512 ) )
+		{
+			LNK_TEST_ASSERT_EQUAL_SIZE(
+			 "arena_utf8_string_size",
+			 arena_utf8_string_size,
+			 utf8_string_size );
+
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "arena_utf8_string",
+			 memory_compare(
+			  arena_utf8_string,
+			  utf8_string,
+			  utf8_string_size ),
+			 0 );
+		}
+		arena_result = liblnk_file_close(
+		                arena_file,
+		                &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "arena_result",
+		 arena_result,
+		 0 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = liblnk_file_free(
+	          &arena_file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "arena_file",
+	 arena_file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_close(
+	          file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_free(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena_file != NULL )
+	{
+		liblnk_file_free(
+		 &arena_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_open function with retained capacity
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_open_retain_capacity(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	liblnk_arena_t *arena    = NULL;
+	libcerror_error_t *error = NULL;
+	liblnk_file_t *file      = NULL;
+	size64_t data_size       = 0;
+	size64_t first_data_size = 0;
+	uint8_t retain_capacity  = 0;
+	int open_iterator        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = lnk_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_initialize(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_set_retain_capacity(
+	          file,
+	          1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_get_retain_capacity(
+	          file,
+	          &retain_capacity,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT8(
+	 "retain_capacity",
+	 retain_capacity,
+	 (uint8_t) 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the memory retained on close is reused by the next open
+	 */
+	for( open_iterator = 0;
+	     open_iterator < 3;
+	     open_iterator++ )
+	{
+		result = liblnk_file_open(
+		          file,
+		          narrow_source,
+		          LIBLNK_OPEN_READ | LIBLNK_ACCESS_FLAG_USE_ARENA,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "file->retained_file_io_handle",
+		 ( (liblnk_internal_file_t *) file )->retained_file_io_handle );
+
+		if( open_iterator == 0 )
+		{
+			arena = ( (liblnk_internal_file_t *) file )->arena;
+		}
+		else
+		{
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "file->arena",
+			 (int) ( ( (liblnk_internal_file_t *) file )->arena == arena ),
+			 1 );
+		}
+		result = liblnk_file_get_data_size(
+		          file,
+		          &data_size,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( open_iterator == 0 )
+		{
+			first_data_size = data_size;
+		}
+		else
+		{
+			LNK_TEST_ASSERT_EQUAL_UINT64(
+			 "data_size",
+			 (uint64_t) data_size,
+			 (uint64_t) first_data_size );
+		}
+		result = liblnk_file_close(
+		          file,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = liblnk_file_get_retain_capacity(
+	          NULL,
+	          &retain_capacity,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_get_retain_capacity(
+	          file,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_set_retain_capacity(
+	          NULL,
+	          1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_set_retain_capacity(
+	          file,
+	          2,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_file_free(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_open function with a field mask
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_open_field_mask(
+     const system_character_t *source )
+{
+	char narrow_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	liblnk_file_t *file      = NULL;
+	size64_t data_size       = 0;
+	size64_t full_data_size  = 0;
+	uint32_t field_mask      = 0;
+	int open_iterator        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = lnk_test_get_narrow_source(
+	          source,
+	          narrow_source,
+	          256,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_initialize(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_get_field_mask(
+	          file,
+	          &field_mask,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT32(
+	 "field_mask",
+	 field_mask,
+	 (uint32_t) LIBLNK_FIELD_ALL );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_open(
+	          file,
+	          narrow_source,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_get_data_size(
+	          file,
+	          &full_data_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_close(
+	          file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_set_field_mask(
+	          file,
+	          LIBLNK_FIELD_TRACKER,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the file header is always selected
+	 */
+	result = liblnk_file_get_field_mask(
+	          file,
+	          &field_mask,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT32(
+	 "field_mask",
+	 field_mask,
+	 (uint32_t) ( LIBLNK_FIELD_HEADER | LIBLNK_FIELD_TRACKER ) );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the skipped structures are not read when the file is read
+	 * from a single buffer and when it is read from the file IO handle
+	 */
+	for( open_iterator = 0;
+	     open_iterator < 2;
+	     open_iterator++ )
+	{
+		if( open_iterator == 1 )
+		{
+			result = liblnk_file_set_maximum_read_buffer_size(
+			          file,
+			          0,
+			          &error );
+
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			LNK_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = liblnk_file_open(
+		          file,
+		          narrow_source,
+		          LIBLNK_OPEN_READ,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "file->link_target_identifier",
+		 ( (liblnk_internal_file_t *) file )->link_target_identifier );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "file->location_information",
+		 ( (liblnk_internal_file_t *) file )->location_information );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "file->description",
+		 ( (liblnk_internal_file_t *) file )->description );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "file->environment_variables_location_data_block",
+		 ( (liblnk_internal_file_t *) file )->environment_variables_location_data_block );
+
+		result = liblnk_file_get_data_size(
+		          file,
+		          &data_size,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_EQUAL_UINT64(
+		 "data_size",
+		 (uint64_t) data_size,
+		 (uint64_t) full_data_size );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_file_close(
+		          file,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = liblnk_file_get_field_mask(
+	          NULL,
+	          &field_mask,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_get_field_mask(
+	          file,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_set_field_mask(
+	          NULL,
+	          LIBLNK_FIELD_ALL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_set_field_mask(
+	          file,
+	          0x80000000UL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_file_free(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_open_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_open_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	liblnk_file_t *file      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = lnk_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_initialize(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = liblnk_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_file_open_wide(
+	          NULL,
+	          wide_source,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_open_wide(
+	          file,
+	          NULL,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_open_wide(
+	          file,
+	          wide_source,
+	          -1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = liblnk_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_file_free(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Tests the liblnk_file_open_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_open_file_io_handle(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	liblnk_file_t *file              = NULL;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_initialize(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = liblnk_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_file_open_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_open_file_io_handle(
+	          file,
+	          NULL,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = liblnk_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_file_free(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_open_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_open_memory(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	liblnk_file_t *file              = NULL;
+	uint8_t *buffer                  = NULL;
+	size64_t buffer_size             = 0;
+	size_t string_length             = 0;
+	ssize_t read_count               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &buffer_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+
+		return( 1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * (size_t) buffer_size );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer",
+	 buffer );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              (size_t) buffer_size,
+	              0,
+	              &error );
+
+	LNK_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) buffer_size );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_initialize(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = liblnk_file_open_memory(
+	          file,
+	          buffer,
+	          (size_t) buffer_size,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+	/* Test that the data strings reference the buffer
+	 */
+	if( ( (liblnk_internal_file_t *) file )->description != NULL )
+	{
+		LNK_TEST_ASSERT_EQUAL_UINT8(
+		 "description->data_is_borrowed",
+		 ( (liblnk_internal_file_t *) file )->description->data_is_borrowed,
+		 1 );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = liblnk_file_open_memory(
+	          NULL,
+	          buffer,
+	          (size_t) buffer_size,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = liblnk_file_open_memory(
+	          file,
+	          buffer,
+	          (size_t) buffer_size,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_close(
+	          file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_file_open_memory(
+	          file,
+	          NULL,
+	          (size_t) buffer_size,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_open_memory(
+	          file,
+	          buffer,
+	          0,
+	          LIBLNK_OPEN_READ,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_open_memory(
+	          file,
+	          buffer,
+	          (size_t) buffer_size,
+	          -1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_file_free(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_close(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = liblnk_file_close(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_open and liblnk_file_close functions
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_open_close(
+     const system_character_t *source )
+{
+	libcerror_error_t *error = NULL;
+	liblnk_file_t *file      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_file_initialize(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = liblnk_file_open_wide(
+	          file,
+	          source,
+	          LIBLNK_OPEN_READ,
+	          &error );
+#else
+	result = liblnk_file_open(
+	          file,
+	          source,
+	          LIBLNK_OPEN_READ,
+	          &error );
+#endif
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_close(
+	          file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open and close a second time to validate clean up on close
+	 */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = liblnk_file_open_wide(
+	          file,
+	          source,
+	          LIBLNK_OPEN_READ,
+	          &error );
+#else
+	result = liblnk_file_open(
+	          file,
+	          source,
+	          LIBLNK_OPEN_READ,
+	          &error );
+#endif
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_close(
+	          file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = liblnk_file_free(
+	          &file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		liblnk_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_signal_abort function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_signal_abort(
+     liblnk_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_file_signal_abort(
+	          file,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_file_signal_abort(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
 	}
-	if( file_io_handle != NULL )
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+/* TODO: add tests for liblnk_internal_file_open_read */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+/* Tests the liblnk_file_get_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_get_ascii_codepage(
+     liblnk_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	int ascii_codepage        = 0;
+	int ascii_codepage_is_set = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_file_get_ascii_codepage(
+	          file,
+	          &ascii_codepage,
+	          &error );
+
+	LNK_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ascii_codepage_is_set = result;
+
+	/* Test error cases
+	 */
+	result = liblnk_file_get_ascii_codepage(
+	          NULL,
+	          &ascii_codepage,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( ascii_codepage_is_set != 0 )
+	{
+		result = liblnk_file_get_ascii_codepage(
+		          file,
+		          NULL,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		LNK_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_set_ascii_codepage(
+     liblnk_file_t *file )
+{
+	int supported_codepages[ 15 ] = {
+		LIBLNK_CODEPAGE_ASCII,
+		LIBLNK_CODEPAGE_WINDOWS_874,
+		LIBLNK_CODEPAGE_WINDOWS_932,
+		LIBLNK_CODEPAGE_WINDOWS_936,
+		LIBLNK_CODEPAGE_WINDOWS_949,
+		LIBLNK_CODEPAGE_WINDOWS_950,
+		LIBLNK_CODEPAGE_WINDOWS_1250,
+		LIBLNK_CODEPAGE_WINDOWS_1251,
+		LIBLNK_CODEPAGE_WINDOWS_1252,
+		LIBLNK_CODEPAGE_WINDOWS_1253,
+		LIBLNK_CODEPAGE_WINDOWS_1254,
+		LIBLNK_CODEPAGE_WINDOWS_1255,
+		LIBLNK_CODEPAGE_WINDOWS_1256,
+		LIBLNK_CODEPAGE_WINDOWS_1257,
+		LIBLNK_CODEPAGE_WINDOWS_1258 };
+
+	int unsupported_codepages[ 17 ] = {
+		LIBLNK_CODEPAGE_ISO_8859_1,
+		LIBLNK_CODEPAGE_ISO_8859_2,
+		LIBLNK_CODEPAGE_ISO_8859_3,
+		LIBLNK_CODEPAGE_ISO_8859_4,
+		LIBLNK_CODEPAGE_ISO_8859_5,
+		LIBLNK_CODEPAGE_ISO_8859_6,
+		LIBLNK_CODEPAGE_ISO_8859_7,
+		LIBLNK_CODEPAGE_ISO_8859_8,
+		LIBLNK_CODEPAGE_ISO_8859_9,
+		LIBLNK_CODEPAGE_ISO_8859_10,
+		LIBLNK_CODEPAGE_ISO_8859_11,
+		LIBLNK_CODEPAGE_ISO_8859_13,
+		LIBLNK_CODEPAGE_ISO_8859_14,
+		LIBLNK_CODEPAGE_ISO_8859_15,
+		LIBLNK_CODEPAGE_ISO_8859_16,
+		LIBLNK_CODEPAGE_KOI8_R,
+		LIBLNK_CODEPAGE_KOI8_U };
+
+	libcerror_error_t *error = NULL;
+	int codepage             = 0;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set ASCII codepage
+	 */
+	for( index = 0;
+	     index < 15;
+	     index++ )
+	{
+		codepage = supported_codepages[ index ];
+
+		result = liblnk_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+	/* Test that the data string caches were refilled with the last codepage
+	 */
+	if( ( (liblnk_internal_file_t *) file )->description != NULL )
+	{
+		result = liblnk_data_string_has_cached_string(
+		          ( (liblnk_internal_file_t *) file )->description,
+		          LIBLNK_CODEPAGE_WINDOWS_1258,
+		          LIBLNK_DATA_STRING_FORMAT_UTF8,
+		          0 );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+	}
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+	/* Test error cases
+	 */
+	result = liblnk_file_set_ascii_codepage(
+	          NULL,
+	          LIBLNK_CODEPAGE_ASCII,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( index = 0;
+	     index < 17;
+	     index++ )
+	{
+		codepage = unsupported_codepages[ index ];
+
+		result = liblnk_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		LNK_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = liblnk_file_set_ascii_codepage(
+	          file,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
 	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
+		libcerror_error_free(
+		 &error );
 	}
 	return( 0 );
 }
 
-/* Tests the liblnk_file_close function
+/* Tests the liblnk_file_get_maximum_read_buffer_size function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_close(
-     void )
+int lnk_test_file_get_maximum_read_buffer_size(
+     liblnk_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	size_t maximum_read_buffer_size = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_file_get_maximum_read_buffer_size(
+	          file,
+	          &maximum_read_buffer_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = liblnk_file_close(
+	result = liblnk_file_get_maximum_read_buffer_size(
+	          NULL,
+	          &maximum_read_buffer_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_get_maximum_read_buffer_size(
+	          file,
 	          NULL,
 	          &error );
 
@@ -1039,20 +3438,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_open and liblnk_file_close functions
+/* Tests the liblnk_file_set_maximum_read_buffer_size function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_open_close(
-     const system_character_t *source )
+int lnk_test_file_set_maximum_read_buffer_size(
+     liblnk_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	liblnk_file_t *file      = NULL;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	size_t maximum_read_buffer_size = 0;
+	int result                      = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = liblnk_file_initialize(
-	          &file,
+	result = liblnk_file_set_maximum_read_buffer_size(
+	          file,
+	          0,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1060,67 +3460,71 @@ int lnk_test_file_open_close(
 	 result,
 	 1 );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
-	 "file",
-	 file );
-
 	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = liblnk_file_open_wide(
-	          file,
-	          source,
-	          LIBLNK_OPEN_READ,
-	          &error );
-#else
-	result = liblnk_file_open(
+	result = liblnk_file_get_maximum_read_buffer_size(
 	          file,
-	          source,
-	          LIBLNK_OPEN_READ,
+	          &maximum_read_buffer_size,
 	          &error );
-#endif
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 1 );
 
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_read_buffer_size",
+	 maximum_read_buffer_size,
+	 (size_t) 0 );
+
 	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = liblnk_file_close(
-	          file,
+	/* Test error cases
+	 */
+	result = liblnk_file_set_maximum_read_buffer_size(
+	          NULL,
+	          0,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	LNK_TEST_ASSERT_IS_NULL(
+	LNK_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test open and close a second time to validate clean up on close
-	 */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = liblnk_file_open_wide(
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_set_maximum_read_buffer_size(
 	          file,
-	          source,
-	          LIBLNK_OPEN_READ,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
 	          &error );
-#else
-	result = liblnk_file_open(
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_file_set_maximum_read_buffer_size(
 	          file,
-	          source,
-	          LIBLNK_OPEN_READ,
+	          64 * 1024,
 	          &error );
-#endif
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1131,38 +3535,79 @@ int lnk_test_file_open_close(
 	 "error",
 	 error );
 
-	result = liblnk_file_close(
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_get_data_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_get_data_flags(
+     liblnk_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t data_flags      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_file_get_data_flags(
 	          file,
+	          &data_flags,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
 
 	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Clean up
+	/* Test error cases
 	 */
-	result = liblnk_file_free(
-	          &file,
+	result = liblnk_file_get_data_flags(
+	          NULL,
+	          &data_flags,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	LNK_TEST_ASSERT_IS_NULL(
-	 "file",
-	 file );
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	LNK_TEST_ASSERT_IS_NULL(
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_get_data_flags(
+	          file,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1171,28 +3616,24 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file != NULL )
-	{
-		liblnk_file_free(
-		 &file,
-		 NULL );
-	}
 	return( 0 );
 }
 
-/* Tests the liblnk_file_signal_abort function
+/* Tests the liblnk_file_get_data_size function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_signal_abort(
+int lnk_test_file_get_data_size(
      liblnk_file_t *file )
 {
 	libcerror_error_t *error = NULL;
+	size64_t data_size       = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_signal_abort(
+	result = liblnk_file_get_data_size(
 	          file,
+	          &data_size,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1206,7 +3647,25 @@ int lnk_test_file_signal_abort(
 
 	/* Test error cases
 	 */
-	result = liblnk_file_signal_abort(
+	result = liblnk_file_get_data_size(
+	          NULL,
+	          &data_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_get_data_size(
+	          file,
 	          NULL,
 	          &error );
 
@@ -1233,28 +3692,19 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
-
-/* TODO: add tests for liblnk_internal_file_open_read */
-
-#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
-
-/* Tests the liblnk_file_get_ascii_codepage function
+/* Tests the liblnk_file_link_refers_to_file function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_ascii_codepage(
+int lnk_test_file_link_refers_to_file(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error  = NULL;
-	int ascii_codepage        = 0;
-	int ascii_codepage_is_set = 0;
-	int result                = 0;
+	libcerror_error_t *error = NULL;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_ascii_codepage(
+	result = liblnk_file_link_refers_to_file(
 	          file,
-	          &ascii_codepage,
 	          &error );
 
 	LNK_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1266,13 +3716,10 @@ int lnk_test_file_get_ascii_codepage(
 	 "error",
 	 error );
 
-	ascii_codepage_is_set = result;
-
 	/* Test error cases
 	 */
-	result = liblnk_file_get_ascii_codepage(
+	result = liblnk_file_link_refers_to_file(
 	          NULL,
-	          &ascii_codepage,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1282,30 +3729,11 @@ int lnk_test_file_get_ascii_codepage(
 
 	LNK_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	if( ascii_codepage_is_set != 0 )
-	{
-		result = liblnk_file_get_ascii_codepage(
-		          file,
-		          NULL,
-		          &error );
-
-		LNK_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		LNK_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1317,80 +3745,37 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_set_ascii_codepage function
+/* Tests the liblnk_file_get_file_creation_time function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_set_ascii_codepage(
+int lnk_test_file_get_file_creation_time(
      liblnk_file_t *file )
 {
-	int supported_codepages[ 15 ] = {
-		LIBLNK_CODEPAGE_ASCII,
-		LIBLNK_CODEPAGE_WINDOWS_874,
-		LIBLNK_CODEPAGE_WINDOWS_932,
-		LIBLNK_CODEPAGE_WINDOWS_936,
-		LIBLNK_CODEPAGE_WINDOWS_949,
-		LIBLNK_CODEPAGE_WINDOWS_950,
-		LIBLNK_CODEPAGE_WINDOWS_1250,
-		LIBLNK_CODEPAGE_WINDOWS_1251,
-		LIBLNK_CODEPAGE_WINDOWS_1252,
-		LIBLNK_CODEPAGE_WINDOWS_1253,
-		LIBLNK_CODEPAGE_WINDOWS_1254,
-		LIBLNK_CODEPAGE_WINDOWS_1255,
-		LIBLNK_CODEPAGE_WINDOWS_1256,
-		LIBLNK_CODEPAGE_WINDOWS_1257,
-		LIBLNK_CODEPAGE_WINDOWS_1258 };
-
-	int unsupported_codepages[ 17 ] = {
-		LIBLNK_CODEPAGE_ISO_8859_1,
-		LIBLNK_CODEPAGE_ISO_8859_2,
-		LIBLNK_CODEPAGE_ISO_8859_3,
-		LIBLNK_CODEPAGE_ISO_8859_4,
-		LIBLNK_CODEPAGE_ISO_8859_5,
-		LIBLNK_CODEPAGE_ISO_8859_6,
-		LIBLNK_CODEPAGE_ISO_8859_7,
-		LIBLNK_CODEPAGE_ISO_8859_8,
-		LIBLNK_CODEPAGE_ISO_8859_9,
-		LIBLNK_CODEPAGE_ISO_8859_10,
-		LIBLNK_CODEPAGE_ISO_8859_11,
-		LIBLNK_CODEPAGE_ISO_8859_13,
-		LIBLNK_CODEPAGE_ISO_8859_14,
-		LIBLNK_CODEPAGE_ISO_8859_15,
-		LIBLNK_CODEPAGE_ISO_8859_16,
-		LIBLNK_CODEPAGE_KOI8_R,
-		LIBLNK_CODEPAGE_KOI8_U };
-
-	libcerror_error_t *error = NULL;
-	int codepage             = 0;
-	int index                = 0;
-	int result               = 0;
+	libcerror_error_t *error    = NULL;
+	uint64_t file_creation_time = 0;
+	int result                  = 0;
 
-	/* Test set ASCII codepage
+	/* Test regular cases
 	 */
-	for( index = 0;
-	     index < 15;
-	     index++ )
-	{
-		codepage = supported_codepages[ index ];
+	result = liblnk_file_get_file_creation_time(
+	          file,
+	          &file_creation_time,
+	          &error );
 
-		result = liblnk_file_set_ascii_codepage(
-		          file,
-		          codepage,
-		          &error );
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		LNK_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		LNK_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	result = liblnk_file_set_ascii_codepage(
+	result = liblnk_file_get_file_creation_time(
 	          NULL,
-	          LIBLNK_CODEPAGE_ASCII,
+	          &file_creation_time,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1405,45 +3790,23 @@ int lnk_test_file_set_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	for( index = 0;
-	     index < 17;
-	     index++ )
-	{
-		codepage = unsupported_codepages[ index ];
-
-		result = liblnk_file_set_ascii_codepage(
-		          file,
-		          codepage,
-		          &error );
-
-		LNK_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		LNK_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
-	 */
-	result = liblnk_file_set_ascii_codepage(
+	result = liblnk_file_get_file_creation_time(
 	          file,
-	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          NULL,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	LNK_TEST_ASSERT_IS_NULL(
+	LNK_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1455,21 +3818,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_data_flags function
+/* Tests the liblnk_file_get_file_modification_time function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_data_flags(
+int lnk_test_file_get_file_modification_time(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t data_flags      = 0;
-	int result               = 0;
+	libcerror_error_t *error        = NULL;
+	uint64_t file_modification_time = 0;
+	int result                      = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_data_flags(
+	result = liblnk_file_get_file_modification_time(
 	          file,
-	          &data_flags,
+	          &file_modification_time,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1483,9 +3846,9 @@ int lnk_test_file_get_data_flags(
 
 	/* Test error cases
 	 */
-	result = liblnk_file_get_data_flags(
+	result = liblnk_file_get_file_modification_time(
 	          NULL,
-	          &data_flags,
+	          &file_modification_time,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1500,7 +3863,7 @@ int lnk_test_file_get_data_flags(
 	libcerror_error_free(
 	 &error );
 
-	result = liblnk_file_get_data_flags(
+	result = liblnk_file_get_file_modification_time(
 	          file,
 	          NULL,
 	          &error );
@@ -1528,21 +3891,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_data_size function
+/* Tests the liblnk_file_get_file_access_time function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_data_size(
+int lnk_test_file_get_file_access_time(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	size64_t data_size       = 0;
-	int result               = 0;
+	libcerror_error_t *error  = NULL;
+	uint64_t file_access_time = 0;
+	int result                = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_data_size(
+	result = liblnk_file_get_file_access_time(
 	          file,
-	          &data_size,
+	          &file_access_time,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1556,9 +3919,9 @@ int lnk_test_file_get_data_size(
 
 	/* Test error cases
 	 */
-	result = liblnk_file_get_data_size(
+	result = liblnk_file_get_file_access_time(
 	          NULL,
-	          &data_size,
+	          &file_access_time,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1573,7 +3936,7 @@ int lnk_test_file_get_data_size(
 	libcerror_error_free(
 	 &error );
 
-	result = liblnk_file_get_data_size(
+	result = liblnk_file_get_file_access_time(
 	          file,
 	          NULL,
 	          &error );
@@ -1601,25 +3964,27 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_link_refers_to_file function
+/* Tests the liblnk_file_get_file_size function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_link_refers_to_file(
+int lnk_test_file_get_file_size(
      liblnk_file_t *file )
 {
 	libcerror_error_t *error = NULL;
+	uint32_t file_size       = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_link_refers_to_file(
+	result = liblnk_file_get_file_size(
 	          file,
+	          &file_size,
 	          &error );
 
-	LNK_TEST_ASSERT_NOT_EQUAL_INT(
+	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -1627,7 +3992,25 @@ int lnk_test_file_link_refers_to_file(
 
 	/* Test error cases
 	 */
-	result = liblnk_file_link_refers_to_file(
+	result = liblnk_file_get_file_size(
+	          NULL,
+	          &file_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_get_file_size(
+	          file,
 	          NULL,
 	          &error );
 
@@ -1654,21 +4037,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_file_creation_time function
+/* Tests the liblnk_file_get_icon_index function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_file_creation_time(
+int lnk_test_file_get_icon_index(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error    = NULL;
-	uint64_t file_creation_time = 0;
-	int result                  = 0;
+	libcerror_error_t *error = NULL;
+	uint32_t icon_index      = 0;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_file_creation_time(
+	result = liblnk_file_get_icon_index(
 	          file,
-	          &file_creation_time,
+	          &icon_index,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1682,9 +4065,9 @@ int lnk_test_file_get_file_creation_time(
 
 	/* Test error cases
 	 */
-	result = liblnk_file_get_file_creation_time(
+	result = liblnk_file_get_icon_index(
 	          NULL,
-	          &file_creation_time,
+	          &icon_index,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1699,7 +4082,7 @@ int lnk_test_file_get_file_creation_time(
 	libcerror_error_free(
 	 &error );
 
-	result = liblnk_file_get_file_creation_time(
+	result = liblnk_file_get_icon_index(
 	          file,
 	          NULL,
 	          &error );
@@ -1727,21 +4110,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_file_modification_time function
+/* Tests the liblnk_file_get_show_window_value function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_file_modification_time(
+int lnk_test_file_get_show_window_value(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error        = NULL;
-	uint64_t file_modification_time = 0;
-	int result                      = 0;
+	libcerror_error_t *error   = NULL;
+	uint32_t show_window_value = 0;
+	int result                 = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_file_modification_time(
+	result = liblnk_file_get_show_window_value(
 	          file,
-	          &file_modification_time,
+	          &show_window_value,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1755,9 +4138,9 @@ int lnk_test_file_get_file_modification_time(
 
 	/* Test error cases
 	 */
-	result = liblnk_file_get_file_modification_time(
+	result = liblnk_file_get_show_window_value(
 	          NULL,
-	          &file_modification_time,
+	          &show_window_value,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1772,7 +4155,7 @@ int lnk_test_file_get_file_modification_time(
 	libcerror_error_free(
 	 &error );
 
-	result = liblnk_file_get_file_modification_time(
+	result = liblnk_file_get_show_window_value(
 	          file,
 	          NULL,
 	          &error );
@@ -1800,21 +4183,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_file_access_time function
+/* Tests the liblnk_file_get_hot_key_value function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_file_access_time(
+int lnk_test_file_get_hot_key_value(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error  = NULL;
-	uint64_t file_access_time = 0;
-	int result                = 0;
+	libcerror_error_t *error = NULL;
+	uint16_t hot_key_value   = 0;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_file_access_time(
+	result = liblnk_file_get_hot_key_value(
 	          file,
-	          &file_access_time,
+	          &hot_key_value,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1828,9 +4211,9 @@ int lnk_test_file_get_file_access_time(
 
 	/* Test error cases
 	 */
-	result = liblnk_file_get_file_access_time(
+	result = liblnk_file_get_hot_key_value(
 	          NULL,
-	          &file_access_time,
+	          &hot_key_value,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1845,7 +4228,7 @@ int lnk_test_file_get_file_access_time(
 	libcerror_error_free(
 	 &error );
 
-	result = liblnk_file_get_file_access_time(
+	result = liblnk_file_get_hot_key_value(
 	          file,
 	          NULL,
 	          &error );
@@ -1873,21 +4256,21 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_file_size function
+/* Tests the liblnk_file_get_file_attribute_flags function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_file_size(
+int lnk_test_file_get_file_attribute_flags(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t file_size       = 0;
-	int result               = 0;
+	libcerror_error_t *error      = NULL;
+	uint32_t file_attribute_flags = 0;
+	int result                    = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_file_size(
+	result = liblnk_file_get_file_attribute_flags(
 	          file,
-	          &file_size,
+	          &file_attribute_flags,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1901,9 +4284,9 @@ int lnk_test_file_get_file_size(
 
 	/* Test error cases
 	 */
-	result = liblnk_file_get_file_size(
+	result = liblnk_file_get_file_attribute_flags(
 	          NULL,
-	          &file_size,
+	          &file_attribute_flags,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1918,7 +4301,7 @@ int lnk_test_file_get_file_size(
 	libcerror_error_free(
 	 &error );
 
-	result = liblnk_file_get_file_size(
+	result = liblnk_file_get_file_attribute_flags(
 	          file,
 	          NULL,
 	          &error );
@@ -1946,37 +4329,40 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_icon_index function
+/* Tests the liblnk_file_get_drive_type function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_icon_index(
+int lnk_test_file_get_drive_type(
      liblnk_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	uint32_t icon_index      = 0;
+	uint32_t drive_type      = 0;
+	int drive_type_is_set    = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_icon_index(
+	result = liblnk_file_get_drive_type(
 	          file,
-	          &icon_index,
+	          &drive_type,
 	          &error );
 
-	LNK_TEST_ASSERT_EQUAL_INT(
+	LNK_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	drive_type_is_set = result;
+
 	/* Test error cases
 	 */
-	result = liblnk_file_get_icon_index(
+	result = liblnk_file_get_drive_type(
 	          NULL,
-	          &icon_index,
+	          &drive_type,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -1991,23 +4377,25 @@ int lnk_test_file_get_icon_index(
 	libcerror_error_free(
 	 &error );
 
-	result = liblnk_file_get_icon_index(
-	          file,
-	          NULL,
-	          &error );
-
-	LNK_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	if( drive_type_is_set != 0 )
+	{
+		result = liblnk_file_get_drive_type(
+		          file,
+		          NULL,
+		          &error );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	libcerror_error_free(
-	 &error );
+		LNK_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
+		libcerror_error_free(
+		 &error );
+	}
 	return( 1 );
 
 on_error:
@@ -2019,37 +4407,40 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_show_window_value function
+/* Tests the liblnk_file_get_drive_serial_number function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_show_window_value(
+int lnk_test_file_get_drive_serial_number(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error   = NULL;
-	uint32_t show_window_value = 0;
-	int result                 = 0;
+	libcerror_error_t *error       = NULL;
+	uint32_t drive_serial_number   = 0;
+	int drive_serial_number_is_set = 0;
+	int result                     = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_show_window_value(
+	result = liblnk_file_get_drive_serial_number(
 	          file,
-	          &show_window_value,
+	          &drive_serial_number,
 	          &error );
 
-	LNK_TEST_ASSERT_EQUAL_INT(
+	LNK_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	drive_serial_number_is_set = result;
+
 	/* Test error cases
 	 */
-	result = liblnk_file_get_show_window_value(
+	result = liblnk_file_get_drive_serial_number(
 	          NULL,
-	          &show_window_value,
+	          &drive_serial_number,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -2064,23 +4455,25 @@ int lnk_test_file_get_show_window_value(
 	libcerror_error_free(
 	 &error );
 
-	result = liblnk_file_get_show_window_value(
-	          file,
-	          NULL,
-	          &error );
-
-	LNK_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	if( drive_serial_number_is_set != 0 )
+	{
+		result = liblnk_file_get_drive_serial_number(
+		          file,
+		          NULL,
+		          &error );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
 
-	libcerror_error_free(
-	 &error );
+		LNK_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
 
+		libcerror_error_free(
+		 &error );
+	}
 	return( 1 );
 
 on_error:
@@ -2092,110 +4485,244 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_hot_key_value function
+/* Tests the liblnk_file_get_utf8_string function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_hot_key_value(
+int lnk_test_file_get_utf8_string(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	uint16_t hot_key_value   = 0;
-	int result               = 0;
+	uint8_t expected_utf8_string[ 512 ];
+	uint8_t utf8_string[ 512 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t expected_utf8_string_size = 0;
+	size_t required_utf8_string_size = 0;
+	int result                       = 0;
+	int utf8_string_is_set           = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_hot_key_value(
+	result = liblnk_file_get_utf8_string(
 	          file,
-	          &hot_key_value,
+	          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+	          NULL,
+	          0,
+	          &required_utf8_string_size,
 	          &error );
 
-	LNK_TEST_ASSERT_EQUAL_INT(
+	LNK_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = liblnk_file_get_hot_key_value(
-	          NULL,
-	          &hot_key_value,
-	          &error );
+	utf8_string_is_set = result;
 
-	LNK_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
+	if( utf8_string_is_set != 0 )
+	{
+		LNK_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "required_utf8_string_size",
+		 (ssize_t) required_utf8_string_size,
+		 (ssize_t) 0 );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+		result = liblnk_file_get_utf8_string(
+		          file,
+		          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+		          utf8_string,
+		          512,
+		          &required_utf8_string_size,
+		          &error );
 
-	libcerror_error_free(
-	 &error );
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-	result = liblnk_file_get_hot_key_value(
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_file_get_utf8_local_path(
+		          file,
+		          expected_utf8_string,
+		          512,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          sizeof( uint8_t ) * required_utf8_string_size );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* A too small string is truncated and sets the required size
+		 */
+		expected_utf8_string_size = required_utf8_string_size;
+
+		result = liblnk_file_get_utf8_string(
+		          file,
+		          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+		          utf8_string,
+		          1,
+		          &required_utf8_string_size,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_EQUAL_SIZE(
+		 "required_utf8_string_size",
+		 required_utf8_string_size,
+		 expected_utf8_string_size );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		LNK_TEST_ASSERT_EQUAL_UINT8(
+		 "utf8_string[ 0 ]",
+		 utf8_string[ 0 ],
+		 0 );
+	}
+	result = liblnk_file_get_utf8_string(
 	          file,
+	          LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL,
 	          NULL,
+	          0,
+	          &required_utf8_string_size,
 	          &error );
 
-	LNK_TEST_ASSERT_EQUAL_INT(
+	LNK_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
+	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
+	utf8_string_is_set = result;
 
-on_error:
-	if( error != NULL )
+	if( utf8_string_is_set != 0 )
 	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		expected_utf8_string_size = required_utf8_string_size;
 
-/* Tests the liblnk_file_get_file_attribute_flags function
- * Returns 1 if successful or 0 if not
- */
-int lnk_test_file_get_file_attribute_flags(
-     liblnk_file_t *file )
-{
-	libcerror_error_t *error      = NULL;
-	uint32_t file_attribute_flags = 0;
-	int result                    = 0;
+		result = liblnk_file_get_utf8_string(
+		          file,
+		          LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL,
+		          utf8_string,
+		          512,
+		          &required_utf8_string_size,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_EQUAL_SIZE(
+		 "required_utf8_string_size",
+		 required_utf8_string_size,
+		 expected_utf8_string_size );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* A too small string is truncated and sets the required size
+		 */
+		result = liblnk_file_get_utf8_string(
+		          file,
+		          LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL,
+		          utf8_string,
+		          1,
+		          &required_utf8_string_size,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_EQUAL_SIZE(
+		 "required_utf8_string_size",
+		 required_utf8_string_size,
+		 expected_utf8_string_size );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test regular cases
+		LNK_TEST_ASSERT_EQUAL_UINT8(
+		 "utf8_string[ 0 ]",
+		 utf8_string[ 0 ],
+		 0 );
+	}
+	/* Test error cases
 	 */
-	result = liblnk_file_get_file_attribute_flags(
+	result = liblnk_file_get_utf8_string(
+	          NULL,
+	          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+	          utf8_string,
+	          512,
+	          &required_utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_get_utf8_string(
 	          file,
-	          &file_attribute_flags,
+	          -1,
+	          utf8_string,
+	          512,
+	          &required_utf8_string_size,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	LNK_TEST_ASSERT_IS_NULL(
+	LNK_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = liblnk_file_get_file_attribute_flags(
-	          NULL,
-	          &file_attribute_flags,
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_get_utf8_string(
+	          file,
+	          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_utf8_string_size,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -2210,8 +4737,11 @@ int lnk_test_file_get_file_attribute_flags(
 	libcerror_error_free(
 	 &error );
 
-	result = liblnk_file_get_file_attribute_flags(
+	result = liblnk_file_get_utf8_string(
 	          file,
+	          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+	          utf8_string,
+	          512,
 	          NULL,
 	          &error );
 
@@ -2238,22 +4768,29 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the liblnk_file_get_drive_type function
+/* Tests the liblnk_file_get_utf16_string function
  * Returns 1 if successful or 0 if not
  */
-int lnk_test_file_get_drive_type(
+int lnk_test_file_get_utf16_string(
      liblnk_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t drive_type      = 0;
-	int drive_type_is_set    = 0;
-	int result               = 0;
+	uint16_t expected_utf16_string[ 512 ];
+	uint16_t utf16_string[ 512 ];
+
+	libcerror_error_t *error          = NULL;
+	size_t expected_utf16_string_size = 0;
+	size_t required_utf16_string_size = 0;
+	int result                        = 0;
+	int utf16_string_is_set           = 0;
 
 	/* Test regular cases
 	 */
-	result = liblnk_file_get_drive_type(
+	result = liblnk_file_get_utf16_string(
 	          file,
-	          &drive_type,
+	          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+	          NULL,
+	          0,
+	          &required_utf16_string_size,
 	          &error );
 
 	LNK_TEST_ASSERT_NOT_EQUAL_INT(
@@ -2265,91 +4802,210 @@ int lnk_test_file_get_drive_type(
 	 "error",
 	 error );
 
-	drive_type_is_set = result;
+	utf16_string_is_set = result;
 
-	/* Test error cases
-	 */
-	result = liblnk_file_get_drive_type(
+	if( utf16_string_is_set != 0 )
+	{
+		LNK_TEST_ASSERT_NOT_EQUAL_SSIZE(
+		 "required_utf16_string_size",
+		 (ssize_t) required_utf16_string_size,
+		 (ssize_t) 0 );
+
+		result = liblnk_file_get_utf16_string(
+		          file,
+		          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+		          utf16_string,
+		          512,
+		          &required_utf16_string_size,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = liblnk_file_get_utf16_local_path(
+		          file,
+		          expected_utf16_string,
+		          512,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf16_string,
+		          expected_utf16_string,
+		          sizeof( uint16_t ) * required_utf16_string_size );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		/* A too small string is truncated and sets the required size
+		 */
+		expected_utf16_string_size = required_utf16_string_size;
+
+		result = liblnk_file_get_utf16_string(
+		          file,
+		          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+		          utf16_string,
+		          1,
+		          &required_utf16_string_size,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_EQUAL_SIZE(
+		 "required_utf16_string_size",
+		 required_utf16_string_size,
+		 expected_utf16_string_size );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		LNK_TEST_ASSERT_EQUAL_UINT16(
+		 "utf16_string[ 0 ]",
+		 utf16_string[ 0 ],
+		 0 );
+	}
+	result = liblnk_file_get_utf16_string(
+	          file,
+	          LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL,
 	          NULL,
-	          &drive_type,
+	          0,
+	          &required_utf16_string_size,
 	          &error );
 
-	LNK_TEST_ASSERT_EQUAL_INT(
+	LNK_TEST_ASSERT_NOT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	LNK_TEST_ASSERT_IS_NOT_NULL(
+	LNK_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	utf16_string_is_set = result;
 
-	if( drive_type_is_set != 0 )
+	if( utf16_string_is_set != 0 )
 	{
-		result = liblnk_file_get_drive_type(
+		expected_utf16_string_size = required_utf16_string_size;
+
+		result = liblnk_file_get_utf16_string(
 		          file,
-		          NULL,
+		          LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL,
+		          utf16_string,
+		          512,
+		          &required_utf16_string_size,
 		          &error );
 
 		LNK_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
-		LNK_TEST_ASSERT_IS_NOT_NULL(
+		LNK_TEST_ASSERT_EQUAL_SIZE(
+		 "required_utf16_string_size",
+		 required_utf16_string_size,
+		 expected_utf16_string_size );
+
+		LNK_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+		/* A too small string is truncated and sets the required size
+		 */
+		result = liblnk_file_get_utf16_string(
+		          file,
+		          LIBLNK_STRING_IDENTIFIER_VOLUME_LABEL,
+		          utf16_string,
+		          1,
+		          &required_utf16_string_size,
+		          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-/* Tests the liblnk_file_get_drive_serial_number function
- * Returns 1 if successful or 0 if not
- */
-int lnk_test_file_get_drive_serial_number(
-     liblnk_file_t *file )
-{
-	libcerror_error_t *error       = NULL;
-	uint32_t drive_serial_number   = 0;
-	int drive_serial_number_is_set = 0;
-	int result                     = 0;
+		LNK_TEST_ASSERT_EQUAL_SIZE(
+		 "required_utf16_string_size",
+		 required_utf16_string_size,
+		 expected_utf16_string_size );
 
-	/* Test regular cases
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		LNK_TEST_ASSERT_EQUAL_UINT16(
+		 "utf16_string[ 0 ]",
+		 utf16_string[ 0 ],
+		 0 );
+	}
+	/* Test error cases
 	 */
-	result = liblnk_file_get_drive_serial_number(
+	result = liblnk_file_get_utf16_string(
+	          NULL,
+	          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+	          utf16_string,
+	          512,
+	          &required_utf16_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_get_utf16_string(
 	          file,
-	          &drive_serial_number,
+	          -1,
+	          utf16_string,
+	          512,
+	          &required_utf16_string_size,
 	          &error );
 
-	LNK_TEST_ASSERT_NOT_EQUAL_INT(
+	LNK_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
 	 -1 );
 
-	LNK_TEST_ASSERT_IS_NULL(
+	LNK_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	drive_serial_number_is_set = result;
+	libcerror_error_free(
+	 &error );
 
-	/* Test error cases
-	 */
-	result = liblnk_file_get_drive_serial_number(
-	          NULL,
-	          &drive_serial_number,
+	result = liblnk_file_get_utf16_string(
+	          file,
+	          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &required_utf16_string_size,
 	          &error );
 
 	LNK_TEST_ASSERT_EQUAL_INT(
@@ -2364,25 +5020,26 @@ int lnk_test_file_get_drive_serial_number(
 	libcerror_error_free(
 	 &error );
 
-	if( drive_serial_number_is_set != 0 )
-	{
-		result = liblnk_file_get_drive_serial_number(
-		          file,
-		          NULL,
-		          &error );
+	result = liblnk_file_get_utf16_string(
+	          file,
+	          LIBLNK_STRING_IDENTIFIER_LOCAL_PATH,
+	          utf16_string,
+	          512,
+	          NULL,
+	          &error );
 
-		LNK_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		LNK_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -6805,6 +9462,31 @@ int main(
 		 lnk_test_file_open,
 		 source );
 
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_open_memory_map",
+		 lnk_test_file_open_memory_map,
+		 source );
+
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_open_lazy_data_blocks",
+		 lnk_test_file_open_lazy_data_blocks,
+		 source );
+
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_open_arena",
+		 lnk_test_file_open_arena,
+		 source );
+
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_open_retain_capacity",
+		 lnk_test_file_open_retain_capacity,
+		 source );
+
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_open_field_mask",
+		 lnk_test_file_open_field_mask,
+		 source );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 		LNK_TEST_RUN_WITH_ARGS(
@@ -6819,6 +9501,11 @@ int main(
 		 lnk_test_file_open_file_io_handle,
 		 source );
 
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_open_memory",
+		 lnk_test_file_open_memory,
+		 source );
+
 		LNK_TEST_RUN(
 		 "liblnk_file_close",
 		 lnk_test_file_close );
@@ -6871,6 +9558,16 @@ int main(
 		 lnk_test_file_set_ascii_codepage,
 		 file );
 
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_get_maximum_read_buffer_size",
+		 lnk_test_file_get_maximum_read_buffer_size,
+		 file );
+
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_set_maximum_read_buffer_size",
+		 lnk_test_file_set_maximum_read_buffer_size,
+		 file );
+
 		LNK_TEST_RUN_WITH_ARGS(
 		 "liblnk_file_get_data_flags",
 		 lnk_test_file_get_data_flags,
@@ -6936,6 +9633,16 @@ int main(
 		 lnk_test_file_get_drive_serial_number,
 		 file );
 
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_get_utf8_string",
+		 lnk_test_file_get_utf8_string,
+		 file );
+
+		LNK_TEST_RUN_WITH_ARGS(
+		 "liblnk_file_get_utf16_string",
+		 lnk_test_file_get_utf16_string,
+		 file );
+
 		LNK_TEST_RUN_WITH_ARGS(
 		 "liblnk_file_get_utf8_volume_label_size",
 		 lnk_test_file_get_utf8_volume_label_size,
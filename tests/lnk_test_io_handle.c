@@ -398,6 +398,202 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the liblnk_io_handle_get_data_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_io_handle_get_data_at_offset(
+     void )
+{
+	uint8_t file_data[ 8 ] = {
+		0x4c, 0x00, 0x00, 0x00, 0x01, 0x14, 0x02, 0x00 };
+
+	libcerror_error_t *error      = NULL;
+	liblnk_io_handle_t *io_handle = NULL;
+	const uint8_t *data           = NULL;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_io_handle_get_data_at_offset(
+	          io_handle,
+	          4,
+	          4,
+	          &data,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->data      = file_data;
+	io_handle->data_size = 8;
+
+	result = liblnk_io_handle_get_data_at_offset(
+	          io_handle,
+	          4,
+	          4,
+	          &data,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	LNK_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 0x01 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_io_handle_get_data_at_offset(
+	          NULL,
+	          4,
+	          4,
+	          &data,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_io_handle_get_data_at_offset(
+	          io_handle,
+	          4,
+	          4,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_io_handle_get_data_at_offset(
+	          io_handle,
+	          6,
+	          4,
+	          &data,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_io_handle_get_data_at_offset(
+	          io_handle,
+	          -1,
+	          4,
+	          &data,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	io_handle->data      = NULL;
+	io_handle->data_size = 0;
+
+	result = liblnk_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		liblnk_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +625,10 @@ int main(
 	 "liblnk_io_handle_clear",
 	 lnk_test_io_handle_clear );
 
+	LNK_TEST_RUN(
+	 "liblnk_io_handle_get_data_at_offset",
+	 lnk_test_io_handle_get_data_at_offset );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
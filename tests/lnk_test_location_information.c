@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -33,8 +34,15 @@
 #include "lnk_test_memory.h"
 #include "lnk_test_unused.h"
 
+#include "../liblnk/liblnk_definitions.h"
 #include "../liblnk/liblnk_location_information.h"
 
+uint8_t lnk_test_location_information_local_path1[ 11 ] = {
+	'C', ':', '\\', 'W', 'i', 'n', 'd', 'o', 'w', 's', 0 };
+
+uint8_t lnk_test_location_information_common_path1[ 9 ] = {
+	't', 'e', 's', 't', '.', 't', 'x', 't', 0 };
+
 #if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
 
 /* Tests the liblnk_location_information_initialize function
@@ -270,6 +278,135 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the liblnk_location_information_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_location_information_clear(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	liblnk_location_information_t *location_information = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_location_information_initialize(
+	          &location_information,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "location_information",
+	 location_information );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	location_information->flags            = LIBLNK_LOCATION_FLAG_HAS_VOLUME_INFORMATION;
+	location_information->local_path       = lnk_test_location_information_local_path1;
+	location_information->local_path_size  = 11;
+	location_information->common_path      = lnk_test_location_information_common_path1;
+	location_information->common_path_size = 9;
+	location_information->data_is_borrowed = 1;
+
+	result = liblnk_location_information_cache_path(
+	          location_information,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_location_information_clear(
+	          location_information,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "location_information->local_path",
+	 location_information->local_path );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "location_information->cached_utf8_local_path",
+	 location_information->cached_utf8_local_path );
+
+	/* Test error cases
+	 */
+	result = liblnk_location_information_clear(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_location_information_free(
+	          &location_information,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "location_information",
+	 location_information );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( location_information != NULL )
+	{
+		liblnk_location_information_free(
+		 &location_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the liblnk_location_information_read function
  * Returns 1 if successful or 0 if not
  */
@@ -375,6 +512,286 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the liblnk_location_information_cache_path function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_location_information_cache_path(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error                            = NULL;
+	liblnk_location_information_t *location_information = NULL;
+	size_t utf8_string_size                             = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_location_information_initialize(
+	          &location_information,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "location_information",
+	 location_information );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	location_information->flags            = LIBLNK_LOCATION_FLAG_HAS_VOLUME_INFORMATION;
+	location_information->local_path       = lnk_test_location_information_local_path1;
+	location_information->local_path_size  = 11;
+	location_information->common_path      = lnk_test_location_information_common_path1;
+	location_information->common_path_size = 9;
+	location_information->data_is_borrowed = 1;
+
+	/* Test regular cases
+	 */
+	result = liblnk_location_information_cache_path(
+	          location_information,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_location_information_has_cached_path(
+	          location_information,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = liblnk_location_information_has_cached_path(
+	          location_information,
+	          LIBLNK_CODEPAGE_ASCII,
+	          LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = liblnk_location_information_get_utf8_local_path_size(
+	          location_information,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          &utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 20 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_location_information_get_utf8_local_path(
+	          location_information,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          utf8_string,
+	          32,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "C:\\Windows\\test.txt",
+	          20 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test cache path with a path that is not available
+	 */
+	result = liblnk_location_information_cache_path(
+	          location_information,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_LOCATION_INFORMATION_PATH_TYPE_NETWORK,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test clear cache
+	 */
+	result = liblnk_location_information_clear_cache(
+	          location_information,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_location_information_has_cached_path(
+	          location_information,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = liblnk_location_information_cache_path(
+	          NULL,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_location_information_cache_path(
+	          location_information,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          -1,
+	          LIBLNK_DATA_STRING_FORMAT_UTF8,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_location_information_cache_path(
+	          location_information,
+	          LIBLNK_CODEPAGE_WINDOWS_1252,
+	          LIBLNK_LOCATION_INFORMATION_PATH_TYPE_LOCAL,
+	          -1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_location_information_clear_cache(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_location_information_free(
+	          &location_information,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "location_information",
+	 location_information );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( location_information != NULL )
+	{
+		liblnk_location_information_free(
+		 &location_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
 
 /* The main program
@@ -402,12 +819,20 @@ int main(
 	 "liblnk_location_information_free",
 	 lnk_test_location_information_free );
 
+	LNK_TEST_RUN(
+	 "liblnk_location_information_clear",
+	 lnk_test_location_information_clear );
+
 	/* TODO: add tests for liblnk_location_information_read_data */
 
 	LNK_TEST_RUN(
 	 "liblnk_location_information_read",
 	 lnk_test_location_information_read );
 
+	LNK_TEST_RUN(
+	 "liblnk_location_information_cache_path",
+	 lnk_test_location_information_cache_path );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,1506 @@
+/*
+ * Library statistics type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_test_libcerror.h"
+#include "lnk_test_liblnk.h"
+#include "lnk_test_macros.h"
+#include "lnk_test_memory.h"
+#include "lnk_test_unused.h"
+
+#include "../liblnk/liblnk_statistics.h"
+
+/* Tests the liblnk_statistics_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	liblnk_statistics_t *statistics = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_LNK_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_free(
+	          &statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_initialize(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	statistics = (liblnk_statistics_t *) 0x12345678UL;
+
+	result = liblnk_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	statistics = NULL;
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_LNK_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test liblnk_statistics_initialize with malloc failing
+		 */
+		lnk_test_malloc_attempts_before_fail = test_number;
+
+		result = liblnk_statistics_initialize(
+		          &statistics,
+		          &error );
+
+		if( lnk_test_malloc_attempts_before_fail != -1 )
+		{
+			lnk_test_malloc_attempts_before_fail = -1;
+
+			if( statistics != NULL )
+			{
+				liblnk_statistics_free(
+				 &statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			LNK_TEST_ASSERT_IS_NULL(
+			 "statistics",
+			 statistics );
+
+			LNK_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test liblnk_statistics_initialize with memset failing
+		 */
+		lnk_test_memset_attempts_before_fail = test_number;
+
+		result = liblnk_statistics_initialize(
+		          &statistics,
+		          &error );
+
+		if( lnk_test_memset_attempts_before_fail != -1 )
+		{
+			lnk_test_memset_attempts_before_fail = -1;
+
+			if( statistics != NULL )
+			{
+				liblnk_statistics_free(
+				 &statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			LNK_TEST_ASSERT_IS_NULL(
+			 "statistics",
+			 statistics );
+
+			LNK_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_LNK_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		liblnk_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_free function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_free(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_set_global function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_set_global(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	liblnk_statistics_t *statistics = NULL;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = liblnk_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_set_global(
+	          statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_free(
+	          &statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_set_global(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = liblnk_statistics_free(
+	          &statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		liblnk_statistics_set_global(
+		 NULL,
+		 NULL );
+
+		liblnk_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_clear(
+     liblnk_statistics_t *statistics )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_clear(
+	          statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_clear(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_get_phase_time function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_get_phase_time(
+     liblnk_statistics_t *statistics )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t elapsed_time    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_get_phase_time(
+	          statistics,
+	          LIBLNK_STATISTICS_PHASE_OPEN,
+	          &elapsed_time,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_get_phase_time(
+	          NULL,
+	          LIBLNK_STATISTICS_PHASE_OPEN,
+	          &elapsed_time,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_statistics_get_phase_time(
+	          statistics,
+	          -1,
+	          &elapsed_time,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_statistics_get_phase_time(
+	          statistics,
+	          LIBLNK_STATISTICS_PHASE_OPEN,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_get_phase_count function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_get_phase_count(
+     liblnk_statistics_t *statistics )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t count           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_get_phase_count(
+	          statistics,
+	          LIBLNK_STATISTICS_PHASE_OPEN,
+	          &count,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_get_phase_count(
+	          NULL,
+	          LIBLNK_STATISTICS_PHASE_OPEN,
+	          &count,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_statistics_get_phase_count(
+	          statistics,
+	          -1,
+	          &count,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_statistics_get_phase_count(
+	          statistics,
+	          LIBLNK_STATISTICS_PHASE_OPEN,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_get_counter function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_get_counter(
+     liblnk_statistics_t *statistics )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_get_counter(
+	          statistics,
+	          LIBLNK_STATISTICS_COUNTER_BYTES_READ,
+	          &value,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_get_counter(
+	          NULL,
+	          LIBLNK_STATISTICS_COUNTER_BYTES_READ,
+	          &value,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_statistics_get_counter(
+	          statistics,
+	          -1,
+	          &value,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_statistics_get_counter(
+	          statistics,
+	          LIBLNK_STATISTICS_COUNTER_BYTES_READ,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_get_number_of_data_blocks_by_signature function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_get_number_of_data_blocks_by_signature(
+     liblnk_statistics_t *statistics )
+{
+	libcerror_error_t *error       = NULL;
+	uint64_t number_of_data_blocks = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_get_number_of_data_blocks_by_signature(
+	          statistics,
+	          0xa0000003UL,
+	          &number_of_data_blocks,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_get_number_of_data_blocks_by_signature(
+	          NULL,
+	          0xa0000003UL,
+	          &number_of_data_blocks,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_statistics_get_number_of_data_blocks_by_signature(
+	          statistics,
+	          0xa0000003UL,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+/* Tests the liblnk_statistics_add_counter function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_add_counter(
+     liblnk_statistics_t *statistics )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t value           = 0;
+	int result               = 0;
+
+	result = liblnk_statistics_clear(
+	          statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_add_counter(
+	          (liblnk_internal_statistics_t *) statistics,
+	          LIBLNK_STATISTICS_COUNTER_BYTES_READ,
+	          76,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_add_counter(
+	          (liblnk_internal_statistics_t *) statistics,
+	          LIBLNK_STATISTICS_COUNTER_BYTES_READ,
+	          24,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_get_counter(
+	          statistics,
+	          LIBLNK_STATISTICS_COUNTER_BYTES_READ,
+	          &value,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 100 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Without statistics the counter is not added
+	 */
+	result = liblnk_statistics_add_counter(
+	          NULL,
+	          LIBLNK_STATISTICS_COUNTER_BYTES_READ,
+	          76,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_add_counter(
+	          (liblnk_internal_statistics_t *) statistics,
+	          -1,
+	          76,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_add_data_block function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_add_data_block(
+     liblnk_statistics_t *statistics )
+{
+	libcerror_error_t *error       = NULL;
+	uint64_t number_of_data_blocks = 0;
+	int result                     = 0;
+
+	result = liblnk_statistics_clear(
+	          statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_add_data_block(
+	          (liblnk_internal_statistics_t *) statistics,
+	          0xa0000003UL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_add_data_block(
+	          (liblnk_internal_statistics_t *) statistics,
+	          0x12345678UL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_get_number_of_data_blocks_by_signature(
+	          statistics,
+	          0xa0000003UL,
+	          &number_of_data_blocks,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_data_blocks",
+	 number_of_data_blocks,
+	 (uint64_t) 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Signatures outside the individually counted range share a count
+	 */
+	result = liblnk_statistics_get_number_of_data_blocks_by_signature(
+	          statistics,
+	          0xffffffffUL,
+	          &number_of_data_blocks,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_data_blocks",
+	 number_of_data_blocks,
+	 (uint64_t) 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_get_counter(
+	          statistics,
+	          LIBLNK_STATISTICS_COUNTER_NUMBER_OF_DATA_BLOCKS,
+	          &number_of_data_blocks,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_data_blocks",
+	 number_of_data_blocks,
+	 (uint64_t) 2 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_end_phase function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_end_phase(
+     liblnk_statistics_t *statistics )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t count           = 0;
+	uint64_t start_timestamp = 0;
+	int result               = 0;
+
+	result = liblnk_statistics_clear(
+	          statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_start_phase(
+	          (liblnk_internal_statistics_t *) statistics,
+	          &start_timestamp,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_end_phase(
+	          (liblnk_internal_statistics_t *) statistics,
+	          LIBLNK_STATISTICS_PHASE_DATA_STRINGS,
+	          start_timestamp,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_get_phase_count(
+	          statistics,
+	          LIBLNK_STATISTICS_PHASE_DATA_STRINGS,
+	          &count,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT64(
+	 "count",
+	 count,
+	 (uint64_t) 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_end_phase(
+	          (liblnk_internal_statistics_t *) statistics,
+	          LIBLNK_STATISTICS_NUMBER_OF_PHASES,
+	          start_timestamp,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_statistics_merge function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_statistics_merge(
+     liblnk_statistics_t *statistics )
+{
+	libcerror_error_t *error              = NULL;
+	liblnk_statistics_t *other_statistics = NULL;
+	uint64_t value                        = 0;
+	int result                            = 0;
+
+	result = liblnk_statistics_initialize(
+	          &other_statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_add_counter(
+	          (liblnk_internal_statistics_t *) other_statistics,
+	          LIBLNK_STATISTICS_COUNTER_NUMBER_OF_READS,
+	          3,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_clear(
+	          statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = liblnk_statistics_merge(
+	          (liblnk_internal_statistics_t *) statistics,
+	          (liblnk_internal_statistics_t *) other_statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_merge(
+	          (liblnk_internal_statistics_t *) statistics,
+	          (liblnk_internal_statistics_t *) other_statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_get_counter(
+	          statistics,
+	          LIBLNK_STATISTICS_COUNTER_NUMBER_OF_READS,
+	          &value,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 6 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A copy replaces the values instead of adding them
+	 */
+	result = liblnk_statistics_copy(
+	          (liblnk_internal_statistics_t *) statistics,
+	          (liblnk_internal_statistics_t *) other_statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_statistics_get_counter(
+	          statistics,
+	          LIBLNK_STATISTICS_COUNTER_NUMBER_OF_READS,
+	          &value,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 3 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_statistics_merge(
+	          NULL,
+	          (liblnk_internal_statistics_t *) other_statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_statistics_merge(
+	          (liblnk_internal_statistics_t *) statistics,
+	          (liblnk_internal_statistics_t *) statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = liblnk_statistics_free(
+	          &other_statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( other_statistics != NULL )
+	{
+		liblnk_statistics_free(
+		 &other_statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error        = NULL;
+	liblnk_statistics_t *statistics = NULL;
+	int result                      = 0;
+
+	LNK_TEST_UNREFERENCED_PARAMETER( argc )
+	LNK_TEST_UNREFERENCED_PARAMETER( argv )
+
+	LNK_TEST_RUN(
+	 "liblnk_statistics_initialize",
+	 lnk_test_statistics_initialize );
+
+	LNK_TEST_RUN(
+	 "liblnk_statistics_free",
+	 lnk_test_statistics_free );
+
+	LNK_TEST_RUN(
+	 "liblnk_statistics_set_global",
+	 lnk_test_statistics_set_global );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize statistics for tests
+	 */
+	result = liblnk_statistics_initialize(
+	          &statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "statistics",
+	 statistics );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_statistics_clear",
+	 lnk_test_statistics_clear,
+	 statistics );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_statistics_get_phase_time",
+	 lnk_test_statistics_get_phase_time,
+	 statistics );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_statistics_get_phase_count",
+	 lnk_test_statistics_get_phase_count,
+	 statistics );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_statistics_get_counter",
+	 lnk_test_statistics_get_counter,
+	 statistics );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_statistics_get_number_of_data_blocks_by_signature",
+	 lnk_test_statistics_get_number_of_data_blocks_by_signature,
+	 statistics );
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_statistics_add_counter",
+	 lnk_test_statistics_add_counter,
+	 statistics );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_statistics_add_data_block",
+	 lnk_test_statistics_add_data_block,
+	 statistics );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_statistics_end_phase",
+	 lnk_test_statistics_end_phase,
+	 statistics );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_statistics_merge",
+	 lnk_test_statistics_merge,
+	 statistics );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = liblnk_statistics_free(
+	          &statistics,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "statistics",
+	 statistics );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( statistics != NULL )
+	{
+		liblnk_statistics_free(
+		 &statistics,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,596 @@
+/*
+ * Library stream functions test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_test_functions.h"
+#include "lnk_test_getopt.h"
+#include "lnk_test_libbfio.h"
+#include "lnk_test_libcerror.h"
+#include "lnk_test_liblnk.h"
+#include "lnk_test_macros.h"
+#include "lnk_test_memory.h"
+#include "lnk_test_unused.h"
+
+#define LNK_TEST_STREAM_MAXIMUM_NUMBER_OF_STRUCTURES	16
+
+/* A file header with a description string followed by the terminal data block
+ */
+uint8_t lnk_test_stream_data1[ 85 ] = {
+	0x4c, 0x00, 0x00, 0x00, 0x01, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x61, 0x62,
+	0x63, 0x00, 0x00, 0x00, 0x00 };
+
+typedef struct lnk_test_stream_structures lnk_test_stream_structures_t;
+
+struct lnk_test_stream_structures
+{
+	/* The structure types in the order they were passed
+	 */
+	int structure_types[ LNK_TEST_STREAM_MAXIMUM_NUMBER_OF_STRUCTURES ];
+
+	/* The data sizes in the order they were passed
+	 */
+	size_t data_sizes[ LNK_TEST_STREAM_MAXIMUM_NUMBER_OF_STRUCTURES ];
+
+	/* The number of structures
+	 */
+	int number_of_structures;
+
+	/* The number of structures after which to abort
+	 */
+	int abort_after;
+};
+
+/* Records a stream structure
+ * Returns 1 to continue or 0 to abort
+ */
+int lnk_test_stream_record_structure(
+     int structure_type,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_function_arguments )
+{
+	lnk_test_stream_structures_t *structures = NULL;
+
+	LNK_TEST_UNREFERENCED_PARAMETER( data )
+
+	structures = (lnk_test_stream_structures_t *) callback_function_arguments;
+
+	if( structures->number_of_structures < LNK_TEST_STREAM_MAXIMUM_NUMBER_OF_STRUCTURES )
+	{
+		structures->structure_types[ structures->number_of_structures ] = structure_type;
+		structures->data_sizes[ structures->number_of_structures ]      = data_size;
+	}
+	structures->number_of_structures += 1;
+
+	if( ( structures->abort_after > 0 )
+	 && ( structures->number_of_structures >= structures->abort_after ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the liblnk_stream_parse_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_stream_parse_memory(
+     void )
+{
+	lnk_test_stream_structures_t structures;
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	memset_result = memory_set(
+	                 &structures,
+	                 0,
+	                 sizeof( lnk_test_stream_structures_t ) );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = liblnk_stream_parse_memory(
+	          lnk_test_stream_data1,
+	          85,
+	          &lnk_test_stream_record_structure,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "structures.number_of_structures",
+	 structures.number_of_structures,
+	 2 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "structures.structure_types[ 0 ]",
+	 structures.structure_types[ 0 ],
+	 LIBLNK_STREAM_STRUCTURE_TYPE_FILE_HEADER );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "structures.data_sizes[ 0 ]",
+	 structures.data_sizes[ 0 ],
+	 (size_t) 76 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "structures.structure_types[ 1 ]",
+	 structures.structure_types[ 1 ],
+	 LIBLNK_STREAM_STRUCTURE_TYPE_DESCRIPTION );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "structures.data_sizes[ 1 ]",
+	 structures.data_sizes[ 1 ],
+	 (size_t) 3 );
+
+	/* Test abort by the callback function
+	 */
+	memset_result = memory_set(
+	                 &structures,
+	                 0,
+	                 sizeof( lnk_test_stream_structures_t ) );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	structures.abort_after = 1;
+
+	result = liblnk_stream_parse_memory(
+	          lnk_test_stream_data1,
+	          85,
+	          &lnk_test_stream_record_structure,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "structures.number_of_structures",
+	 structures.number_of_structures,
+	 1 );
+
+	/* Test error cases
+	 */
+	structures.abort_after = 0;
+
+	result = liblnk_stream_parse_memory(
+	          NULL,
+	          85,
+	          &lnk_test_stream_record_structure,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_stream_parse_memory(
+	          lnk_test_stream_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &lnk_test_stream_record_structure,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_stream_parse_memory(
+	          lnk_test_stream_data1,
+	          85,
+	          NULL,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test parse with data too small for the file header
+	 */
+	result = liblnk_stream_parse_memory(
+	          lnk_test_stream_data1,
+	          16,
+	          &lnk_test_stream_record_structure,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test parse with data too small for the description string
+	 */
+	result = liblnk_stream_parse_memory(
+	          lnk_test_stream_data1,
+	          76,
+	          &lnk_test_stream_record_structure,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_stream_parse function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_stream_parse(
+     const system_character_t *source )
+{
+	lnk_test_stream_structures_t structures;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	void *memset_result              = NULL;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = lnk_test_open_file_io_handle(
+	          &file_io_handle,
+	          lnk_test_stream_data1,
+	          85,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memset_result = memory_set(
+	                 &structures,
+	                 0,
+	                 sizeof( lnk_test_stream_structures_t ) );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	result = liblnk_stream_parse(
+	          file_io_handle,
+	          &lnk_test_stream_record_structure,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "structures.number_of_structures",
+	 structures.number_of_structures,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = liblnk_stream_parse(
+	          NULL,
+	          &lnk_test_stream_record_structure,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_stream_parse(
+	          file_io_handle,
+	          NULL,
+	          (void *) &structures,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = lnk_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( source != NULL )
+	{
+		/* Test parse of a file that is not open
+		 */
+		result = libbfio_file_initialize(
+		          &file_io_handle,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NOT_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		string_length = system_string_length(
+		                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libbfio_file_set_name_wide(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#else
+		result = libbfio_file_set_name(
+		          file_io_handle,
+		          source,
+		          string_length,
+		          &error );
+#endif
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		memset_result = memory_set(
+		                 &structures,
+		                 0,
+		                 sizeof( lnk_test_stream_structures_t ) );
+
+		LNK_TEST_ASSERT_IS_NOT_NULL(
+		 "memset_result",
+		 memset_result );
+
+		result = liblnk_stream_parse(
+		          file_io_handle,
+		          &lnk_test_stream_record_structure,
+		          (void *) &structures,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		LNK_TEST_ASSERT_GREATER_THAN_INT(
+		 "structures.number_of_structures",
+		 structures.number_of_structures,
+		 0 );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "structures.structure_types[ 0 ]",
+		 structures.structure_types[ 0 ],
+		 LIBLNK_STREAM_STRUCTURE_TYPE_FILE_HEADER );
+
+		result = libbfio_handle_free(
+		          &file_io_handle,
+		          &error );
+
+		LNK_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "file_io_handle",
+		 file_io_handle );
+
+		LNK_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+
+	while( ( option = lnk_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	LNK_TEST_RUN(
+	 "liblnk_stream_parse_memory",
+	 lnk_test_stream_parse_memory );
+
+	LNK_TEST_RUN_WITH_ARGS(
+	 "liblnk_stream_parse",
+	 lnk_test_stream_parse,
+	 source );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,330 @@
+/*
+ * Library string size functions test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_test_libcerror.h"
+#include "lnk_test_liblnk.h"
+#include "lnk_test_macros.h"
+#include "lnk_test_unused.h"
+
+#include "../liblnk/liblnk_string_size.h"
+
+/* "\\server\share\directory" followed by the end of string character and trailing data
+ */
+uint8_t lnk_test_string_size_byte_stream[ 32 ] = {
+	0x5c, 0x5c, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x5c, 0x73, 0x68, 0x61, 0x72, 0x65, 0x5c, 0x64,
+	0x69, 0x72, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x79, 0x00, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47 };
+
+/* "\\server\share\direc\u7400ory" followed by the end of string character and trailing data
+ * The 0-byte values of U+0063 and U+7400 must not be matched as the end of string character
+ */
+uint8_t lnk_test_string_size_utf16_stream[ 56 ] = {
+	0x5c, 0x00, 0x5c, 0x00, 0x73, 0x00, 0x65, 0x00, 0x72, 0x00, 0x76, 0x00, 0x65, 0x00, 0x72, 0x00,
+	0x5c, 0x00, 0x73, 0x00, 0x68, 0x00, 0x61, 0x00, 0x72, 0x00, 0x65, 0x00, 0x5c, 0x00, 0x64, 0x00,
+	0x69, 0x00, 0x72, 0x00, 0x65, 0x00, 0x63, 0x00, 0x00, 0x74, 0x6f, 0x00, 0x72, 0x00, 0x79, 0x00,
+	0x00, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+/* Tests the liblnk_string_size_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_string_size_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t string_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_string_size_from_byte_stream(
+	          lnk_test_string_size_byte_stream,
+	          32,
+	          &string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 25 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a byte stream without an end of string character
+	 */
+	result = liblnk_string_size_from_byte_stream(
+	          lnk_test_string_size_byte_stream,
+	          24,
+	          &string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 24 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_string_size_from_byte_stream(
+	          NULL,
+	          32,
+	          &string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_string_size_from_byte_stream(
+	          lnk_test_string_size_byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_string_size_from_byte_stream(
+	          lnk_test_string_size_byte_stream,
+	          32,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_string_size_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_string_size_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t string_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_string_size_from_utf16_stream(
+	          lnk_test_string_size_utf16_stream,
+	          56,
+	          &string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 50 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an UTF-16 stream without an end of string character
+	 */
+	result = liblnk_string_size_from_utf16_stream(
+	          lnk_test_string_size_utf16_stream,
+	          49,
+	          &string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 48 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_string_size_from_utf16_stream(
+	          NULL,
+	          56,
+	          &string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_string_size_from_utf16_stream(
+	          lnk_test_string_size_utf16_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_string_size_from_utf16_stream(
+	          lnk_test_string_size_utf16_stream,
+	          56,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	LNK_TEST_UNREFERENCED_PARAMETER( argc )
+	LNK_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+	LNK_TEST_RUN(
+	 "liblnk_string_size_from_byte_stream",
+	 lnk_test_string_size_from_byte_stream );
+
+	LNK_TEST_RUN(
+	 "liblnk_string_size_from_utf16_stream",
+	 lnk_test_string_size_from_utf16_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -46,8 +46,21 @@ int liblnk_check_file_signature_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+LIBLNK_EXTERN \
+int liblnk_file_header_probe_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     liblnk_file_header_values_t *file_header_values,
+     libcerror_error_t **error );
+
 #endif /* !defined( LIBLNK_HAVE_BFIO ) */
 
+uint8_t lnk_test_support_file_header_data1[ 76 ] = {
+	0x4c, 0x00, 0x00, 0x00, 0x01, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x46, 0x9f, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x37, 0x55,
+	0x70, 0xb9, 0xbb, 0x01, 0x00, 0x80, 0x93, 0xfc, 0x7d, 0xb3, 0xcb, 0x01, 0x00, 0x8c, 0x37, 0x55,
+	0x70, 0xb9, 0xbb, 0x01, 0x10, 0xd5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
 /* Tests the liblnk_get_version function
  * Returns 1 if successful or 0 if not
  */
@@ -713,6 +726,380 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the liblnk_file_header_probe function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_header_probe(
+     void )
+{
+	uint8_t empty_block[ 76 ];
+
+	liblnk_file_header_values_t file_header_values;
+
+	libcerror_error_t *error = NULL;
+	void *memset_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 empty_block,
+	                 0,
+	                 sizeof( uint8_t ) * 76 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test regular cases
+	 */
+	result = liblnk_file_header_probe(
+	          lnk_test_support_file_header_data1,
+	          76,
+	          &file_header_values,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header_values.data_flags",
+	 file_header_values.data_flags,
+	 (uint32_t) 0x0000029fUL );
+
+	LNK_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header_values.file_attribute_flags",
+	 file_header_values.file_attribute_flags,
+	 (uint32_t) 0x00000020UL );
+
+	LNK_TEST_ASSERT_EQUAL_UINT64(
+	 "file_header_values.creation_time",
+	 file_header_values.creation_time,
+	 (uint64_t) 0x01bbb97055378c00ULL );
+
+	LNK_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header_values.file_size",
+	 file_header_values.file_size,
+	 (uint32_t) 0x000ad510UL );
+
+	/* Test with data that does not contain a file header
+	 */
+	result = liblnk_file_header_probe(
+	          empty_block,
+	          76,
+	          &file_header_values,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data too small
+	 */
+	result = liblnk_file_header_probe(
+	          lnk_test_support_file_header_data1,
+	          75,
+	          &file_header_values,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_file_header_probe(
+	          NULL,
+	          76,
+	          &file_header_values,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_header_probe(
+	          lnk_test_support_file_header_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &file_header_values,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_file_header_probe(
+	          lnk_test_support_file_header_data1,
+	          76,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_file_header_probe_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_file_header_probe_file_io_handle(
+     void )
+{
+	uint8_t empty_block[ 8192 ];
+
+	liblnk_file_header_values_t file_header_values;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	void *memset_result              = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	memset_result = memory_set(
+	                 empty_block,
+	                 0,
+	                 sizeof( uint8_t ) * 8192 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	/* Test probe file header
+	 */
+	result = lnk_test_open_file_io_handle(
+	          &file_io_handle,
+	          lnk_test_support_file_header_data1,
+	          76,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_header_probe_file_io_handle(
+	          file_io_handle,
+	          &file_header_values,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	LNK_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header_values.data_flags",
+	 file_header_values.data_flags,
+	 (uint32_t) 0x0000029fUL );
+
+	result = lnk_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_file_header_probe_file_io_handle(
+	          NULL,
+	          &file_header_values,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test probe file header with data too small
+	 */
+	result = lnk_test_open_file_io_handle(
+	          &file_io_handle,
+	          empty_block,
+	          sizeof( uint8_t ) * 1,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_header_probe_file_io_handle(
+	          file_io_handle,
+	          &file_header_values,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = lnk_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test probe file header with empty block
+	 */
+	result = lnk_test_open_file_io_handle(
+	          &file_io_handle,
+	          empty_block,
+	          sizeof( uint8_t ) * 8192,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_file_header_probe_file_io_handle(
+	          file_io_handle,
+	          &file_header_values,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = lnk_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -788,6 +1175,14 @@ int main(
 
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 
+	LNK_TEST_RUN(
+	 "liblnk_file_header_probe",
+	 lnk_test_file_header_probe );
+
+	LNK_TEST_RUN(
+	 "liblnk_file_header_probe_file_io_handle",
+	 lnk_test_file_header_probe_file_io_handle );
+
 	return( EXIT_SUCCESS );
 
 on_error:
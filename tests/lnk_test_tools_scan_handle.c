@@ -0,0 +1,699 @@
+/*
+ * Tools scan_handle type test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_test_libcerror.h"
+#include "lnk_test_macros.h"
+#include "lnk_test_memory.h"
+#include "lnk_test_unused.h"
+
+#include "../lnktools/scan_handle.h"
+
+/* Tests the scan_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_tools_scan_handle_initialize(
+     void )
+{
+	scan_handle_t *scan_handle      = NULL;
+	libcerror_error_t *error        = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_LNK_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_free(
+	          &scan_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = scan_handle_initialize(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scan_handle = (scan_handle_t *) 0x12345678UL;
+
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          &error );
+
+	scan_handle = NULL;
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_LNK_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test scan_handle_initialize with malloc failing
+		 */
+		lnk_test_malloc_attempts_before_fail = test_number;
+
+		result = scan_handle_initialize(
+		          &scan_handle,
+		          &error );
+
+		if( lnk_test_malloc_attempts_before_fail != -1 )
+		{
+			lnk_test_malloc_attempts_before_fail = -1;
+
+			if( scan_handle != NULL )
+			{
+				scan_handle_free(
+				 &scan_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			LNK_TEST_ASSERT_IS_NULL(
+			 "scan_handle",
+			 scan_handle );
+
+			LNK_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test scan_handle_initialize with memset failing
+		 */
+		lnk_test_memset_attempts_before_fail = test_number;
+
+		result = scan_handle_initialize(
+		          &scan_handle,
+		          &error );
+
+		if( lnk_test_memset_attempts_before_fail != -1 )
+		{
+			lnk_test_memset_attempts_before_fail = -1;
+
+			if( scan_handle != NULL )
+			{
+				scan_handle_free(
+				 &scan_handle,
+				 NULL );
+			}
+		}
+		else
+		{
+			LNK_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			LNK_TEST_ASSERT_IS_NULL(
+			 "scan_handle",
+			 scan_handle );
+
+			LNK_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_LNK_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &scan_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the scan_handle_free function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_tools_scan_handle_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = scan_handle_free(
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the scan_handle_set_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_tools_scan_handle_set_number_of_threads(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	scan_handle_t *scan_handle = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = scan_handle_initialize(
+	          &scan_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = scan_handle_set_number_of_threads(
+	          scan_handle,
+	          _SYSTEM_STRING( "8" ),
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_set_number_of_threads(
+	          scan_handle,
+	          _SYSTEM_STRING( "0" ),
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_set_number_of_threads(
+	          scan_handle,
+	          _SYSTEM_STRING( "99" ),
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = scan_handle_set_number_of_threads(
+	          scan_handle,
+	          _SYSTEM_STRING( "x" ),
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = scan_handle_set_number_of_threads(
+	          NULL,
+	          _SYSTEM_STRING( "8" ),
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_set_number_of_threads(
+	          scan_handle,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = scan_handle_free(
+	          &scan_handle,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "scan_handle",
+	 scan_handle );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scan_handle != NULL )
+	{
+		scan_handle_free(
+		 &scan_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the scan_handle_path_is_shortcut function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_tools_scan_handle_path_is_shortcut(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = scan_handle_path_is_shortcut(
+	          _SYSTEM_STRING( "Calculator.lnk" ),
+	          14 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = scan_handle_path_is_shortcut(
+	          _SYSTEM_STRING( "CALCULATOR.LNK" ),
+	          14 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = scan_handle_path_is_shortcut(
+	          _SYSTEM_STRING( "Calculator.lnkx" ),
+	          15 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = scan_handle_path_is_shortcut(
+	          _SYSTEM_STRING( "lnk" ),
+	          3 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = scan_handle_path_is_shortcut(
+	          NULL,
+	          14 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the scan_handle_join_path function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_tools_scan_handle_join_path(
+     void )
+{
+	system_character_t expected_path[ 8 ] = {
+		(system_character_t) 'd', (system_character_t) 'i', (system_character_t) 'r',
+		(system_character_t) SCAN_HANDLE_PATH_SEPARATOR,
+		(system_character_t) 'a', (system_character_t) '.', (system_character_t) 'b',
+		0 };
+
+	system_character_t directory_path[ 5 ] = {
+		(system_character_t) 'd', (system_character_t) 'i', (system_character_t) 'r',
+		(system_character_t) SCAN_HANDLE_PATH_SEPARATOR,
+		0 };
+
+	libcerror_error_t *error = NULL;
+	system_character_t *path = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = scan_handle_join_path(
+	          _SYSTEM_STRING( "dir" ),
+	          _SYSTEM_STRING( "a.b" ),
+	          &path,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "path",
+	 path );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          path,
+	          expected_path,
+	          sizeof( system_character_t ) * 8 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	/* Test that a trailing path separator is not duplicated
+	 */
+	result = scan_handle_join_path(
+	          directory_path,
+	          _SYSTEM_STRING( "a.b" ),
+	          &path,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "path",
+	 path );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          path,
+	          expected_path,
+	          sizeof( system_character_t ) * 8 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 path );
+
+	path = NULL;
+
+	/* Test error cases
+	 */
+	result = scan_handle_join_path(
+	          NULL,
+	          _SYSTEM_STRING( "a.b" ),
+	          &path,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_join_path(
+	          _SYSTEM_STRING( "dir" ),
+	          NULL,
+	          &path,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = scan_handle_join_path(
+	          _SYSTEM_STRING( "dir" ),
+	          _SYSTEM_STRING( "a.b" ),
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path != NULL )
+	{
+		memory_free(
+		 path );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	LNK_TEST_UNREFERENCED_PARAMETER( argc )
+	LNK_TEST_UNREFERENCED_PARAMETER( argv )
+
+	LNK_TEST_RUN(
+	 "scan_handle_initialize",
+	 lnk_test_tools_scan_handle_initialize );
+
+	LNK_TEST_RUN(
+	 "scan_handle_free",
+	 lnk_test_tools_scan_handle_free );
+
+	LNK_TEST_RUN(
+	 "scan_handle_set_number_of_threads",
+	 lnk_test_tools_scan_handle_set_number_of_threads );
+
+	LNK_TEST_RUN(
+	 "scan_handle_path_is_shortcut",
+	 lnk_test_tools_scan_handle_path_is_shortcut );
+
+	LNK_TEST_RUN(
+	 "scan_handle_join_path",
+	 lnk_test_tools_scan_handle_join_path );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
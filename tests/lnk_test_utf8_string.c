@@ -0,0 +1,530 @@
+/*
+ * Library UTF-8 string functions test program
+ *
+ * Copyright (C) 2009-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "lnk_test_libcerror.h"
+#include "lnk_test_liblnk.h"
+#include "lnk_test_macros.h"
+#include "lnk_test_unused.h"
+
+#include "../liblnk/liblnk_utf8_string.h"
+
+/* "Local Disk C:\Documents and Settings\Administrator" followed by the end of string character
+ */
+uint8_t lnk_test_utf8_string_utf16_stream_ascii[ 104 ] = {
+	0x4c, 0x00, 0x6f, 0x00, 0x63, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x44, 0x00, 0x69, 0x00,
+	0x73, 0x00, 0x6b, 0x00, 0x20, 0x00, 0x43, 0x00, 0x3a, 0x00, 0x5c, 0x00, 0x44, 0x00, 0x6f, 0x00,
+	0x63, 0x00, 0x75, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x73, 0x00, 0x20, 0x00,
+	0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x53, 0x00, 0x65, 0x00, 0x74, 0x00, 0x74, 0x00,
+	0x69, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x73, 0x00, 0x5c, 0x00, 0x41, 0x00, 0x64, 0x00, 0x6d, 0x00,
+	0x69, 0x00, 0x6e, 0x00, 0x69, 0x00, 0x73, 0x00, 0x74, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00,
+	0x6f, 0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* "Caf\u00e9 costs 5\u20ac" followed by the end of string character and trailing data
+ */
+uint8_t lnk_test_utf8_string_utf16_stream_bmp[ 34 ] = {
+	0x43, 0x00, 0x61, 0x00, 0x66, 0x00, 0xe9, 0x00, 0x20, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x73, 0x00,
+	0x74, 0x00, 0x73, 0x00, 0x20, 0x00, 0x35, 0x00, 0xac, 0x20, 0x00, 0x00, 0x41, 0x00, 0x42, 0x00,
+	0x43, 0x00 };
+
+/* "A\U0001f600" which contains a surrogate pair
+ */
+uint8_t lnk_test_utf8_string_utf16_stream_surrogate[ 8 ] = {
+	0x41, 0x00, 0x3d, 0xd8, 0x00, 0xde, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+/* Tests the liblnk_utf8_string_get_ascii_blocks_size function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_utf8_string_get_ascii_blocks_size(
+     void )
+{
+	size_t blocks_size = 0;
+
+	/* Test regular cases
+	 */
+	blocks_size = liblnk_utf8_string_get_ascii_blocks_size(
+	               lnk_test_utf8_string_utf16_stream_ascii,
+	               104 );
+
+	/* The blocks should stop before the 8 bytes that contain the end of string character
+	 */
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "blocks_size",
+	 blocks_size,
+	 (size_t) 96 );
+
+	blocks_size = liblnk_utf8_string_get_ascii_blocks_size(
+	               lnk_test_utf8_string_utf16_stream_bmp,
+	               34 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "blocks_size",
+	 blocks_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	blocks_size = liblnk_utf8_string_get_ascii_blocks_size(
+	               NULL,
+	               104 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "blocks_size",
+	 blocks_size,
+	 (size_t) 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the liblnk_utf8_string_size_from_utf16_stream_without_surrogates function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_utf8_string_size_from_utf16_stream_without_surrogates(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_utf8_string_size_from_utf16_stream_without_surrogates(
+	          lnk_test_utf8_string_utf16_stream_ascii,
+	          104,
+	          &utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 51 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_utf8_string_size_from_utf16_stream_without_surrogates(
+	          lnk_test_utf8_string_utf16_stream_bmp,
+	          34,
+	          &utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 17 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test streams that are not supported
+	 */
+	result = liblnk_utf8_string_size_from_utf16_stream_without_surrogates(
+	          lnk_test_utf8_string_utf16_stream_surrogate,
+	          8,
+	          &utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = liblnk_utf8_string_size_from_utf16_stream_without_surrogates(
+	          lnk_test_utf8_string_utf16_stream_ascii,
+	          103,
+	          &utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_utf8_string_size_from_utf16_stream_without_surrogates(
+	          NULL,
+	          104,
+	          &utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_utf8_string_size_from_utf16_stream_without_surrogates(
+	          lnk_test_utf8_string_utf16_stream_ascii,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_utf8_string_size_from_utf16_stream_without_surrogates(
+	          lnk_test_utf8_string_utf16_stream_ascii,
+	          104,
+	          NULL,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates function
+ * Returns 1 if successful or 0 if not
+ */
+int lnk_test_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+     void )
+{
+	uint8_t expected_utf8_string[ 17 ] = {
+		'C', 'a', 'f', 0xc3, 0xa9, ' ', 'c', 'o', 's', 't', 's', ' ', '5', 0xe2, 0x82, 0xac, 0 };
+
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          lnk_test_utf8_string_utf16_stream_ascii,
+	          104,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 51 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "Local Disk C:\\Documents and Settings\\Administrator",
+	          51 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          lnk_test_utf8_string_utf16_stream_bmp,
+	          34,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 17 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          17 );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test streams that are not supported
+	 */
+	utf8_string_index = 0;
+
+	result = liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          lnk_test_utf8_string_utf16_stream_surrogate,
+	          8,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	LNK_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+	          NULL,
+	          64,
+	          &utf8_string_index,
+	          lnk_test_utf8_string_utf16_stream_ascii,
+	          104,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+	          utf8_string,
+	          64,
+	          NULL,
+	          lnk_test_utf8_string_utf16_stream_ascii,
+	          104,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+	          utf8_string,
+	          64,
+	          &utf8_string_index,
+	          NULL,
+	          104,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	utf8_string_index = 0;
+
+	result = liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+	          utf8_string,
+	          50,
+	          &utf8_string_index,
+	          lnk_test_utf8_string_utf16_stream_ascii,
+	          104,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 0 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates(
+	          utf8_string,
+	          15,
+	          &utf8_string_index,
+	          lnk_test_utf8_string_utf16_stream_bmp,
+	          34,
+	          &error );
+
+	LNK_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	LNK_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc LNK_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] LNK_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	LNK_TEST_UNREFERENCED_PARAMETER( argc )
+	LNK_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT )
+
+	LNK_TEST_RUN(
+	 "liblnk_utf8_string_get_ascii_blocks_size",
+	 lnk_test_utf8_string_get_ascii_blocks_size );
+
+	LNK_TEST_RUN(
+	 "liblnk_utf8_string_size_from_utf16_stream_without_surrogates",
+	 lnk_test_utf8_string_size_from_utf16_stream_without_surrogates );
+
+	LNK_TEST_RUN(
+	 "liblnk_utf8_string_with_index_copy_from_utf16_stream_without_surrogates",
+	 lnk_test_utf8_string_with_index_copy_from_utf16_stream_without_surrogates );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBLNK_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -70,7 +70,15 @@ class DatablockTypeTests(unittest.TestCase):
       data = data_block.get_data()
       self.assertIsNotNone(data)
 
-      self.assertIsNotNone(data_block.data)
+      data_view = data_block.data
+      self.assertIsInstance(data_view, memoryview)
+      self.assertTrue(data_view.readonly)
+      self.assertEqual(data_view.tobytes(), data)
+
+      with self.assertRaises(BufferError):
+        lnk_file.close()
+
+      data_view.release()
 
     lnk_file.close()
 
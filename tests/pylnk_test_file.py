@@ -20,6 +20,7 @@
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 import argparse
+import io
 import os
 import sys
 import unittest
@@ -27,6 +28,20 @@ import unittest
 import pylnk
 
 
+class ReadCountingBytesIO(io.BytesIO):
+  """In-memory file-like object that counts the number of reads."""
+
+  def __init__(self, initial_bytes):
+    """Initializes the file-like object."""
+    super(ReadCountingBytesIO, self).__init__(initial_bytes)
+    self.number_of_reads = 0
+
+  def read(self, size=-1):
+    """Reads data from the file-like object."""
+    self.number_of_reads += 1
+    return super(ReadCountingBytesIO, self).read(size)
+
+
 class FileTypeTests(unittest.TestCase):
   """Tests the file type."""
 
@@ -83,6 +98,63 @@ class FileTypeTests(unittest.TestCase):
       with self.assertRaises(ValueError):
         lnk_file.open_file_object(file_object, mode="w")
 
+  def test_open_file_object_read_ahead(self):
+    """Tests the open_file_object function reads ahead from the file object."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    with open(test_source, "rb") as file_object:
+      file_data = file_object.read()
+
+    file_object = ReadCountingBytesIO(file_data)
+
+    lnk_file = pylnk.file()
+
+    lnk_file.open_file_object(file_object)
+
+    # The shortcut data should be read into the read-ahead buffer with a few
+    # reads instead of a read per structure.
+    self.assertLessEqual(file_object.number_of_reads, 4)
+
+    lnk_file.close()
+
+  def test_open_bytes(self):
+    """Tests the open_bytes function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    with open(test_source, "rb") as file_object:
+      file_data = bytearray(file_object.read())
+
+    lnk_file = pylnk.file()
+
+    lnk_file.open_bytes(file_data)
+
+    with self.assertRaises(IOError):
+      lnk_file.open_bytes(file_data)
+
+    # The buffer view held by the file prevents the buffer from being resized.
+    with self.assertRaises(BufferError):
+      file_data.append(0)
+
+    lnk_file.close()
+
+    file_data.append(0)
+
+    with self.assertRaises(TypeError):
+      lnk_file.open_bytes(None)
+
+    with self.assertRaises(ValueError):
+      lnk_file.open_bytes(file_data, mode="w")
+
   def test_close(self):
     """Tests the close function."""
     test_source = getattr(unittest, "source", None)
@@ -559,6 +631,31 @@ class FileTypeTests(unittest.TestCase):
     lnk_file.close()
 
 
+  def test_to_dict(self):
+    """Tests the to_dict function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    lnk_file = pylnk.file()
+
+    lnk_file.open(test_source)
+
+    values = lnk_file.to_dict()
+    self.assertIsNotNone(values)
+
+    self.assertEqual(values["data_flags"], lnk_file.data_flags)
+    self.assertEqual(values["file_size"], lnk_file.file_size)
+    self.assertEqual(values["local_path"], lnk_file.local_path)
+    self.assertEqual(values["description"], lnk_file.description)
+    self.assertEqual(
+        values["number_of_data_blocks"], lnk_file.number_of_data_blocks)
+
+    lnk_file.close()
+
+    with self.assertRaises(IOError):
+      lnk_file.to_dict()
+
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
 
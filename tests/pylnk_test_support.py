@@ -93,6 +93,67 @@ class SupportFunctionsTests(unittest.TestCase):
         pylnk.open_file_object(file_object, mode="w")
 
 
+  def test_open_bytes(self):
+    """Tests the open_bytes function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not os.path.isfile(test_source):
+      raise unittest.SkipTest("source not a regular file")
+
+    with open(test_source, "rb") as file_object:
+      file_data = file_object.read()
+
+    lnk_file = pylnk.open_bytes(file_data)
+    self.assertIsNotNone(lnk_file)
+
+    lnk_file.close()
+
+    lnk_file = pylnk.open_bytes(memoryview(file_data))
+    self.assertIsNotNone(lnk_file)
+
+    lnk_file.close()
+
+    with self.assertRaises(TypeError):
+      pylnk.open_bytes(None)
+
+    with self.assertRaises(ValueError):
+      pylnk.open_bytes(file_data, mode="w")
+
+  def test_parse_many(self):
+    """Tests the parse_many function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    result = pylnk.parse_many([test_source, test_source])
+    self.assertEqual(len(result), 2)
+    self.assertIsNotNone(result[0])
+    self.assertEqual(result[0], result[1])
+
+    result = pylnk.parse_many([test_source, test_source], workers=2)
+    self.assertEqual(len(result), 2)
+    self.assertIsNotNone(result[0])
+    self.assertEqual(result[0], result[1])
+
+    result = pylnk.parse_many([test_source, ""], workers=2)
+    self.assertEqual(len(result), 2)
+    self.assertIsNotNone(result[0])
+    self.assertIsNone(result[1])
+
+    result = pylnk.parse_many([])
+    self.assertEqual(result, [])
+
+    with self.assertRaises(ValueError):
+      pylnk.parse_many([test_source], workers=0)
+
+    with self.assertRaises(TypeError):
+      pylnk.parse_many(None)
+
+    with self.assertRaises(TypeError):
+      pylnk.parse_many([None])
+
 if __name__ == "__main__":
   argument_parser = argparse.ArgumentParser()
 
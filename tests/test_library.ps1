@@ -1,7 +1,7 @@
 # Tests library functions and types.
 
-$LibraryTests = "data_block data_string distributed_link_tracker_properties error file_header io_handle known_folder_location link_target_identifier location_information notify special_folder_location"
-$LibraryTestsWithInput = "file support"
+$LibraryTests = "arena data_block data_string distributed_link_tracker_properties error file_header io_handle known_folder_location link_target_identifier location_information notify special_folder_location statistics string_size utf8_string"
+$LibraryTestsWithInput = "batch file stream support"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1
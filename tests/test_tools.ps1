@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "info_handle output path_string signal"
+$ToolsTests = "info_handle output path_string scan_handle signal"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1